@@ -0,0 +1,583 @@
+#include "io.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#	include <sys/mman.h>
+#	include <unistd.h>
+#endif
+
+/** Are cells stored in memory in BGR order? */
+#define CELLS_BGR     (BGR(1) == 1)
+
+#define ALIGN_UP(n, a)  (((n) + (a)-1) / (a) * (a))
+
+/** Signed deltas as varints, small magnitudes of either sign staying short */
+#define ZIGZAG(d)       (uint32_t)(((d) < 0) ? -2*(d) - 1 : 2*(d))
+#define UNZIGZAG(z)     (((z) & 1) ? -(int64_t)((z)/2) - 1 : (int64_t)((z)/2))
+
+/** Encoded rows are written out in blocks of about this size */
+#define PACK_FLUSH_SZ   (size_t)(1U << 16)
+
+/** Stored for COLOR_NONE, which BGR(c) would turn into a valid color */
+#define NO_COLOR        0xFFU
+
+bool is_lant_binary(const char *filename)
+{
+	char magic[LANT_MAGIC_SZ];
+	FILE *input;
+	bool is_binary;
+
+	if (!(input = fopen(filename, "rb"))) {
+		return false;
+	}
+	is_binary = fread(magic, 1, LANT_MAGIC_SZ, input) == LANT_MAGIC_SZ
+	         && !memcmp(magic, LANT_MAGIC, LANT_MAGIC_SZ);
+	fclose(input);
+	return is_binary;
+}
+
+/* Maps (or reads, where mapping is unavailable) a section of the file */
+static byte *map_section(FILE *file, uint64_t offset, size_t size, bool *is_mapped)
+{
+	byte *data;
+
+	*is_mapped = false;
+	if (!size) {
+		return NULL;
+	}
+#ifndef _WIN32
+	if (offset % (uint64_t)sysconf(_SC_PAGESIZE) == 0) {
+		data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(file), (off_t)offset);
+		if (data != MAP_FAILED) {
+			*is_mapped = true;
+			return data;
+		}
+	}
+#endif
+	if (!(data = malloc(size))) {
+		return NULL;
+	}
+	if (file_seek(file, offset) || fread(data, 1, size, file) != size) {
+		free(data);
+		return NULL;
+	}
+	return data;
+}
+
+static void unmap_section(byte *data, size_t size, bool is_mapped)
+{
+#ifndef _WIN32
+	if (is_mapped) {
+		munmap(data, size);
+		return;
+	}
+#endif
+	(void)size, (void)is_mapped;
+	free(data);
+}
+
+static bool set_dense_rows(Grid *grid, size_t size)
+{
+	size_t i;
+	if (!(grid->c = malloc(size * sizeof(byte *)))) {
+		return false;
+	}
+	for (i = 0; i < size; i++) {
+		grid->c[i] = grid->block + i*size;
+	}
+	return true;
+}
+
+/* Takes over raw cells, converting them if written in the other order */
+static bool set_dense_cells(Grid *grid, const LantHeader *h)
+{
+	size_t i;
+	if (!h->cells_bgr != !CELLS_BGR) {
+		for (i = 0; i < grid->block_size; i++) {  // Written on a different platform
+			grid->block[i] = RGB_BGR(grid->block[i]);
+		}
+	}
+	return set_dense_rows(grid, h->size);
+}
+
+static bool load_cells_dense(Grid *grid, FILE *input, const LantHeader *h)
+{
+	if (h->data_size != (uint64_t)h->size * h->size) {
+		return false;
+	}
+	grid->block_size = (size_t)h->data_size;
+	if (!(grid->block = map_section(input, h->data_offset, grid->block_size, &grid->is_mapped))) {
+		return false;
+	}
+	return set_dense_cells(grid, h);
+}
+
+static bool load_cells_sparse(Grid *grid, const byte *data, const LantHeader *h)
+{
+	size_t size = h->size, index_sz = (size+1) * sizeof(uint64_t), i;
+	const uint64_t *offsets = (const uint64_t *)data;
+	const uint32_t *cells = (const uint32_t *)(data + index_sz);
+	uint64_t count;
+
+	if (h->data_size < index_sz) {
+		return false;
+	}
+	count = offsets[size];
+	if (h->data_size != index_sz + count*sizeof(uint32_t)) {
+		return false;
+	}
+	if (!(grid->csr = calloc(size, sizeof(SparseCell *)))) {
+		return false;
+	}
+
+	for (i = 0; i < size; i++) {
+		SparseCell cell, *sc = &cell, *p = NULL;
+		uint64_t j;
+		if (offsets[i] > offsets[i+1] || offsets[i+1] > count || !io_progress(i, size)) {
+			return false;
+		}
+		for (j = offsets[i]; j < offsets[i+1]; j++) {
+			cell.packed = cells[j];
+			if (!h->cells_bgr != !CELLS_BGR) {
+				CSR_SET_COLOR(sc, RGB_BGR(CSR_GET_COLOR(sc)));
+			}
+			p = sparse_append(p, CSR_GET_COLUMN(sc), CSR_GET_COLOR(sc));
+			if (!grid->csr[i]) {
+				grid->csr[i] = p;
+			}
+		}
+	}
+	return true;
+}
+
+/*----------------------------- Packed encoding ------------------------------*/
+
+static bool get_varint(const byte **p, const byte *end, uint32_t *value)
+{
+	unsigned shift;
+	*value = 0;
+	for (shift = 0; shift < 7*LANT_VARINT_MAX && *p < end; shift += 7) {
+		byte b = *(*p)++;
+		*value |= (uint32_t)(b & 0x7F) << shift;
+		if (!(b & 0x80)) {
+			return true;
+		}
+	}
+	return false;  // Truncated or too long
+}
+
+static void put_varint(byte *out, size_t *n, uint32_t value)
+{
+	for (; value >= 0x80; value >>= 7) {
+		out[(*n)++] = (byte)(value | 0x80);
+	}
+	out[(*n)++] = (byte)value;
+}
+
+/* Decodes the spans straight into row lists (or the block), one row at a time */
+static bool load_cells_packed(Grid *grid, const byte *data, const LantHeader *h)
+{
+	bool dense = h->representation == LANT_PACKED_DENSE;
+	const byte *p, *end;
+	uint32_t skip, spans, gap, head;
+	uint64_t origin = 0;
+	size_t row = 0;
+
+	if (dense) {
+		grid->block_size = (size_t)h->size * h->size;
+		if (!(grid->block = malloc(grid->block_size))) {
+			return false;
+		}
+		memset(grid->block, grid->def_color, grid->block_size);
+		if (!set_dense_rows(grid, h->size)) {
+			return false;
+		}
+	} else if (!(grid->csr = calloc(h->size, sizeof(SparseCell *)))) {
+		return false;
+	}
+
+	for (p = data, end = data + h->data_size; p < end; row++) {
+		SparseCell *tail = NULL;
+		uint64_t column = 0;
+		bool first = true;
+		if (!get_varint(&p, end, &skip) || !get_varint(&p, end, &spans)
+		 || (row += skip) >= h->size || !io_progress(row, h->size)) {
+			return false;
+		}
+		for (; spans > 0; spans--) {
+			uint64_t len, k;
+			bool literal;
+			if (!get_varint(&p, end, &gap) || !get_varint(&p, end, &head)) {
+				return false;
+			}
+			literal = head & 1;
+			len = (literal ? head>>1 : head>>5) + 1ULL;
+			column = first ? origin + UNZIGZAG(gap) : column + gap;
+			if (first) {
+				origin = column, first = false;
+			}
+			if (column + len > h->size || (literal && (uint64_t)(end - p) < (len+1) / 2)) {
+				return false;
+			}
+			for (k = 0; k < len; k++, column++) {
+				byte color = literal ? (p[k/2] >> (k%2 * 4)) & 0xF : (head>>1) & 0xF;
+				if (!h->cells_bgr != !CELLS_BGR) {
+					color = RGB_BGR(color);
+				}
+				if (dense) {
+					grid->c[row][column] = color;
+					continue;
+				}
+				tail = sparse_append(tail, (unsigned)column, color);
+				if (!grid->csr[row]) {
+					grid->csr[row] = tail;
+				}
+			}
+			p += literal ? (len+1) / 2 : 0;
+		}
+	}
+	return true;
+}
+
+/*--------------------------------- Loading ----------------------------------*/
+
+/* Checks the rules, which are used as indices from the first step on */
+static bool check_colors(const LantHeader *h)
+{
+	color_t i;
+
+	for (i = 0; i < COLOR_COUNT; i++) {
+		if (h->next[i] >= COLOR_COUNT || abs(h->turn[i]) > 1) {
+			return false;
+		}
+	}
+	if (h->first == NO_COLOR || h->last == NO_COLOR) {
+		return h->first == h->last && !h->n;  // No colors yet
+	}
+	return h->first < COLOR_COUNT && h->last < COLOR_COUNT && h->n <= COLOR_COUNT;
+}
+
+/* Checks a header against the size of the snapshot it was read from */
+static bool check_header(const LantHeader *h, uint64_t total_size)
+{
+	return !memcmp(h->magic, LANT_MAGIC, LANT_MAGIC_SZ) && h->version == LANT_VERSION
+	    && h->byte_order == LANT_BYTE_ORDER && h->header_size >= sizeof *h
+	    && h->data_offset >= h->header_size && h->data_offset <= total_size
+	    && h->data_size <= total_size - h->data_offset  // Mapping past EOF would fault
+	    && h->def < COLOR_COUNT && h->def_color < COLOR_COUNT && check_colors(h)
+	    && h->representation <= LANT_PACKED_DENSE && h->size && h->init_size <= h->size
+	    && h->ant_y >= 0 && (uint32_t)h->ant_y < h->size && h->ant_x >= 0 && (uint32_t)h->ant_x < h->size
+	    && h->ant_dir <= DIR_LEFT
+	    && h->top_left_y >= 0 && h->top_left_y <= h->bottom_right_y && (uint32_t)h->bottom_right_y < h->size
+	    && h->top_left_x >= 0 && h->top_left_x <= h->bottom_right_x && (uint32_t)h->bottom_right_x < h->size;
+}
+
+static color_t get_color(uint8_t c)
+{
+	return (c == NO_COLOR) ? COLOR_NONE : BGR(c);
+}
+
+static uint8_t put_color(color_t c)
+{
+	return (c == COLOR_NONE) ? NO_COLOR : (uint8_t)BGR(c);
+}
+
+/* Creates the simulation described by the header, with a grid awaiting its cells */
+static Simulation *new_simulation(const LantHeader *h)
+{
+	Simulation *sim;
+	Colors *colors;
+	Grid *grid;
+	color_t i;
+
+	colors = colors_new(BGR(h->def));
+	for (i = 0; i < COLOR_COUNT; i++) {
+		colors->next[BGR(i)] = BGR(h->next[i]);
+		colors->turn[BGR(i)] = h->turn[i];
+	}
+	colors->first = get_color(h->first), colors->last = get_color(h->last);
+	colors->n = h->n;
+
+	sim = simulation_new(colors, GRID_DEF_INIT_SIZE);
+	sim->ant->pos.y = h->ant_y, sim->ant->pos.x = h->ant_x;
+	sim->ant->dir = h->ant_dir;
+	sim->steps = h->steps;
+
+	grid_delete(sim->grid);  // Replace default grid with loaded data
+	if (!(sim->grid = grid = calloc(1, sizeof(Grid)))) {
+		sim->grid = grid_new(colors, GRID_DEF_INIT_SIZE);
+		simulation_delete(sim);
+		return NULL;
+	}
+	grid->def_color = BGR(h->def_color);
+	grid->init_size = h->init_size, grid->size = h->size;
+	grid->colored = h->colored;
+	grid->top_left.y = h->top_left_y, grid->top_left.x = h->top_left_x;
+	grid->bottom_right.y = h->bottom_right_y, grid->bottom_right.x = h->bottom_right_x;
+	return sim;
+}
+
+static void delete_partial(Simulation *sim)
+{
+	if (!sim->grid->c && !sim->grid->csr) {
+		sim->grid->size = 0;  // No rows to free, only the block
+	}
+	simulation_delete(sim);
+}
+
+Simulation *load_simulation_binary(const char *filename)
+{
+	Simulation *sim = NULL;
+	LantHeader h;
+	FILE *input;
+	long long size;
+	bool is_mapped, ok;
+	byte *data;
+
+	if (!(input = fopen(filename, "rb"))) {
+		return NULL;
+	}
+	if (fread(&h, sizeof h, 1, input) < 1 || (size = file_size(input)) < 0
+	 || !check_header(&h, (uint64_t)size) || !(sim = new_simulation(&h))) {
+		goto error_end;
+	}
+
+	if (h.representation == LANT_DENSE) {
+		ok = load_cells_dense(sim->grid, input, &h);
+	} else if (!h.data_size) {
+		ok = load_cells_packed(sim->grid, NULL, &h);  // No colored cells
+	} else if ((data = map_section(input, h.data_offset, (size_t)h.data_size, &is_mapped))) {
+		ok = (h.representation == LANT_SPARSE) ? load_cells_sparse(sim->grid, data, &h)
+		                                       : load_cells_packed(sim->grid, data, &h);
+		unmap_section(data, (size_t)h.data_size, is_mapped);
+	} else {
+		ok = false;
+	}
+	if (!ok) {
+		goto error_end;
+	}
+
+	fclose(input);  // Mapping stays valid after the file is closed
+	return sim;
+
+error_end:
+	fclose(input);
+	if (sim) {
+		delete_partial(sim);
+	}
+	return NULL;
+}
+
+Simulation *load_simulation_memory(const byte *data, size_t size)
+{
+	Simulation *sim;
+	const byte *cells;
+	LantHeader h;
+	bool ok;
+
+	if (size < sizeof h) {
+		return NULL;
+	}
+	memcpy(&h, data, sizeof h);  // Arrays of bytes needn't be aligned for the header
+	if (!check_header(&h, size) || !(sim = new_simulation(&h))) {
+		return NULL;
+	}
+	cells = data + h.data_offset;
+
+	switch (h.representation) {
+	case LANT_DENSE:
+		sim->grid->block_size = (size_t)h.data_size;
+		ok = h.data_size == (uint64_t)h.size * h.size && (sim->grid->block = malloc(sim->grid->block_size));
+		if (ok) {
+			memcpy(sim->grid->block, cells, sim->grid->block_size);
+			ok = set_dense_cells(sim->grid, &h);
+		}
+		break;
+	case LANT_SPARSE:
+		ok = (uintptr_t)cells % sizeof(uint64_t) == 0  // Row offsets are read in place
+		  && load_cells_sparse(sim->grid, cells, &h);
+		break;
+	default:
+		ok = load_cells_packed(sim->grid, cells, &h);
+		break;
+	}
+	if (!ok) {
+		delete_partial(sim);
+		return NULL;
+	}
+	return sim;
+}
+
+static int write_cells_dense(Grid *grid, FILE *output)
+{
+	unsigned i;
+	for (i = 0; i < grid->size; i++) {
+		if (fwrite(grid->c[i], 1, grid->size, output) < grid->size || !io_progress(i+1, grid->size)) {
+			return EOF;
+		}
+	}
+	return 0;
+}
+
+static size_t run_length(const byte *colors, size_t i, size_t end)
+{
+	size_t j;
+	for (j = i+1; j < end && colors[j] == colors[i]; j++);
+	return j - i;
+}
+
+/* Splits a row into spans; only counts them if out is NULL */
+static uint32_t encode_spans(const uint32_t *columns, const byte *colors, size_t m,
+                             uint32_t origin, byte *out, size_t *n)
+{
+	uint32_t spans = 0, prev_end = 0, gap;
+	size_t i, seg, j, k, r;
+
+	for (i = 0; i < m; i = seg) {
+		for (seg = i+1; seg < m && columns[seg] == columns[seg-1]+1; seg++);  // Adjacent cells
+		gap = i ? columns[i] - prev_end : ZIGZAG((int64_t)columns[0] - origin);
+		for (j = i; j < seg; j = k, gap = 0, spans++) {
+			if ((r = run_length(colors, j, seg)) >= LANT_RUN_MIN) {
+				k = j + r;
+				if (out) {
+					put_varint(out, n, gap);
+					put_varint(out, n, (uint32_t)(r-1) << 5 | (uint32_t)colors[j] << 1);
+				}
+				continue;
+			}
+			for (k = j; k < seg && (r = run_length(colors, k, seg)) < LANT_RUN_MIN; k += r);
+			if (out) {
+				put_varint(out, n, gap);
+				put_varint(out, n, (uint32_t)(k-j-1) << 1 | 1);
+				for (; j < k; j += 2) {
+					out[(*n)++] = (byte)(colors[j] | ((j+1 < k) ? colors[j+1] << 4 : 0));
+				}
+			}
+		}
+		prev_end = columns[seg-1] + 1;
+	}
+	return spans;
+}
+
+/* Streams the rows out through a small buffer, returning the encoded size */
+static int write_cells_packed(Grid *grid, FILE *output, uint64_t *data_size)
+{
+	uint32_t *columns = NULL;
+	byte *colors = NULL, *buf = NULL;
+	size_t cap = 0, buf_cap = 0, n = 0;
+	unsigned i, next_row = 0;
+	uint32_t origin = 0;
+	int e = EOF;
+
+	*data_size = 0;
+	for (i = 0; i < grid->size; i++) {
+		SparseCell *curr;
+		size_t m = 0, bound;
+		uint32_t spans;
+
+		if (!io_progress(i, grid->size)) {
+			goto error_end;
+		}
+		for (curr = grid->csr[i]; curr; curr = curr->next, m++) {
+			if (m == cap) {
+				cap = cap ? cap*2 : 256;
+				if (!(columns = realloc(columns, cap * sizeof *columns)) || !(colors = realloc(colors, cap))) {
+					goto error_end;
+				}
+			}
+			columns[m] = CSR_GET_COLUMN(curr);
+			colors[m] = (byte)CSR_GET_COLOR(curr);
+		}
+		if (!m) {
+			continue;
+		}
+
+		bound = (2 + 2*m) * LANT_VARINT_MAX + m/2 + 1;
+		if (n + bound > PACK_FLUSH_SZ) {
+			if (fwrite(buf, 1, n, output) < n) {
+				goto error_end;
+			}
+			*data_size += n, n = 0;
+		}
+		if (bound > buf_cap) {
+			buf_cap = MAX(bound, PACK_FLUSH_SZ);
+			if (!(buf = realloc(buf, buf_cap))) {
+				goto error_end;
+			}
+		}
+		spans = encode_spans(columns, colors, m, origin, NULL, NULL);
+		put_varint(buf, &n, i - next_row);
+		put_varint(buf, &n, spans);
+		encode_spans(columns, colors, m, origin, buf, &n);
+		next_row = i + 1;
+		origin = columns[0];
+	}
+	if (fwrite(buf, 1, n, output) == n) {
+		*data_size += n;
+		e = 0;
+	}
+
+error_end:
+	free(columns), free(colors), free(buf);
+	return e;
+}
+
+int save_simulation_binary(const char *filename, Simulation *sim)
+{
+	static const byte zeros[LANT_DATA_ALIGN];
+	char tmp_name[FILENAME_SZ + 8];
+	Grid *grid = sim->grid;
+	bool is_sparse = is_grid_sparse(grid);
+	LantHeader h;
+	FILE *output;
+	color_t i;
+	int e;
+
+	memset(&h, 0, sizeof h);  // Padding included, for reproducible files
+	memcpy(h.magic, LANT_MAGIC, LANT_MAGIC_SZ);
+	h.version = LANT_VERSION;
+	h.header_size = sizeof h;
+	h.byte_order = LANT_BYTE_ORDER;
+	for (i = 0; i < COLOR_COUNT; i++) {
+		h.next[i] = (uint8_t)BGR(sim->colors->next[BGR(i)]);
+		h.turn[i] = sim->colors->turn[BGR(i)];
+	}
+	h.first = put_color(sim->colors->first);
+	h.last = put_color(sim->colors->last);
+	h.def = (uint8_t)BGR(sim->colors->def);
+	h.cells_bgr = CELLS_BGR;
+	h.n = sim->colors->n;
+	h.ant_y = sim->ant->pos.y, h.ant_x = sim->ant->pos.x;
+	h.ant_dir = sim->ant->dir;
+	h.steps = sim->steps;
+	h.representation = is_sparse ? LANT_PACKED : LANT_DENSE;
+	h.def_color = (uint8_t)BGR(grid->def_color);
+	h.init_size = grid->init_size, h.size = grid->size;
+	h.colored = grid->colored;
+	h.top_left_y = grid->top_left.y, h.top_left_x = grid->top_left.x;
+	h.bottom_right_y = grid->bottom_right.y, h.bottom_right_x = grid->bottom_right.x;
+	h.data_offset = is_sparse ? sizeof h : ALIGN_UP(sizeof h, LANT_DATA_ALIGN);  // Packed cells aren't mapped
+	h.data_size = is_sparse ? 0 : (uint64_t)grid->size * grid->size;  // Packed size is known once written
+
+	snprintf(tmp_name, sizeof tmp_name, "%s.tmp", filename);
+	if (!(output = fopen(tmp_name, "wb"))) {
+		return EOF;
+	}
+	e = (fwrite(&h, sizeof h, 1, output) < 1
+	  || fwrite(zeros, 1, (size_t)h.data_offset - sizeof h, output) < h.data_offset - sizeof h)
+	  ? EOF : 0;
+	if (e != EOF) {
+		e = is_sparse ? write_cells_packed(grid, output, &h.data_size) : write_cells_dense(grid, output);
+	}
+	if (e != EOF && is_sparse) {
+		e = (fseek(output, 0, SEEK_SET) || fwrite(&h, sizeof h, 1, output) < 1) ? EOF : 0;
+	}
+	if (fclose(output) == EOF || e == EOF || replace_file(tmp_name, filename) == EOF) {
+		remove(tmp_name);
+		return EOF;
+	}
+	return 0;
+}
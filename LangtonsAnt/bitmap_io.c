@@ -3,6 +3,8 @@
 #include "io.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 /* 24-bit BGR (aka. little endian RGB) */
 const pixel_t color_map[COLOR_COUNT] = {
@@ -29,9 +31,17 @@ const pixel_t color_map[COLOR_COUNT] = {
 	[COLOR_YELLOW]  = { 0x00, 0xFF, 0xFF },
 };
 
+static void put_le(byte *p, unsigned long long value, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; i++) {
+		p[i] = (byte)(value >> 8*i);
+	}
+}
+
 static byte *init_file_header(size_t height, size_t stride)
 {
-	size_t file_size = BMP_FILE_HEADER_SZ + BMP_INFO_HEADER_SZ + stride*height;
+	size_t offset = BMP_FILE_HEADER_SZ + BMP_INFO_HEADER_SZ + BMP_PALETTE_SZ;
 	static byte file_header[] = {
 		0, 0,        // signature
 		0, 0, 0, 0,  // image file size in bytes
@@ -39,18 +49,15 @@ static byte *init_file_header(size_t height, size_t stride)
 		0, 0, 0, 0,  // start of pixel array
 	};
 
-	file_header[0]  = (byte)('B');
-	file_header[1]  = (byte)('M');
-	file_header[2]  = (byte)(file_size);
-	file_header[3]  = (byte)(file_size >> 8);
-	file_header[4]  = (byte)(file_size >> 16);
-	file_header[5]  = (byte)(file_size >> 24);
-	file_header[10] = (byte)(BMP_FILE_HEADER_SZ + BMP_INFO_HEADER_SZ);
+	file_header[0] = (byte)('B');
+	file_header[1] = (byte)('M');
+	put_le(file_header + 2,  offset + stride*height, 4);
+	put_le(file_header + 10, offset, 4);
 
 	return file_header;
 }
 
-static byte *init_info_header(size_t height, size_t width)
+static byte *init_info_header(size_t height, size_t width, size_t stride)
 {
 	static byte info_header[] = {
 		0, 0, 0, 0,  // header size
@@ -66,49 +73,62 @@ static byte *init_info_header(size_t height, size_t width)
 		0, 0, 0, 0,  // important color count
 	};
 
-	info_header[0]  = (byte)(BMP_INFO_HEADER_SZ);
-	info_header[4]  = (byte)(width);
-	info_header[5]  = (byte)(width >> 8);
-	info_header[6]  = (byte)(width >> 16);
-	info_header[7]  = (byte)(width >> 24);
-	info_header[8]  = (byte)(height);
-	info_header[9]  = (byte)(height >> 8);
-	info_header[10] = (byte)(height >> 16);
-	info_header[11] = (byte)(height >> 24);
-	info_header[12] = (byte)(1);
-	info_header[14] = (byte)(BYTES_PER_PIXEL * 8);
+	put_le(info_header + 0,  BMP_INFO_HEADER_SZ, 4);
+	put_le(info_header + 4,  width, 4);
+	put_le(info_header + 8,  height, 4);  // Positive, rows are stored bottom-up
+	put_le(info_header + 12, 1, 2);
+	put_le(info_header + 14, BMP_BITS_PER_PIXEL, 2);
+	put_le(info_header + 20, stride*height, 4);
+	put_le(info_header + 32, COLOR_COUNT, 4);
 
 	return info_header;
 }
 
-int create_bitmap_file(const char *filename, pixel_t *image, size_t height, size_t width)
+static byte *init_palette(void)
 {
-	FILE *output;
-	size_t width_in_bytes = width * BYTES_PER_PIXEL;
-	byte padding[3] = { 0, 0, 0 };
-	size_t padding_size = (4 - width_in_bytes%4) % 4;
-	size_t stride = width_in_bytes + padding_size;
-	size_t total_size = BMP_FILE_HEADER_SZ + BMP_INFO_HEADER_SZ
-	                  + height * (width_in_bytes + padding_size);
-	size_t i, e;
-
-	if (!(output = fopen(filename, "wb"))) {
-		return EOF;
+	static byte palette[BMP_PALETTE_SZ];
+	color_t c;
+	for (c = 0; c < COLOR_COUNT; c++) {
+		memcpy(palette + 4*c, color_map[c], sizeof(pixel_t));  // BGR + reserved byte
 	}
+	return palette;
+}
 
-	byte *file_header = init_file_header(height, stride);
-	e = fwrite(file_header, 1, BMP_FILE_HEADER_SZ, output);
+int create_bitmap_file(const char *filename, size_t height, size_t width,
+                       bitmap_row_func_t read_row, void *source)
+{
+	FILE *output;
+	size_t stride = BMP_STRIDE(width);
+	size_t total_size = BMP_FILE_HEADER_SZ + BMP_INFO_HEADER_SZ + BMP_PALETTE_SZ + height*stride;
+	size_t i, j, e;
+	byte *row, *packed;
 
-	byte *info_header = init_info_header(height, width);
-	e += fwrite(info_header, 1, BMP_INFO_HEADER_SZ, output);
+	if (!width || !height || (unsigned long long)total_size > BMP_MAX_FILE_SZ) {
+		return EOF;  // Size fields are 32-bit
+	}
+	row = malloc(width + 1);  // Odd widths read one padding index
+	packed = calloc(stride, 1);
+	if (!row || !packed || !(output = fopen(filename, "wb"))) {
+		free(row), free(packed);
+		return EOF;
+	}
 
-	for (i = 0; i < height; i++) {
-		e += fwrite(image + i*width, BYTES_PER_PIXEL, width, output);
-		e += fwrite(padding, 1, padding_size, output);
+	e  = fwrite(init_file_header(height, stride), 1, BMP_FILE_HEADER_SZ, output);
+	e += fwrite(init_info_header(height, width, stride), 1, BMP_INFO_HEADER_SZ, output);
+	e += fwrite(init_palette(), 1, BMP_PALETTE_SZ, output);
+
+	row[width] = 0;
+	for (i = 0; i < height && e && io_progress(i, height); i++) {
+		(*read_row)(source, (unsigned)(height-i-1), row);
+		for (j = 0; j < width; j += 2) {
+			packed[j/2] = (byte)((row[j] & 0xF) << 4 | (row[j+1] & 0xF));
+		}
+		e += fwrite(packed, 1, stride, output);
 	}
 
+	free(row), free(packed);
 	if (fclose(output) == EOF || e < total_size) {
 		return EOF;
 	}
-	return (int)e;
+	return (int)MIN(e, INT_MAX);
 }
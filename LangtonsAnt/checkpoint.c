@@ -0,0 +1,764 @@
+#include "io.h"
+#include "thread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#	define JOURNAL_MODE  "wbc"  // Commit flag, fflush goes all the way to disk
+#else
+#	include <unistd.h>
+#	define JOURNAL_MODE  "wb"
+#endif
+
+/** Keeps tile coordinates positive so they can be packed into a nonzero key */
+#define KEY_BIAS        (1 << 30)
+#define TILE_KEY(y, x)  ((uint64_t)((unsigned)((y) + KEY_BIAS) >> CHECKPOINT_TILE_SHIFT) << 32 \
+                        | (unsigned)((x) + KEY_BIAS) >> CHECKPOINT_TILE_SHIFT)
+#define KEY_TILE_Y(k)   ((int)((k) >> 32) - (KEY_BIAS >> CHECKPOINT_TILE_SHIFT))
+#define KEY_TILE_X(k)   ((int)((k) & 0xFFFFFFFFU) - (KEY_BIAS >> CHECKPOINT_TILE_SHIFT))
+
+#define TILE_BYTES      (CHECKPOINT_TILE_SIDE * CHECKPOINT_TILE_SIDE / 2)
+#define JOURNAL_NAME_SZ (FILENAME_SZ + 16)
+
+Checkpoint *active_checkpoint;
+
+/** Header at the start of a journal file, records follow until the first torn one */
+typedef struct journal_header {
+	char      magic[CHECKPOINT_MAGIC_SZ];
+	uint16_t  version, header_size;
+	uint32_t  byte_order;
+	uint32_t  base_steps;  /**< Steps of the snapshot the journal continues */
+} JournalHeader;
+
+/** Color rules, which can be edited without starting over */
+typedef struct journal_rules {
+	uint8_t   next[COLOR_COUNT];
+	int8_t    turn[COLOR_COUNT];
+	int8_t    first, last;       /**< COLOR_NONE while there are no colors */
+	uint8_t   reserved[2];
+	uint32_t  n;
+} JournalRules;
+
+/**
+ * State after a batch of steps, followed by tile_count tiles that changed
+ * Coordinates are relative to the grid center, which survives expansion
+ */
+typedef struct journal_record {
+	uint32_t  record_size;  /**< Including this header */
+	uint32_t  checksum;     /**< Of everything after this field */
+	uint32_t  steps, grid_size, colored, tile_count;
+	int32_t   ant_y, ant_x;
+	uint32_t  ant_dir;
+	int32_t   top_left_y, top_left_x, bottom_right_y, bottom_right_x;
+	uint8_t   is_sparse, reserved[3];
+	JournalRules  rules;
+} JournalRecord;
+
+/** Tile of cells, row after row, two per byte (low nibble first) */
+typedef struct journal_tile {
+	int32_t  ty, tx;
+	byte     cells[TILE_BYTES];
+} JournalTile;
+
+typedef enum {
+	ITEM_RECORD,  /**< Append data to the open journal */
+	ITEM_OPEN,    /**< Start a journal anew */
+	ITEM_REMOVE,  /**< Delete a journal no snapshot depends on any more */
+	ITEM_BIND     /**< Put the first snapshot of a simulation in place, and start journal 0 */
+} ItemKind;
+
+typedef struct journal_item {
+	struct journal_item  *next;
+	ItemKind              kind;
+	unsigned              journal;
+	uint32_t              base_steps;
+	bool                  remove_first;  /**< Are the journals removed before the snapshot goes in place? */
+	size_t                size;
+	byte                  data[];
+} JournalItem;
+
+struct checkpoint {
+	char          filename[FILENAME_SZ];
+
+	/* Tiles changed since the last record (open addressing, 0 is empty) */
+	uint64_t     *tiles;
+	size_t        tile_cap, tile_count;
+	uint64_t      last_key;
+	uint32_t      record_steps;   /**< Steps in the last record */
+	JournalRules  rules;          /**< Rules in the last record */
+
+	long long     next_record, next_snapshot;
+	size_t        journaled;      /**< Record bytes since the last snapshot started */
+	SaveJob      *snapshot;       /**< Snapshot being written, if any */
+	unsigned      journal;        /**< Journal records go to (0 or 1) */
+	bool          other_in_use;   /**< Is the other journal needed by the last good snapshot? */
+	bool          binding;        /**< Is there no snapshot of the simulation yet, nor a journal? */
+	bool          remove_first;   /**< Do the journals go before its first snapshot takes their place? */
+	uint32_t      bind_steps;     /**< Steps in its first snapshot */
+
+	/* Writer thread */
+	JournalItem  *head, *tail;
+	bool          busy, closing, failed;
+	bool          unbound;        /**< Did a first snapshot not go in place? Cleared as the engine binds again */
+	FILE         *output;
+	unsigned      output_journal;
+	bool          orphaned;       /**< Is the simulation's first snapshot not in place? Its journals are dropped */
+	mutex_t       lock;
+	cond_t        cond;
+	thread_t      thread;
+};
+
+static void journal_name(char *name, const char *filename, unsigned journal)
+{
+	snprintf(name, JOURNAL_NAME_SZ, "%s.journal-%u", filename, journal);
+}
+
+static void bind_name(char *name, const char *filename)
+{
+	snprintf(name, JOURNAL_NAME_SZ, "%s.bind", filename);
+}
+
+static uint32_t checksum(const byte *data, size_t n)
+{
+	uint32_t h = 2166136261U;  // FNV-1a
+	while (n--) {
+		h = (h ^ *data++) * 16777619U;
+	}
+	return h;
+}
+
+/*---------------------------------- Writer ----------------------------------*/
+
+static bool sync_output(FILE *output)
+{
+	if (fflush(output) == EOF) {
+		return false;
+	}
+#ifndef _WIN32
+	return fsync(fileno(output)) == 0;
+#else
+	return true;
+#endif
+}
+
+static void close_output(Checkpoint *cp)
+{
+	if (cp->output) {
+		fclose(cp->output);
+		cp->output = NULL;
+	}
+}
+
+static bool open_output(Checkpoint *cp, unsigned journal, uint32_t base_steps)
+{
+	char name[JOURNAL_NAME_SZ];
+	JournalHeader h;
+
+	close_output(cp);
+	journal_name(name, cp->filename, journal);
+	if (!(cp->output = fopen(name, JOURNAL_MODE))) {
+		return false;
+	}
+	cp->output_journal = journal;
+	memset(&h, 0, sizeof h);
+	memcpy(h.magic, CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_SZ);
+	h.version = CHECKPOINT_VERSION;
+	h.header_size = sizeof h;
+	h.byte_order = LANT_BYTE_ORDER;
+	h.base_steps = base_steps;
+	return fwrite(&h, sizeof h, 1, cp->output) == 1 && sync_output(cp->output);
+}
+
+static void remove_journal(Checkpoint *cp, unsigned journal)
+{
+	char name[JOURNAL_NAME_SZ];
+
+	if (cp->output_journal == journal) {
+		close_output(cp);
+	}
+	journal_name(name, cp->filename, journal);
+	remove(name);
+}
+
+/* No journal is open unless the snapshot went in place, so records never land on another one */
+static bool put_snapshot(Checkpoint *cp, const JournalItem *item)
+{
+	char name[JOURNAL_NAME_SZ];
+
+	close_output(cp);
+	if (item->remove_first) {  // They are of another simulation, and must not be replayed onto this one
+		remove_journal(cp, 0);
+		remove_journal(cp, 1);
+	}
+	bind_name(name, cp->filename);
+	if (replace_file(name, cp->filename) == EOF) {
+		remove(name);
+		return false;
+	}
+	if (!item->remove_first) {  // They are of this one, and only hold steps the snapshot has
+		remove_journal(cp, 0);
+		remove_journal(cp, 1);
+	}
+	return open_output(cp, 0, item->base_steps);
+}
+
+static bool process_item(Checkpoint *cp, JournalItem *item, bool more)
+{
+	if (cp->orphaned && (item->kind == ITEM_RECORD || item->kind == ITEM_OPEN)) {
+		return false;  // They would be replayed onto another simulation's snapshot
+	}
+	switch (item->kind) {
+	case ITEM_RECORD:
+		return cp->output && fwrite(item->data, 1, item->size, cp->output) == item->size
+		    && (more || sync_output(cp->output));  // Sync once per batch
+	case ITEM_OPEN:
+		return open_output(cp, item->journal, item->base_steps);
+	case ITEM_REMOVE:
+		remove_journal(cp, item->journal);
+		return true;
+	case ITEM_BIND:
+		cp->orphaned = !put_snapshot(cp, item);
+		return !cp->orphaned;
+	}
+	return false;
+}
+
+static void *journal_writer(void *arg)
+{
+	Checkpoint *cp = arg;
+	JournalItem *item;
+	ItemKind kind;
+	bool ok, more;
+
+	mutex_lock(&cp->lock);
+	while (true) {
+		while (!cp->head && !cp->closing) {
+			cond_wait(&cp->cond, &cp->lock);
+		}
+		if (!(item = cp->head)) {
+			break;  // Closing and drained
+		}
+		if (!(cp->head = item->next)) {
+			cp->tail = NULL;
+		}
+		more = cp->head != NULL;
+		cp->busy = true;
+		mutex_unlock(&cp->lock);
+
+		ok = process_item(cp, item, more);
+		kind = item->kind;
+		free(item);
+
+		mutex_lock(&cp->lock);
+		cp->failed |= !ok;
+		cp->unbound |= !ok && kind == ITEM_BIND;
+		cp->busy = false;
+		cond_broadcast(&cp->cond);
+	}
+	if (cp->output) {
+		cp->failed |= !sync_output(cp->output) | (fclose(cp->output) == EOF);
+		cp->output = NULL;
+	}
+	mutex_unlock(&cp->lock);
+	return NULL;
+}
+
+static JournalItem *new_item(ItemKind kind, unsigned journal, size_t size)
+{
+	JournalItem *item = malloc(sizeof(JournalItem) + size);
+	if (item) {
+		item->next = NULL;
+		item->kind = kind;
+		item->journal = journal;
+		item->base_steps = 0;
+		item->remove_first = false;
+		item->size = size;
+	}
+	return item;
+}
+
+static void enqueue(Checkpoint *cp, JournalItem *item)
+{
+	mutex_lock(&cp->lock);
+	if (!item) {
+		cp->failed = true;  // Out of memory, this change is lost
+	} else if (cp->tail) {
+		cp->tail->next = item;
+	} else {
+		cp->head = item;
+	}
+	if (item) {
+		cp->tail = item;
+		cond_broadcast(&cp->cond);
+	}
+	mutex_unlock(&cp->lock);
+}
+
+static void wait_idle(Checkpoint *cp)
+{
+	mutex_lock(&cp->lock);
+	while (cp->head || cp->busy) {
+		cond_wait(&cp->cond, &cp->lock);
+	}
+	mutex_unlock(&cp->lock);
+}
+
+static bool take_unbound(Checkpoint *cp)
+{
+	bool unbound;
+	mutex_lock(&cp->lock);
+	unbound = cp->unbound;
+	cp->unbound = false;
+	mutex_unlock(&cp->lock);
+	return unbound;
+}
+
+static void open_journal(Checkpoint *cp, unsigned journal, uint32_t base_steps)
+{
+	JournalItem *item = new_item(ITEM_OPEN, journal, 0);
+	if (item) {
+		item->base_steps = base_steps;
+	}
+	enqueue(cp, item);
+}
+
+/*------------------------------- Dirty tiles --------------------------------*/
+
+static void add_tile(Checkpoint *cp, uint64_t key)
+{
+	size_t i;
+
+	if (2*(cp->tile_count+1) > cp->tile_cap) {
+		uint64_t *old = cp->tiles;
+		size_t old_cap = cp->tile_cap, j;
+		cp->tile_cap = old_cap ? old_cap*2 : 1024;
+		if (!(cp->tiles = calloc(cp->tile_cap, sizeof(uint64_t)))) {
+			cp->tiles = old, cp->tile_cap = old_cap;
+			return;  // Next record misses this tile, the next snapshot fixes it
+		}
+		cp->tile_count = 0;
+		for (j = 0; j < old_cap; j++) {
+			if (old[j]) {
+				add_tile(cp, old[j]);
+			}
+		}
+		free(old);
+	}
+	for (i = (size_t)(key * 0x9E3779B97F4A7C15ULL >> 40) & (cp->tile_cap-1); cp->tiles[i];
+	     i = (i+1) & (cp->tile_cap-1)) {
+		if (cp->tiles[i] == key) {
+			return;
+		}
+	}
+	cp->tiles[i] = key;
+	cp->tile_count++;
+}
+
+static void clear_tiles(Checkpoint *cp)
+{
+	if (cp->tile_count) {
+		memset(cp->tiles, 0, cp->tile_cap * sizeof(uint64_t));
+		cp->tile_count = 0;
+	}
+	cp->last_key = 0;
+}
+
+void checkpoint_mark(Checkpoint *cp, Simulation *sim)
+{
+	int center = (int)(sim->grid->size / 2);
+	uint64_t key = TILE_KEY(sim->ant->pos.y - center, sim->ant->pos.x - center);
+	if (key != cp->last_key) {  // Usually still in the same tile
+		cp->last_key = key;
+		add_tile(cp, key);
+	}
+}
+
+static void get_rules(JournalRules *rules, Colors *colors)
+{
+	color_t i;
+
+	memset(rules, 0, sizeof *rules);
+	for (i = 0; i < COLOR_COUNT; i++) {
+		rules->next[i] = (uint8_t)colors->next[i];
+		rules->turn[i] = colors->turn[i];
+	}
+	rules->first = (int8_t)colors->first, rules->last = (int8_t)colors->last;
+	rules->n = colors->n;
+}
+
+/* Packs the changed tiles and the ant's state into a record for the writer */
+static void write_record(Checkpoint *cp, Simulation *sim)
+{
+	Grid *grid = sim->grid;
+	int center = (int)(grid->size / 2);
+	byte row[CHECKPOINT_TILE_SIDE];
+	JournalRecord *r;
+	JournalTile *t;
+	JournalItem *item;
+	JournalRules rules;
+	size_t size, i;
+	unsigned y, x;
+
+	get_rules(&rules, sim->colors);
+	if (!cp->tile_count && sim->steps == cp->record_steps && !memcmp(&rules, &cp->rules, sizeof rules)) {
+		return;  // Nothing happened
+	}
+	size = sizeof(JournalRecord) + cp->tile_count * sizeof(JournalTile);
+	if (!(item = new_item(ITEM_RECORD, cp->journal, size))) {
+		enqueue(cp, NULL);
+		return;
+	}
+	r = (JournalRecord *)item->data;
+	memset(r, 0, sizeof *r);
+	r->record_size = (uint32_t)size;
+	r->steps = sim->steps;
+	r->grid_size = grid->size;
+	r->colored = grid->colored;
+	r->tile_count = (uint32_t)cp->tile_count;
+	r->ant_y = sim->ant->pos.y - center, r->ant_x = sim->ant->pos.x - center;
+	r->ant_dir = sim->ant->dir;
+	r->top_left_y = grid->top_left.y - center, r->top_left_x = grid->top_left.x - center;
+	r->bottom_right_y = grid->bottom_right.y - center, r->bottom_right_x = grid->bottom_right.x - center;
+	r->is_sparse = is_grid_sparse(grid);
+	r->rules = cp->rules = rules;
+
+	for (i = 0, t = (JournalTile *)(r + 1); i < cp->tile_cap; i++) {
+		uint64_t key = cp->tiles[i];
+		if (!key) {
+			continue;
+		}
+		t->ty = KEY_TILE_Y(key), t->tx = KEY_TILE_X(key);
+		for (y = 0; y < CHECKPOINT_TILE_SIDE; y++) {
+			byte *cells = t->cells + y*CHECKPOINT_TILE_SIDE/2;
+			grid_read_row(grid, center + t->ty*(int)CHECKPOINT_TILE_SIDE + (int)y,
+			              center + t->tx*(int)CHECKPOINT_TILE_SIDE, CHECKPOINT_TILE_SIDE, row);
+			for (x = 0; x < CHECKPOINT_TILE_SIDE; x += 2) {
+				cells[x/2] = (byte)(row[x] | row[x+1] << 4);
+			}
+		}
+		t++;
+	}
+	r->checksum = checksum(item->data + 2*sizeof(uint32_t), size - 2*sizeof(uint32_t));
+
+	enqueue(cp, item);
+	clear_tiles(cp);
+	cp->record_steps = sim->steps;
+	cp->journaled += size;
+}
+
+/*-------------------------------- Snapshots ---------------------------------*/
+
+static void start_snapshot(Checkpoint *cp, Simulation *sim, long long now_us)
+{
+	char name[JOURNAL_NAME_SZ];
+
+	if (cp->binding) {  // Written aside, the file and journals on disk still go together
+		bind_name(name, cp->filename);
+		clear_tiles(cp);  // The first record after it has every change since
+		cp->bind_steps = sim->steps;
+		cp->snapshot = save_job_start(name, sim, false, false);
+	} else {
+		if (!cp->other_in_use) {  // Records up to here are in the current journal
+			cp->journal ^= 1;
+			open_journal(cp, cp->journal, sim->steps);
+			cp->other_in_use = true;
+		}
+		cp->snapshot = save_job_start(cp->filename, sim, false, false);
+	}
+	cp->journaled = 0;
+	cp->next_snapshot = now_us + CHECKPOINT_SNAPSHOT_US;
+}
+
+/* Has the writer replace the file and journals on disk with the first snapshot and a journal for it */
+static void finish_bind(Checkpoint *cp)
+{
+	JournalItem *item = new_item(ITEM_BIND, 0, 0);
+
+	if (!item) {
+		cp->failed = true;  // Tried again with the next snapshot
+		return;
+	}
+	item->base_steps = cp->bind_steps;
+	item->remove_first = cp->remove_first;
+	enqueue(cp, item);
+	cp->binding = false;
+	cp->journal = 0;
+	cp->other_in_use = false;
+}
+
+static void finish_snapshot(Checkpoint *cp, JobResult result)
+{
+	cp->snapshot = NULL;
+	if (result != JOB_DONE) {
+		return;
+	}
+	if (cp->binding) {
+		finish_bind(cp);
+	} else {
+		enqueue(cp, new_item(ITEM_REMOVE, cp->journal ^ 1, 0));
+		cp->other_in_use = false;
+	}
+}
+
+/* Starts over with a background snapshot, journaling from when it is in place */
+static void bind(Checkpoint *cp, Simulation *sim, bool remove_first, long long now_us)
+{
+	if (cp->snapshot) {  // Of the previous simulation, which is of no use any more
+		save_job_cancel(cp->snapshot);
+		if (cp->binding) {
+			save_job_wait(cp->snapshot);
+			cp->snapshot = NULL;
+		} else {
+			finish_snapshot(cp, save_job_wait(cp->snapshot));
+		}
+	}
+	sim->checkpoint = cp;
+	cp->binding = true;
+	cp->remove_first = remove_first;
+	start_snapshot(cp, sim, now_us);
+
+	cp->record_steps = sim->steps;
+	get_rules(&cp->rules, sim->colors);
+	cp->next_record = now_us + CHECKPOINT_JOURNAL_US;
+}
+
+Checkpoint *checkpoint_start(const char *filename, Simulation *sim)
+{
+	Checkpoint *cp;
+
+	if (strlen(filename) + sizeof ".bind" > FILENAME_SZ || !(cp = calloc(1, sizeof(Checkpoint)))) {
+		return NULL;
+	}
+	strcpy(cp->filename, filename);
+	mutex_init(&cp->lock);
+	cond_init(&cp->cond);
+	if (!thread_create(&cp->thread, journal_writer, cp)) {
+		mutex_destroy(&cp->lock);
+		cond_destroy(&cp->cond);
+		free(cp);
+		return NULL;
+	}
+
+	/* Journals are either of this simulation (restored) or stale (see checkpoint_restore) */
+	bind(cp, sim, false, 0);
+	if (cp->snapshot) {
+		finish_snapshot(cp, save_job_wait(cp->snapshot));
+	}
+	wait_idle(cp);
+	if (cp->failed || cp->binding) {
+		sim->checkpoint = NULL;
+		checkpoint_stop(cp, sim);
+		return NULL;
+	}
+	return cp;
+}
+
+void checkpoint_poll(Checkpoint *cp, Simulation *sim, long long now_us)
+{
+	if (sim->checkpoint != cp) {
+		bind(cp, sim, true, now_us);  // Simulation was replaced
+		return;
+	}
+	if (now_us < cp->next_record) {
+		return;
+	}
+	cp->next_record = now_us + CHECKPOINT_JOURNAL_US;
+	if (take_unbound(cp)) {
+		bind(cp, sim, true, now_us);  // The writer could not put the first snapshot in place
+		return;
+	}
+	if (!cp->binding) {
+		write_record(cp, sim);
+	}
+
+	if (cp->snapshot) {
+		JobResult result = save_job_poll(cp->snapshot);
+		if (result != JOB_RUNNING) {
+			finish_snapshot(cp, result);
+		}
+	}
+	if (!cp->snapshot && (now_us >= cp->next_snapshot || cp->journaled >= CHECKPOINT_JOURNAL_SZ)) {
+		start_snapshot(cp, sim, now_us);
+	}
+}
+
+int checkpoint_stop(Checkpoint *cp, Simulation *sim)
+{
+	bool ok;
+
+	if (cp->snapshot) {
+		finish_snapshot(cp, save_job_wait(cp->snapshot));
+	}
+	if (sim->checkpoint == cp) {
+		if (!cp->binding) {
+			write_record(cp, sim);
+		}
+		sim->checkpoint = NULL;
+	}
+	cp->failed |= cp->binding;  // The simulation never made it to disk
+	mutex_lock(&cp->lock);
+	cp->closing = true;
+	cond_broadcast(&cp->cond);
+	mutex_unlock(&cp->lock);
+	thread_join(cp->thread);
+
+	ok = !cp->failed;
+	mutex_destroy(&cp->lock);
+	cond_destroy(&cp->cond);
+	free(cp->tiles);
+	free(cp);
+	return ok ? 0 : EOF;
+}
+
+/*--------------------------------- Restore ----------------------------------*/
+
+static void set_row_cells(Grid *grid, int y, int x0, const byte *cells)
+{
+	SparseCell **t = is_grid_sparse(grid) ? &grid->csr[y] : NULL;
+	int x;
+
+	for (x = MAX(x0, 0); x < x0 + (int)CHECKPOINT_TILE_SIDE && x < (int)grid->size; x++) {
+		byte color = (cells[(x-x0)/2] >> ((x-x0)%2 * 4)) & 0xF;
+		if (!t) {
+			grid->c[y][x] = color;
+			continue;
+		}
+		while (*t && CSR_GET_COLUMN(*t) < (unsigned)x) {
+			t = &(*t)->next;
+		}
+		if (*t && CSR_GET_COLUMN(*t) == (unsigned)x) {
+			CSR_SET_COLOR(*t, color);
+		} else if (color != grid->def_color) {
+			sparse_prepend(t, x, color);
+		}
+	}
+}
+
+static bool set_rules(Colors *colors, const JournalRules *rules)
+{
+	color_t i;
+
+	for (i = 0; i < COLOR_COUNT; i++) {
+		if (rules->next[i] >= COLOR_COUNT || abs(rules->turn[i]) > 1) {
+			return false;
+		}
+	}
+	if (rules->first < COLOR_NONE || rules->first >= COLOR_COUNT
+	 || rules->last < COLOR_NONE || rules->last >= COLOR_COUNT || rules->n > COLOR_COUNT) {
+		return false;
+	}
+	for (i = 0; i < COLOR_COUNT; i++) {
+		colors->next[i] = rules->next[i];
+		colors->turn[i] = rules->turn[i];
+	}
+	colors->first = rules->first, colors->last = rules->last;
+	colors->n = rules->n;
+	return true;
+}
+
+static bool apply_record(Simulation *sim, const JournalRecord *r)
+{
+	const JournalTile *t = (const JournalTile *)(r + 1);
+	Grid *grid = sim->grid;
+	int center, y;
+	uint32_t i;
+
+	if (r->grid_size < grid->size || r->ant_dir > DIR_LEFT || !set_rules(sim->colors, &r->rules)) {
+		return false;
+	}
+	if (r->is_sparse && !is_grid_sparse(grid)) {
+		grid_make_sparse(grid);  // First, expanding it densely up to the record's size may not fit in memory
+	}
+	while (grid->size < r->grid_size) {
+		grid_expand(grid, sim->ant);
+	}
+	if (grid->size != r->grid_size) {
+		return false;
+	}
+
+	center = (int)(grid->size / 2);
+	for (i = 0; i < r->tile_count; i++, t++) {
+		int y0 = center + t->ty*(int)CHECKPOINT_TILE_SIDE, x0 = center + t->tx*(int)CHECKPOINT_TILE_SIDE;
+		for (y = MAX(y0, 0); y < y0 + (int)CHECKPOINT_TILE_SIDE && y < (int)grid->size; y++) {
+			set_row_cells(grid, y, x0, t->cells + (y-y0)*CHECKPOINT_TILE_SIDE/2);
+		}
+	}
+	sim->ant->pos.y = r->ant_y + center, sim->ant->pos.x = r->ant_x + center;
+	sim->ant->dir = (Direction)r->ant_dir;
+	sim->steps = r->steps;
+	grid->colored = r->colored;
+	grid->top_left.y = r->top_left_y + center, grid->top_left.x = r->top_left_x + center;
+	grid->bottom_right.y = r->bottom_right_y + center, grid->bottom_right.x = r->bottom_right_x + center;
+	return true;
+}
+
+/* Applies records newer than the simulation until the first torn or corrupt one */
+static void replay_journal(Simulation *sim, FILE *input)
+{
+	JournalRecord *r = NULL, h;
+
+	while (fread(&h, sizeof h, 1, input) == 1) {
+		size_t size = h.record_size;
+		if (h.tile_count > (UINT32_MAX - sizeof h) / sizeof(JournalTile)
+		 || size != sizeof h + (size_t)h.tile_count * sizeof(JournalTile)) {
+			break;
+		}
+		free(r);
+		if (!(r = malloc(size))) {
+			break;
+		}
+		*r = h;
+		if (fread(r+1, 1, size - sizeof h, input) != size - sizeof h
+		 || checksum((byte *)r + 2*sizeof(uint32_t), size - 2*sizeof(uint32_t)) != r->checksum) {
+			break;
+		}
+		if (r->steps > sim->steps && !apply_record(sim, r)) {
+			break;
+		}
+	}
+	free(r);
+}
+
+Simulation *checkpoint_restore(const char *filename)
+{
+	char names[2][JOURNAL_NAME_SZ], bind_file[JOURNAL_NAME_SZ];
+	FILE *inputs[2];
+	uint32_t bases[2];
+	Simulation *sim;
+	unsigned i;
+
+	if (strlen(filename) >= FILENAME_SZ) {
+		return NULL;
+	}
+	for (i = 0; i < 2; i++) {
+		journal_name(names[i], filename, i);
+	}
+	bind_name(bind_file, filename);
+	remove(bind_file);  // First snapshot of a simulation that never got journaled
+	if (!(sim = load_simulation(filename))) {
+		remove(names[0]), remove(names[1]);  // Nothing to replay them onto
+		return NULL;
+	}
+
+	for (i = 0; i < 2; i++) {
+		JournalHeader h;
+		if ((inputs[i] = fopen(names[i], "rb"))
+		 && (fread(&h, sizeof h, 1, inputs[i]) < 1 || memcmp(h.magic, CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_SZ)
+		  || h.version != CHECKPOINT_VERSION || h.header_size != sizeof h
+		  || h.byte_order != LANT_BYTE_ORDER)) {
+			fclose(inputs[i]);
+			inputs[i] = NULL;
+		}
+		bases[i] = inputs[i] ? h.base_steps : 0;
+	}
+	for (i = 0; i < 2; i++) {
+		unsigned j = (inputs[0] && inputs[1] && bases[1] < bases[0]) ? 1-i : i;  // Older first
+		if (inputs[j]) {
+			replay_journal(sim, inputs[j]);
+			fclose(inputs[j]);
+		}
+	}
+	return sim;
+}
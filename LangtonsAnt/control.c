@@ -0,0 +1,613 @@
+#include "graphics.h"
+#include "thread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+Control *active_control;
+
+#ifndef _WIN32
+#	include <errno.h>
+#	include <fcntl.h>
+#	include <poll.h>
+#	include <sys/socket.h>
+#	include <sys/stat.h>
+#	include <sys/un.h>
+#	include <time.h>
+#	include <unistd.h>
+
+#ifdef MSG_NOSIGNAL
+#	define SEND_FLAGS  MSG_NOSIGNAL  // A client hanging up mustn't kill the program with SIGPIPE
+#else
+#	define SEND_FLAGS  0             // SO_NOSIGPIPE is set on the socket instead
+#endif
+
+#define TELEMETRY_PERIOD_MS  (1000U / CONTROL_TELEMETRY_HZ)
+#define REPLY_SZ             128U
+#define TELEMETRY_SZ         512U
+
+typedef struct client {
+	int            fd;        /**< -1 if the slot is free */
+	unsigned long  id;
+	char           in[CONTROL_LINE_MAX];
+	size_t         in_len;
+	bool           overlong;  /**< Discarding the rest of a line that didn't fit */
+	char          *out;       /**< Output not sent yet, CONTROL_OUT_BUF_SZ bytes */
+	size_t         out_len;
+	unsigned long  skipped;   /**< Telemetry lines that didn't fit since the last one that did */
+} Client;
+
+typedef struct reply {
+	unsigned long  client;
+	char           line[REPLY_SZ];
+} Reply;
+
+struct control {
+	char            path[sizeof(((struct sockaddr_un *)NULL)->sun_path)];
+	int             listen_fd;
+	int             wake_pipe[2];
+	thread_t        thread;
+
+	mutex_t         lock;                         /**< Guards everything up to the clients */
+	bool            stopping;
+	bool            idle;                         /**< Server waiting for a publish to wake it */
+	Telemetry       tel;
+	unsigned long   tel_seq;                      /**< Bumped by every publish */
+	ControlCommand  commands[CONTROL_QUEUE_LEN];  /**< Waiting for the main loop */
+	unsigned        cmd_head, cmd_count;
+	Reply           replies[CONTROL_QUEUE_LEN];   /**< Waiting for the server thread */
+	unsigned        reply_head, reply_count;
+	unsigned        outstanding;                  /**< Commands taken in whose reply isn't out yet */
+
+	/* Only used by the server thread */
+	Client          clients[CONTROL_MAX_CLIENTS];
+	unsigned long   next_id, sent_seq;
+};
+
+static const char *command_names[] = { "pause", "run", "speed", "load", "save" };
+static const char *status_names[] = { "none", "success", "failure", "pending" };
+
+static long long now_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000LL + ts.tv_nsec / 1000000;
+}
+
+static void set_nonblocking(int fd)
+{
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+	fcntl(fd, F_SETFD, FD_CLOEXEC);
+}
+
+static void wake_server(Control *ctl)
+{
+	char c = 0;
+	if (write(ctl->wake_pipe[1], &c, 1) < 0) {
+		return;  // Full, so a wakeup is pending anyway
+	}
+}
+
+/*------------------------------- JSON helpers -------------------------------*/
+
+/* Finds the value of a top-level "key", good enough for the flat objects taken as commands */
+static const char *json_value(const char *line, const char *key)
+{
+	size_t n = strlen(key);
+	const char *p;
+
+	for (p = strchr(line, '"'); p; p = strchr(p + 1, '"')) {
+		if (!strncmp(p + 1, key, n) && p[n+1] == '"') {
+			p += n + 2;
+			p += strspn(p, " \t\r");
+			if (*p == ':') {
+				return p + 1 + strspn(p + 1, " \t\r");
+			}
+		}
+	}
+	return NULL;
+}
+
+/* Reads a string value, false if it isn't one, doesn't fit or has characters outside ASCII */
+static bool json_string(const char *p, char *out, size_t size)
+{
+	size_t n = 0;
+	unsigned u;
+
+	if (!p || *p++ != '"') {
+		return false;
+	}
+	for (; *p && *p != '"'; p++) {
+		char c = *p;
+		if (c == '\\') {
+			switch (*++p) {
+			case '"': case '\\': case '/': c = *p;   break;
+			case 'n':                      c = '\n'; break;
+			case 't':                      c = '\t'; break;
+			case 'r':                      c = '\r'; break;
+			case 'u':
+				if (strspn(p + 1, "0123456789abcdefABCDEF") < 4  // Or p would skip the end of the line
+				 || sscanf(p + 1, "%4x", &u) != 1 || !u || u > 0x7F) {
+					return false;
+				}
+				c = (char)u, p += 4;
+				break;
+			default:
+				return false;
+			}
+		}
+		if (n + 1 >= size) {
+			return false;
+		}
+		out[n++] = c;
+	}
+	out[n] = '\0';
+	return *p == '"';
+}
+
+static void json_escape(char *out, size_t size, const char *str)
+{
+	size_t n = 0;
+	for (; *str && n + 3 < size; str++) {
+		if (*str == '"' || *str == '\\') {
+			out[n++] = '\\';
+		}
+		out[n++] = ((unsigned char)*str < ' ') ? ' ' : *str;
+	}
+	out[n] = '\0';
+}
+
+/*--------------------------------- Messages ---------------------------------*/
+
+static int format_telemetry(char *buf, const Telemetry *t, unsigned long skipped)
+{
+	char bbox[96] = "null";
+	if (t->colored) {
+		snprintf(bbox, sizeof bbox, "{\"top\":%d,\"left\":%d,\"bottom\":%d,\"right\":%d}",
+		         t->top_left.y, t->top_left.x, t->bottom_right.y, t->bottom_right.x);
+	}
+	return snprintf(buf, TELEMETRY_SZ,
+	                "{\"steps\":%u,\"rate\":%u,\"speed\":%u,\"running\":%s,"
+	                "\"grid_size\":%u,\"sparse\":%s,\"colored\":%u,\"bbox\":%s,"
+	                "\"frame_ms\":%.2f,\"draw_ms\":%.2f,"
+	                "\"load\":{\"status\":\"%s\",\"progress\":%.3f},"
+	                "\"save\":{\"status\":\"%s\",\"progress\":%.3f},\"skipped\":%lu}\n",
+	                t->steps, t->rate, t->speed, t->running ? "true" : "false",
+	                t->grid_size, t->sparse ? "true" : "false", t->colored, bbox,
+	                t->frame_ms, t->draw_ms,
+	                status_names[t->load_status], t->load_progress / 1e3,
+	                status_names[t->save_status], t->save_progress / 1e3, skipped);
+}
+
+static void format_reply(char *buf, const char *name, const ControlCommand *cmd, const char *error)
+{
+	char quoted[24] = "null", id[32] = "", err[80] = "", escaped[64];
+
+	if (name) {
+		snprintf(quoted, sizeof quoted, "\"%s\"", name);
+	}
+	if (cmd->has_id) {
+		snprintf(id, sizeof id, ",\"id\":%ld", cmd->id);
+	}
+	if (error) {
+		json_escape(escaped, sizeof escaped, error);
+		snprintf(err, sizeof err, ",\"error\":\"%s\"", escaped);
+	}
+	snprintf(buf, REPLY_SZ, "{\"reply\":%s%s,\"ok\":%s%s}\n", quoted, id, error ? "false" : "true", err);
+}
+
+/* Parses a command line, returns what's wrong with it or NULL, setting name if the command was known */
+static const char *parse_command(const char *line, ControlCommand *cmd, const char **name)
+{
+	char word[16];
+	const char *p;
+	char *end;
+	unsigned long ul;
+	size_t i;
+
+	*name = NULL;
+	if ((p = json_value(line, "id")) && (cmd->id = strtol(p, &end, 10), end != p)) {
+		cmd->has_id = true;
+	}
+	if (!json_string(json_value(line, "cmd"), word, sizeof word)) {
+		return "expected {\"cmd\": \"...\"}";
+	}
+	for (i = 0; i < LEN(command_names) && strcmp(word, command_names[i]); i++);
+	if (i == LEN(command_names)) {
+		return "unknown command";
+	}
+	cmd->type = (ControlCommandType)i;
+	*name = command_names[i];
+
+	switch (cmd->type) {
+	case CONTROL_SPEED:
+		if (!(p = json_value(line, "value")) || (ul = strtoul(p, &end, 10), end == p) || ul > UINT_MAX) {
+			return "expected a \"value\"";
+		}
+		cmd->value = (unsigned)ul;
+		break;
+	case CONTROL_LOAD:
+	case CONTROL_SAVE:
+		if (!json_string(json_value(line, "file"), cmd->arg, sizeof cmd->arg) || !*cmd->arg) {
+			return "expected a \"file\"";
+		}
+		break;
+	default:
+		break;
+	}
+	return NULL;
+}
+
+/*---------------------------------- Clients ---------------------------------*/
+
+static bool queue_output(Client *c, const char *data, size_t len)
+{
+	if (c->out_len + len > CONTROL_OUT_BUF_SZ) {
+		return false;
+	}
+	memcpy(c->out + c->out_len, data, len);
+	c->out_len += len;
+	return true;
+}
+
+static void drop_client(Client *c)
+{
+	close(c->fd);
+	free(c->out);
+	memset(c, 0, sizeof *c);
+	c->fd = -1;
+}
+
+static void send_telemetry(Client *c, const Telemetry *tel)
+{
+	char line[TELEMETRY_SZ];
+	int len = format_telemetry(line, tel, c->skipped);
+	if (queue_output(c, line, (size_t)len)) {
+		c->skipped = 0;
+	} else {
+		c->skipped++;  // Reading too slowly, it'll only get the lines it has room for
+	}
+}
+
+static void accept_clients(Control *ctl)
+{
+	Telemetry tel;
+	int fd;
+	size_t i;
+
+	while ((fd = accept(ctl->listen_fd, NULL, NULL)) >= 0) {
+		Client *c = NULL;
+#ifdef SO_NOSIGPIPE
+		int one = 1;
+		setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof one);
+#endif
+		set_nonblocking(fd);
+		for (i = 0; i < CONTROL_MAX_CLIENTS && !c; i++) {
+			c = (ctl->clients[i].fd < 0) ? &ctl->clients[i] : NULL;
+		}
+		if (!c || !(c->out = malloc(CONTROL_OUT_BUF_SZ))) {
+			close(fd);  // Full
+			continue;
+		}
+		c->fd = fd;
+		c->id = ++ctl->next_id;
+		mutex_lock(&ctl->lock);
+		tel = ctl->tel;
+		mutex_unlock(&ctl->lock);
+		send_telemetry(c, &tel);  // Where things stand, without waiting for a change
+	}
+}
+
+static void handle_line(Control *ctl, Client *c, const char *line)
+{
+	ControlCommand cmd = { 0 };
+	const char *name, *error;
+	char reply[REPLY_SZ];
+
+	if (!line[strspn(line, " \t\r")]) {
+		return;
+	}
+	if (!(error = parse_command(line, &cmd, &name))) {
+		cmd.client = c->id;
+		mutex_lock(&ctl->lock);
+		if (ctl->outstanding < CONTROL_QUEUE_LEN) {
+			ctl->commands[(ctl->cmd_head + ctl->cmd_count++) % CONTROL_QUEUE_LEN] = cmd;
+			ctl->outstanding++;
+		} else {
+			error = "too many commands waiting";
+		}
+		mutex_unlock(&ctl->lock);
+	}
+	if (error) {
+		format_reply(reply, name, &cmd, error);
+		queue_output(c, reply, strlen(reply));
+	} else {
+		wake_main_loop();  // Carried out, and replied to, by the main loop
+	}
+}
+
+static bool read_client(Control *ctl, Client *c)
+{
+	char buf[1024];
+	ssize_t n, i;
+
+	if ((n = recv(c->fd, buf, sizeof buf, 0)) <= 0) {
+		return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+	}
+	for (i = 0; i < n; i++) {
+		if (buf[i] != '\n') {
+			if (c->in_len + 1 < sizeof c->in) {
+				c->in[c->in_len++] = buf[i];
+			} else {
+				c->overlong = true;
+			}
+			continue;
+		}
+		c->in[c->in_len] = '\0';
+		if (c->overlong) {
+			static const char msg[] = "{\"reply\":null,\"ok\":false,\"error\":\"line too long\"}\n";
+			queue_output(c, msg, sizeof msg - 1);
+		} else {
+			handle_line(ctl, c, c->in);
+		}
+		c->in_len = 0;
+		c->overlong = false;
+	}
+	return true;
+}
+
+static bool flush_client(Client *c)
+{
+	ssize_t n = send(c->fd, c->out, c->out_len, SEND_FLAGS);
+	if (n < 0) {
+		return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+	}
+	memmove(c->out, c->out + n, c->out_len - (size_t)n);
+	c->out_len -= (size_t)n;
+	return true;
+}
+
+static Client *find_client(Control *ctl, unsigned long id)
+{
+	size_t i;
+	for (i = 0; i < CONTROL_MAX_CLIENTS; i++) {
+		if (ctl->clients[i].fd >= 0 && ctl->clients[i].id == id) {
+			return &ctl->clients[i];
+		}
+	}
+	return NULL;  // Gone before the reply came
+}
+
+/*---------------------------------- Server ----------------------------------*/
+
+static void *server_thread(void *arg)
+{
+	Control *ctl = arg;
+	struct pollfd fds[2 + CONTROL_MAX_CLIENTS];
+	long long next_tick = 0, now;
+	bool stopping = false, idle = false;
+	size_t i;
+
+	while (!stopping) {
+		Telemetry tel;
+		bool send_tel = false;
+		char buf[64];
+
+		fds[0] = (struct pollfd) { .fd = ctl->wake_pipe[0], .events = POLLIN };
+		fds[1] = (struct pollfd) { .fd = ctl->listen_fd, .events = POLLIN };
+		for (i = 0; i < CONTROL_MAX_CLIENTS; i++) {
+			Client *c = &ctl->clients[i];
+			fds[2+i] = (struct pollfd) { .fd = c->fd, .events = POLLIN | (c->out_len ? POLLOUT : 0) };
+		}
+		now = now_ms();
+		poll(fds, LEN(fds), idle ? -1 : (int)MAX(next_tick - now, 0));
+
+		if (fds[0].revents & POLLIN) {
+			while (read(ctl->wake_pipe[0], buf, sizeof buf) > 0);
+		}
+		for (i = 0; i < CONTROL_MAX_CLIENTS; i++) {
+			Client *c = &ctl->clients[i];
+			if (c->fd >= 0 && (fds[2+i].revents & (POLLIN | POLLHUP | POLLERR)) && !read_client(ctl, c)) {
+				drop_client(c);
+			}
+		}
+		if (fds[1].revents & POLLIN) {
+			accept_clients(ctl);
+		}
+
+		now = now_ms();
+		mutex_lock(&ctl->lock);
+		stopping = ctl->stopping;
+		for (; ctl->reply_count; ctl->reply_count--, ctl->outstanding--) {
+			Reply *r = &ctl->replies[ctl->reply_head];
+			Client *c = find_client(ctl, r->client);
+			if (c) {
+				queue_output(c, r->line, strlen(r->line));
+			}
+			ctl->reply_head = (ctl->reply_head + 1) % CONTROL_QUEUE_LEN;
+		}
+		if (ctl->tel_seq != ctl->sent_seq && now >= next_tick) {
+			tel = ctl->tel;
+			ctl->sent_seq = ctl->tel_seq;
+			send_tel = true;
+			next_tick = now + TELEMETRY_PERIOD_MS;
+		}
+		idle = ctl->idle = (ctl->tel_seq == ctl->sent_seq);  // Sleep until something changes
+		mutex_unlock(&ctl->lock);
+
+		for (i = 0; i < CONTROL_MAX_CLIENTS; i++) {
+			Client *c = &ctl->clients[i];
+			if (c->fd < 0) {
+				continue;
+			}
+			if (send_tel) {
+				send_telemetry(c, &tel);
+			}
+			if (c->out_len && !flush_client(c)) {
+				drop_client(c);
+			}
+		}
+	}
+
+	for (i = 0; i < CONTROL_MAX_CLIENTS; i++) {
+		if (ctl->clients[i].fd >= 0) {
+			drop_client(&ctl->clients[i]);
+		}
+	}
+	return NULL;
+}
+
+/* Is there a socket at the path with nobody listening on it, left by a process that's gone? */
+static bool is_stale_socket(const struct sockaddr_un *addr)
+{
+	struct stat st;
+	bool stale = false;
+	int fd;
+
+	if (stat(addr->sun_path, &st) == 0 && S_ISSOCK(st.st_mode) && (fd = socket(AF_UNIX, SOCK_STREAM, 0)) >= 0) {
+		stale = connect(fd, (const struct sockaddr *)addr, sizeof *addr) < 0 && errno == ECONNREFUSED;
+		close(fd);
+	}
+	return stale;
+}
+
+Control *control_start(const char *path)
+{
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+	Control *ctl;
+	size_t i;
+
+	if (strlen(path) >= sizeof addr.sun_path || !(ctl = calloc(1, sizeof(Control)))) {
+		return NULL;
+	}
+	strcpy(addr.sun_path, path);
+	strcpy(ctl->path, path);
+	ctl->wake_pipe[0] = ctl->wake_pipe[1] = -1;
+	for (i = 0; i < CONTROL_MAX_CLIENTS; i++) {
+		ctl->clients[i].fd = -1;
+	}
+
+	if ((ctl->listen_fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+		goto error_end;
+	}
+	if (bind(ctl->listen_fd, (struct sockaddr *)&addr, sizeof addr) < 0) {
+		if (errno != EADDRINUSE || !is_stale_socket(&addr) || unlink(path) < 0
+		 || bind(ctl->listen_fd, (struct sockaddr *)&addr, sizeof addr) < 0) {
+			close(ctl->listen_fd);
+			goto error_end;
+		}
+	}
+	if (listen(ctl->listen_fd, CONTROL_MAX_CLIENTS) < 0 || pipe(ctl->wake_pipe) < 0) {
+		goto unlink_end;
+	}
+	set_nonblocking(ctl->listen_fd);
+	set_nonblocking(ctl->wake_pipe[0]);
+	set_nonblocking(ctl->wake_pipe[1]);
+
+	mutex_init(&ctl->lock);
+	if (!thread_create(&ctl->thread, server_thread, ctl)) {
+		mutex_destroy(&ctl->lock);
+		goto unlink_end;
+	}
+	return ctl;
+
+unlink_end:
+	unlink(path);
+	close(ctl->listen_fd);
+	if (ctl->wake_pipe[0] >= 0) {
+		close(ctl->wake_pipe[0]), close(ctl->wake_pipe[1]);
+	}
+error_end:
+	free(ctl);
+	return NULL;
+}
+
+void control_stop(Control *ctl)
+{
+	mutex_lock(&ctl->lock);
+	ctl->stopping = true;
+	mutex_unlock(&ctl->lock);
+	wake_server(ctl);
+	thread_join(ctl->thread);
+
+	close(ctl->listen_fd);
+	unlink(ctl->path);
+	close(ctl->wake_pipe[0]), close(ctl->wake_pipe[1]);
+	mutex_destroy(&ctl->lock);
+	free(ctl);
+}
+
+void control_publish(Control *ctl, const Telemetry *tel)
+{
+	bool wake;
+
+	mutex_lock(&ctl->lock);
+	ctl->tel = *tel;
+	ctl->tel_seq++;
+	wake = ctl->idle;
+	ctl->idle = false;
+	mutex_unlock(&ctl->lock);
+	if (wake) {
+		wake_server(ctl);  // Otherwise it's due to look at the next tick anyway
+	}
+}
+
+bool control_take(Control *ctl, ControlCommand *cmd)
+{
+	bool taken;
+
+	mutex_lock(&ctl->lock);
+	if ((taken = ctl->cmd_count > 0)) {
+		*cmd = ctl->commands[ctl->cmd_head];
+		ctl->cmd_head = (ctl->cmd_head + 1) % CONTROL_QUEUE_LEN;
+		ctl->cmd_count--;
+	}
+	mutex_unlock(&ctl->lock);
+	return taken;
+}
+
+void control_reply(Control *ctl, const ControlCommand *cmd, const char *error)
+{
+	Reply *r;
+
+	mutex_lock(&ctl->lock);
+	r = &ctl->replies[(ctl->reply_head + ctl->reply_count++) % CONTROL_QUEUE_LEN];  // Has room, see outstanding
+	r->client = cmd->client;
+	format_reply(r->line, command_names[cmd->type], cmd, error);
+	mutex_unlock(&ctl->lock);
+	wake_server(ctl);
+}
+
+#else
+
+/* No UNIX domain sockets in this build */
+
+Control *control_start(const char *path)
+{
+	(void)path;
+	return NULL;
+}
+
+void control_stop(Control *ctl)
+{
+	(void)ctl;
+}
+
+void control_publish(Control *ctl, const Telemetry *tel)
+{
+	(void)ctl, (void)tel;
+}
+
+bool control_take(Control *ctl, ControlCommand *cmd)
+{
+	(void)ctl, (void)cmd;
+	return false;
+}
+
+void control_reply(Control *ctl, const ControlCommand *cmd, const char *error)
+{
+	(void)ctl, (void)cmd, (void)error;
+}
+
+#endif  // _WIN32
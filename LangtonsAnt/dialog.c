@@ -9,6 +9,7 @@ const char *dialog_cdef_msg = "Pick grid color";
 static int      cidx;
 static color_t  picked_color = COLOR_NONE;
 static turn_t   picked_turn  = TURN_NONE;
+static bool     is_dirty;
 
 static const Vector2i  colors_pos = { 1, 1 };
 static const Vector2i  left_pos   = { DIALOG_TILE_ROWS*DIALOG_TILE_SIZE+2, 1 };
@@ -31,10 +32,12 @@ void open_dialog(Vector2i pos, color_t color_index)
 	dialogw = newwin(height, DIALOG_WINDOW_WIDTH, dialog_pos.y, dialog_pos.x);
 	keypad(dialogw, true);
 	nodelay(dialogw, true);
+	is_dirty = true;
 }
 
 void close_dialog(void)
 {
+	menu_invalidate_area(abs2rel(dialog_pos, menu_pos), getmaxy(dialogw));
 	delwin(dialogw);
 	dialogw = NULL;
 	picked_color = COLOR_NONE;
@@ -122,6 +125,17 @@ void draw_dialog(void)
 	draw_buttons();
 
 	wnoutrefresh(dialogw);
+	is_dirty = false;
+}
+
+void update_dialog(bool overlapped)
+{
+	if (is_dirty) {
+		draw_dialog();
+	} else if (overlapped) {
+		touchwin(dialogw);
+		wnoutrefresh(dialogw);
+	}
 }
 
 Vector2i dialog_tile_pos(color_t color)
@@ -188,6 +202,7 @@ state_t dialog_mouse_command(MEVENT *mouse)
 	return STATE_NO_CHANGE;
 
 button_clicked:
+	is_dirty = true;
 	switch (cidx) {
 	case CIDX_NEWCOLOR:
 		ret = STATE_MENU_CHANGED;
@@ -221,7 +236,7 @@ button_clicked:
 		} else if (del) {
 			colors_pop(stgs.colors, colors_at(stgs.colors, cidx));
 			if (!has_enough_colors(stgs.colors)) {
-				simulation_halt(stgs.simulation);
+				engine_command(ENGINE_PAUSE);
 			}
 			close_dialog();
 			ret |= STATE_COLORS_CHANGED;
@@ -0,0 +1,301 @@
+#include "graphics.h"
+#include "io.h"
+#include "thread.h"
+
+/** Published copy of EngineView, every field read and written atomically */
+typedef struct published_view {
+	atomic_word_t  steps, ant_y, ant_x, ant_dir, grid_size, epoch, rate;
+} PublishedView;
+
+static struct engine {
+	thread_t       thread;
+	bool           started;
+	mutex_t        lock;        /**< Held while stepping, or by the UI while it uses the simulation */
+	cond_t         wake;        /**< Commands, and the UI letting go of the lock */
+	atomic_word_t  ui_waiting;  /**< UI calls blocked in engine_lock */
+	bool           stopping;
+	unsigned       pending_steps;
+	double         step_time;   /**< When the next step is due (us) */
+	Simulation    *last_sim;
+	unsigned       epoch;
+
+	/* Turbo speeds: steps fill a share of each frame, sized by their measured cost */
+	double         frame_end;   /**< End of the current frame (us) */
+	double         frame_used;  /**< Time spent stepping or drawing in it (us) */
+	double         step_cost;   /**< Moving average time per step (us) */
+
+	/* Achieved speed, measured over ENGINE_RATE_PERIOD_US */
+	ttime_t        rate_time;
+	unsigned       rate_steps, rate;
+
+	/* Seqlock: the writer fills views[(seq+1) % 2], then bumps seq; readers retry if seq moved */
+	atomic_word_t  seq;
+	PublishedView  views[2];
+	atomic_word_t  watched;     /**< UI asleep and waiting for the next publish */
+} engine;
+
+static void publish(Simulation *sim)
+{
+	long seq = atomic_word_load(&engine.seq);
+	PublishedView *v = &engine.views[(seq+1) % 2];
+
+	atomic_word_store(&v->steps, sim->steps);
+	atomic_word_store(&v->ant_y, sim->ant->pos.y);
+	atomic_word_store(&v->ant_x, sim->ant->pos.x);
+	atomic_word_store(&v->ant_dir, sim->ant->dir);
+	atomic_word_store(&v->grid_size, sim->grid->size);
+	atomic_word_store(&v->epoch, engine.epoch);
+	atomic_word_store(&v->rate, is_simulation_running(sim) ? engine.rate : 0);
+	atomic_word_store(&engine.seq, seq+1);
+
+	if (atomic_word_load(&engine.watched) && atomic_word_add(&engine.watched, -1) == 1) {
+		wake_main_loop();  // Only this thread clears the flag, so it wakes the UI once
+	}
+}
+
+static void record_frame(Simulation *sim, ttime_t curr_time)
+{
+	int gs = sim->grid->size, vgs = MIN(gs, GRID_VIEW_SIZE);
+	if (recorder_due(active_recorder, sim->steps, curr_time)) {
+		Vector2i origin = ORIGIN_POS(gs, vgs, gridscrl.y, gridscrl.x);
+		recorder_capture(active_recorder, sim, origin, vgs, curr_time);
+	}
+}
+
+static bool limit_reached(Simulation *sim)
+{
+	return stgs.step_limit && sim->steps >= stgs.step_limit;
+}
+
+/* Number of steps due by now at the current speed, 0 if none yet */
+static unsigned due_steps(ttime_t now)
+{
+	double step_us = LOOP_STEP_TIME_US(stgs.speed), n;
+
+	if (now < engine.step_time) {
+		return 0;
+	}
+	if (now - engine.step_time > ENGINE_MAX_LAG_US) {
+		engine.step_time = (double)now;  // Don't race to catch up after a stall
+	}
+	n = MIN(floor((now - engine.step_time) / step_us) + 1, ENGINE_BATCH_MAX);
+	engine.step_time += n * step_us;
+	return (unsigned)n;
+}
+
+/* Number of steps that fit in what's left of the frame's budget, 0 once it's spent */
+static unsigned turbo_steps(ttime_t now)
+{
+	double budget = LOOP_TURBO_BUDGET_US(stgs.speed);
+
+	if (now >= engine.frame_end) {
+		engine.frame_end = now + LOOP_FRAME_TIME_US;
+		engine.frame_used = 0;
+	}
+	if (engine.frame_used >= budget) {
+		engine.step_time = engine.frame_end;  // Sit out the rest of the frame
+		return 0;
+	}
+	return (unsigned)MAX(MIN(budget - engine.frame_used, ENGINE_SLICE_US) / engine.step_cost, 1);
+}
+
+static void measure_rate(Simulation *sim, ttime_t now)
+{
+	if (now - engine.rate_time >= ENGINE_RATE_PERIOD_US) {
+		engine.rate = (unsigned)((sim->steps - engine.rate_steps) * 1e6 / (now - engine.rate_time));
+		engine.rate_time = now;
+		engine.rate_steps = sim->steps;
+	}
+}
+
+static void reset_rate(Simulation *sim, ttime_t now)
+{
+	engine.rate_time = now;
+	engine.rate_steps = sim->steps;
+	engine.rate = 0;
+}
+
+static void run_batch(Simulation *sim, unsigned count, ttime_t now)
+{
+	bool expanded = false;
+	unsigned i;
+	ttime_t end;
+
+	for (i = 0; i < count && !limit_reached(sim); i++) {
+		expanded |= !simulation_step(sim);
+		if (active_recorder) {
+			record_frame(sim, now);
+		}
+	}
+	end = timer_micros();
+	if (IS_TURBO_SPEED(stgs.speed) && i) {
+		engine.frame_used += end - now;
+		engine.step_cost = (engine.step_cost*3 + (double)(end - now) / i) / 4;
+		engine.step_cost = MAX(engine.step_cost, ENGINE_MIN_STEP_COST_US);
+	}
+	measure_rate(sim, end);
+	if (active_checkpoint) {
+		checkpoint_poll(active_checkpoint, sim, now);
+	}
+	if (expanded) {
+		engine.epoch++;  // Readers must drop anything derived from the old grid
+	}
+	publish(sim);
+
+	if (limit_reached(sim)) {
+		stop_main_loop();
+		wake_main_loop();
+	} else if (expanded) {
+		wake_main_loop();  // Grid to redraw
+	}
+}
+
+static void *engine_thread(void *arg)
+{
+	(void)arg;
+	mutex_lock(&engine.lock);
+	while (!engine.stopping) {
+		Simulation *sim;
+		unsigned count = 0;
+		ttime_t now = timer_micros();
+
+		if (atomic_word_load(&engine.ui_waiting)) {
+			while (atomic_word_load(&engine.ui_waiting) && !engine.stopping) {
+				cond_wait(&engine.wake, &engine.lock);  // UI goes first, it only holds on briefly
+			}
+			engine.frame_used += timer_micros() - now;  // Drawing shares the frame budget
+			now = timer_micros();
+		}
+		if (engine.stopping) {
+			break;
+		}
+		sim = stgs.simulation;  // Only now, the UI may have replaced it meanwhile
+		if (sim != engine.last_sim) {
+			engine.last_sim = sim;
+			engine.epoch++;
+			reset_rate(sim, now);
+			publish(sim);
+		}
+
+		if (limit_reached(sim) || !has_enough_colors(sim->colors)) {
+			engine.pending_steps = 0;
+			if (limit_reached(sim)) {  // Also if it was loaded at or past the limit
+				stop_main_loop();
+				wake_main_loop();
+			}
+			cond_wait(&engine.wake, &engine.lock);  // Nothing to do until the UI changes something
+			continue;
+		}
+		if (engine.pending_steps) {
+			count = engine.pending_steps;
+			engine.pending_steps = 0;
+		} else if (is_simulation_running(sim)) {
+			count = IS_TURBO_SPEED(stgs.speed) ? turbo_steps(now) : due_steps(now);
+		}
+
+		if (count) {
+			run_batch(sim, count, now);
+		} else if (is_simulation_running(sim)) {
+			double wait_us = engine.step_time - now;
+			cond_timedwait(&engine.wake, &engine.lock, (unsigned)MAX(wait_us / 1e3, 1));
+		} else {
+			cond_wait(&engine.wake, &engine.lock);  // Paused, until a command comes in
+		}
+	}
+	mutex_unlock(&engine.lock);
+	return NULL;
+}
+
+void engine_start(void)
+{
+	mutex_init(&engine.lock);
+	cond_init(&engine.wake);
+	engine.stopping = false;
+	engine.step_time = (double)timer_micros();
+	engine.frame_end = 0;
+	engine.step_cost = ENGINE_MIN_STEP_COST_US;
+	engine.last_sim = stgs.simulation;
+	reset_rate(stgs.simulation, timer_micros());
+	publish(stgs.simulation);
+
+	engine.started = thread_create(&engine.thread, engine_thread, NULL);
+}
+
+void engine_stop(void)
+{
+	mutex_lock(&engine.lock);
+	engine.stopping = true;
+	cond_broadcast(&engine.wake);
+	mutex_unlock(&engine.lock);
+	if (engine.started) {
+		thread_join(engine.thread);
+		engine.started = false;
+	}
+	mutex_destroy(&engine.lock);
+	cond_destroy(&engine.wake);
+}
+
+void engine_lock(void)
+{
+	atomic_word_add(&engine.ui_waiting, 1);
+	mutex_lock(&engine.lock);
+	atomic_word_add(&engine.ui_waiting, -1);
+}
+
+void engine_unlock(void)
+{
+	cond_signal(&engine.wake);
+	mutex_unlock(&engine.lock);
+}
+
+void engine_command(EngineCommand cmd)
+{
+	Simulation *sim = stgs.simulation;
+
+	switch (cmd) {
+	case ENGINE_PLAY:
+		simulation_run(sim);
+		engine.step_time = (double)timer_micros();
+		reset_rate(sim, timer_micros());
+		break;
+	case ENGINE_PAUSE:
+		simulation_halt(sim);
+		break;
+	case ENGINE_STEP:
+		simulation_halt(sim);
+		engine.pending_steps++;
+		break;
+	case ENGINE_SPEED:
+		if (IS_TURBO_SPEED(stgs.speed)) {
+			engine.step_time = (double)timer_micros();
+		} else {
+			engine.step_time = MIN(engine.step_time, timer_micros() + LOOP_STEP_TIME_US(stgs.speed));
+		}
+		reset_rate(sim, timer_micros());
+		break;
+	}
+	cond_signal(&engine.wake);
+}
+
+void engine_view(EngineView *view)
+{
+	PublishedView *v;
+	long seq;
+
+	do {
+		seq = atomic_word_load(&engine.seq);
+		v = &engine.views[seq % 2];
+		view->steps = (unsigned)atomic_word_load(&v->steps);
+		view->ant_pos.y = (int)atomic_word_load(&v->ant_y);
+		view->ant_pos.x = (int)atomic_word_load(&v->ant_x);
+		view->ant_dir = (Direction)atomic_word_load(&v->ant_dir);
+		view->grid_size = (unsigned)atomic_word_load(&v->grid_size);
+		view->epoch = (unsigned)atomic_word_load(&v->epoch);
+		view->rate = (unsigned)atomic_word_load(&v->rate);
+	} while (atomic_word_load(&engine.seq) != seq);  // A second publish would be writing this buffer
+}
+
+void engine_watch(void)
+{
+	atomic_word_store(&engine.watched, true);
+}
@@ -0,0 +1,2804 @@
+/* Generated by scripts/embed_examples.py from the examples directory, do not edit */
+#include "io.h"
+
+static const byte cauliflower_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,7,7,6,10,2,7,15,10,7,7,2,7,
+	10,7,6,10,0,0,255,0,0,0,255,1,0,0,1,0,0,0,0,1,15,6,7,1,
+	4,0,0,0,49,0,0,0,67,0,0,0,2,0,0,0,126,178,7,0,3,7,0,0,
+	4,0,0,0,108,0,0,0,142,17,0,0,14,0,0,0,31,0,0,0,95,0,0,0,
+	96,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,255,12,0,0,0,0,0,0,
+	14,2,112,100,0,244,2,0,4,1,17,242,34,250,111,6,0,222,1,0,1,2,0,84,
+	0,3,5,37,170,98,246,175,98,47,38,170,242,2,0,94,0,3,162,0,5,13,7,170,
+	34,0,84,0,19,162,98,98,175,246,0,76,0,23,162,175,47,242,242,162,0,3,1,9,
+	42,175,2,0,116,0,47,47,246,38,106,38,162,42,170,162,250,47,175,0,8,0,7,250,
+	162,0,126,0,9,162,106,6,0,84,0,94,0,25,162,42,242,42,175,255,10,0,68,0,
+	3,170,0,10,0,11,162,175,242,0,68,0,21,170,102,42,102,47,2,0,126,0,1,2,
+	0,84,0,5,175,15,0,84,0,5,175,2,0,84,0,5,1,39,242,162,42,47,47,255,
+	102,162,102,34,0,94,0,17,34,47,162,34,10,0,94,0,13,170,175,42,10,0,13,1,
+	7,242,242,0,68,0,1,15,0,196,1,0,3,175,0,94,0,1,2,0,94,0,3,242,
+	0,84,0,7,242,175,0,126,0,13,162,255,42,10,0,6,1,11,242,242,34,0,158,1,
+	0,68,0,43,255,42,47,47,170,242,162,34,255,250,34,0,84,0,13,47,102,42,10,0,
+	5,1,11,242,242,34,0,116,0,5,255,2,0,94,0,63,250,170,34,42,250,242,175,34,
+	175,34,106,246,47,102,162,162,0,5,1,51,242,242,34,175,47,175,47,255,162,175,175,250,
+	162,0,68,0,3,255,0,116,0,29,242,106,98,162,250,34,42,10,0,5,5,21,170,242,
+	242,111,246,2,0,84,0,1,15,0,84,0,69,111,166,250,47,255,42,47,47,242,47,242,
+	42,246,166,162,47,250,10,0,9,1,21,42,175,242,98,111,15,0,100,0,13,42,242,106,
+	2,0,140,1,0,5,34,10,0,158,1,0,3,242,0,68,0,27,42,242,102,162,162,162,
+	42,0,7,1,45,42,47,175,98,98,255,34,255,42,255,250,6,0,126,0,21,98,255,250,
+	242,242,15,0,84,0,7,242,102,0,94,0,19,162,162,34,47,170,0,13,1,3,42,0,
+	158,1,0,9,106,246,15,0,68,0,3,47,0,116,0,76,0,132,1,0,21,38,255,250,
+	47,162,15,0,100,0,5,102,2,0,108,0,17,250,250,162,47,10,0,14,0,9,250,242,
+	15,0,84,0,68,0,3,47,0,116,0,7,242,170,0,76,0,19,242,34,111,242,175,0,
+	94,0,5,250,2,0,94,0,9,242,98,15,0,76,0,19,42,42,42,242,162,0,7,0,
+	1,10,0,126,0,39,250,242,242,47,42,175,34,170,175,106,0,68,0,53,111,34,175,34,
+	175,47,47,47,47,102,170,175,250,10,0,94,0,7,242,162,0,13,0,1,10,0,100,0,
+	1,15,0,84,0,3,255,0,84,0,3,175,0,68,0,47,170,175,106,242,98,242,242,162,
+	242,42,170,255,0,132,1,0,3,170,0,94,0,17,250,242,242,242,10,0,11,0,1,10,
+	0,100,0,31,255,242,170,34,47,250,34,170,0,94,0,108,0,37,255,170,255,162,42,162,
+	250,170,255,2,0,94,0,9,242,250,15,0,68,0,94,0,1,10,0,12,1,25,42,170,
+	242,242,47,170,15,0,68,0,9,106,38,2,0,94,0,3,34,0,94,0,13,102,170,34,
+	15,0,100,0,84,0,19,175,47,162,42,175,0,68,0,13,255,170,34,10,0,5,1,41,
+	42,42,42,170,34,175,162,47,250,102,2,0,94,0,3,242,0,68,0,69,111,38,255,242,
+	47,255,42,162,162,42,250,170,242,34,255,170,34,10,0,13,0,17,250,170,242,170,15,0,
+	84,0,7,162,162,0,126,0,17,242,242,102,34,15,0,68,0,94,0,116,0,23,242,175,
+	42,42,250,250,0,68,0,94,0,3,242,0,148,1,0,11,0,7,162,242,0,68,0,41,
+	47,42,102,170,47,47,255,242,111,246,2,0,126,0,5,242,15,0,116,0,19,255,242,47,
+	250,250,0,148,1,0,3,255,0,84,0,13,255,242,162,10,0,9,0,9,242,250,2,0,
+	148,1,0,19,98,38,47,242,242,0,68,0,3,170,0,100,0,25,47,255,242,170,47,242,
+	15,0,68,0,41,106,166,47,242,250,162,242,242,242,250,10,0,9,0,21,242,162,250,34,
+	47,15,0,132,1,0,7,255,34,0,84,0,13,175,34,255,2,0,116,0,29,162,162,255,
+	170,34,250,102,10,0,94,0,27,250,170,162,34,47,106,166,0,13,0,1,2,0,126,0,
+	68,0,11,255,34,102,0,100,0,3,255,0,116,0,68,0,35,255,42,242,175,175,250,175,
+	42,175,0,68,0,19,250,162,47,250,42,0,116,0,7,246,166,0,13,0,5,242,15,0,
+	100,0,3,47,0,94,0,5,38,6,0,132,1,0,3,47,0,126,0,11,242,106,246,0,
+	68,0,31,42,255,162,42,242,250,175,162,0,100,0,21,170,255,34,111,111,10,0,16,0,
+	1,2,0,116,0,9,34,255,2,0,76,0,3,111,0,190,1,0,23,242,242,170,162,102,
+	47,0,84,0,126,0,3,250,0,84,0,13,162,42,250,15,0,68,0,3,47,0,126,0,
+	9,242,102,10,0,11,0,9,250,242,10,0,100,0,13,111,242,98,15,0,100,0,41,47,
+	47,162,42,175,242,250,47,47,255,2,0,116,0,11,242,162,47,0,126,0,9,34,47,2,
+	0,148,1,0,1,2,0,5,0,7,42,175,0,68,0,23,170,111,255,98,34,255,0,100,
+	0,85,111,246,242,175,162,242,242,34,47,111,246,47,42,47,242,47,111,246,250,47,170,2,
+	0,9,0,27,42,250,47,162,250,246,111,0,158,2,0,9,38,246,2,0,94,0,3,170,
+	0,108,0,25,175,42,111,246,47,250,2,0,126,0,23,98,242,166,47,162,175,0,12,0,
+	3,170,0,94,0,19,242,242,47,102,255,0,228,1,0,3,38,0,76,0,94,0,3,242,
+	0,108,0,35,250,162,47,98,246,162,34,170,242,0,108,0,13,42,47,162,10,0,10,0,
+	7,170,47,0,158,1,0,31,34,47,255,34,47,47,47,246,0,76,0,19,255,242,242,47,
+	175,0,94,0,25,250,98,98,47,42,170,2,0,148,1,0,108,0,5,175,10,0,9,0,
+	21,42,42,242,242,242,15,0,68,0,27,102,47,47,162,106,246,242,0,132,1,0,9,111,
+	38,15,0,116,0,23,47,246,98,242,250,175,0,94,0,17,242,246,98,175,10,0,8,2,
+	9,170,242,2,0,126,0,61,242,242,246,246,47,162,175,34,170,242,242,98,170,162,242,15,
+	0,76,0,68,0,1,15,0,76,0,29,42,42,242,242,98,38,162,10,0,11,6,1,2,
+	0,116,0,39,47,255,98,98,242,170,175,250,175,42,0,94,0,17,166,255,42,42,2,0,
+	76,0,68,0,94,0,9,246,250,10,0,100,0,13,255,242,162,10,0,4,0,69,250,47,
+	106,246,111,98,170,175,250,242,242,34,255,98,162,47,250,10,0,158,1,0,172,1,0,25,
+	34,42,250,47,242,47,2,0,8,0,27,42,162,246,246,38,38,170,0,94,0,13,242,242,
+	34,15,0,76,0,94,0,9,170,175,2,0,190,1,0,35,34,170,255,162,42,170,34,255,
+	34,0,7,2,47,42,106,246,98,246,102,47,242,242,47,255,246,0,172,1,0,3,47,0,
+	84,0,19,242,47,47,175,250,0,132,1,0,15,250,42,255,34,0,8,2,7,170,47,0,
+	126,0,9,98,38,2,0,126,0,27,242,34,102,34,47,47,38,0,84,0,100,0,37,47,
+	47,255,242,242,242,170,242,47,2,0,8,0,7,170,47,0,126,0,9,98,38,2,0,126,
+	0,27,106,34,102,34,47,47,38,0,84,0,100,0,37,47,47,255,242,242,242,170,242,47,
+	2,0,7,1,47,42,106,246,98,246,102,47,242,242,175,102,242,0,172,1,0,3,47,0,
+	84,0,19,242,47,47,175,250,0,132,1,0,15,250,42,255,34,0,7,1,27,42,162,246,
+	246,38,38,170,0,94,0,19,242,242,250,34,102,0,94,0,9,170,175,2,0,190,1,0,
+	35,34,170,255,162,42,170,34,255,34,0,4,0,69,250,47,106,246,111,98,170,175,250,242,
+	242,250,98,98,162,47,250,10,0,158,1,0,172,1,0,25,34,42,250,47,242,47,2,0,
+	9,0,1,2,0,116,0,63,47,255,98,98,242,170,175,250,175,255,98,38,250,175,162,34,
+	0,76,0,68,0,94,0,9,246,250,10,0,100,0,13,255,242,162,10,0,10,5,9,170,
+	242,2,0,126,0,31,242,242,246,246,47,162,175,34,0,84,0,23,242,242,162,42,175,255,
+	0,76,0,68,0,1,15,0,76,0,29,42,42,242,242,98,38,162,10,0,9,1,21,42,
+	42,242,242,242,15,0,68,0,31,102,47,47,162,106,246,242,162,0,94,0,11,102,242,242,
+	0,84,0,23,47,246,98,242,250,175,0,94,0,17,242,246,98,175,10,0,10,0,7,170,
+	47,0,158,1,0,31,34,47,255,34,47,47,47,246,0,76,0,17,255,42,111,246,2,0,
+	126,0,25,250,98,98,47,42,170,2,0,148,1,0,108,0,5,175,10,0,12,0,3,170,
+	0,94,0,19,242,242,47,102,255,0,228,1,0,3,38,0,76,0,94,0,1,10,0,132,
+	1,0,35,255,162,47,98,246,162,34,170,242,0,108,0,13,42,47,162,10,0,9,0,27,
+	42,250,47,162,250,246,111,0,158,2,0,9,38,246,2,0,94,0,3,250,0,132,1,0,
+	23,255,250,102,255,162,47,0,126,0,23,98,242,166,47,162,175,0,5,0,7,42,175,0,
+	68,0,23,170,111,255,98,34,255,0,100,0,85,111,246,242,175,242,47,47,255,162,111,246,
+	47,42,47,242,47,111,246,250,47,170,2,0,11,0,9,250,242,10,0,100,0,13,111,242,
+	98,15,0,100,0,39,47,47,162,42,175,242,47,242,242,102,0,148,1,0,11,242,162,47,
+	0,126,0,9,34,47,2,0,148,1,0,1,2,0,15,0,1,2,0,116,0,9,34,255,
+	2,0,76,0,3,111,0,190,1,0,23,242,242,170,162,102,47,0,94,0,11,98,111,255,
+	0,84,0,13,162,42,250,15,0,68,0,3,47,0,126,0,9,242,102,10,0,13,0,5,
+	242,15,0,100,0,3,47,0,94,0,5,38,6,0,132,1,0,3,47,0,126,0,11,242,
+	106,246,0,68,0,31,170,102,255,42,242,250,175,162,0,100,0,21,170,255,34,111,111,10,
+	0,13,0,1,2,0,126,0,68,0,11,255,34,102,0,100,0,3,255,0,116,0,68,0,
+	35,255,42,242,175,175,47,242,42,175,0,68,0,19,250,162,47,250,42,0,116,0,7,246,
+	166,0,9,0,21,242,162,250,34,47,15,0,132,1,0,7,255,34,0,84,0,13,175,34,
+	255,2,0,116,0,29,162,242,34,255,42,250,102,10,0,94,0,27,250,170,162,34,47,106,
+	166,0,7,0,9,242,250,2,0,148,1,0,19,98,38,47,242,242,0,68,0,3,170,0,
+	100,0,73,47,255,242,250,242,47,242,42,106,166,47,242,250,162,242,242,242,250,10,0,11,
+	0,7,162,242,0,68,0,41,47,42,102,170,47,47,255,242,111,246,2,0,126,0,7,242,
+	175,0,94,0,19,34,47,162,250,250,0,148,1,0,3,255,0,84,0,13,255,242,162,10,
+	0,13,0,17,250,170,242,170,15,0,84,0,7,162,162,0,126,0,17,242,242,102,34,15,
+	0,68,0,94,0,84,0,25,255,34,255,170,162,175,15,0,68,0,94,0,3,242,0,148,
+	1,0,5,0,41,42,42,42,170,34,175,162,47,250,102,2,0,94,0,3,242,0,68,0,
+	69,111,38,255,242,175,34,47,162,162,42,250,170,242,34,255,170,34,10,0,11,2,25,42,
+	170,242,242,47,170,15,0,68,0,9,106,38,2,0,94,0,3,34,0,94,0,17,102,170,
+	34,47,2,0,148,1,0,19,175,47,162,42,175,0,68,0,13,255,170,34,10,0,11,2,
+	1,10,0,100,0,31,255,242,170,34,47,250,34,170,0,94,0,108,0,37,255,170,255,162,
+	42,162,250,170,255,2,0,94,0,9,242,250,15,0,68,0,94,0,1,10,0,13,0,1,
+	10,0,100,0,1,15,0,84,0,3,255,0,84,0,3,175,0,68,0,47,170,175,106,242,
+	98,242,242,162,242,42,170,255,0,132,1,0,3,170,0,94,0,17,250,242,242,242,10,0,
+	7,0,1,10,0,126,0,39,250,242,242,47,42,175,34,170,175,106,0,68,0,53,111,34,
+	175,34,175,47,47,47,47,102,170,175,250,10,0,94,0,7,242,162,0,14,0,9,250,242,
+	15,0,84,0,68,0,3,47,0,116,0,7,242,170,0,76,0,19,242,34,111,242,175,0,
+	94,0,5,250,2,0,94,0,9,242,98,15,0,76,0,19,42,42,42,242,162,0,13,0,
+	3,42,0,158,1,0,9,106,246,15,0,68,0,3,47,0,116,0,76,0,132,1,0,21,
+	38,255,250,47,162,15,0,100,0,5,102,2,0,108,0,17,250,250,162,47,10,0,7,2,
+	45,42,47,175,98,98,255,34,255,42,255,250,6,0,126,0,21,98,255,250,242,242,15,0,
+	84,0,7,242,102,0,94,0,19,162,162,34,47,170,0,9,2,21,42,175,242,98,111,15,
+	0,100,0,13,42,242,106,2,0,140,1,0,5,34,10,0,158,1,0,3,242,0,68,0,
+	27,42,242,102,162,162,162,42,0,5,2,21,170,242,242,111,246,2,0,84,0,1,15,0,
+	84,0,69,111,166,250,47,255,42,47,47,242,47,242,42,246,166,162,47,250,10,0,5,6,
+	51,242,242,34,175,47,175,47,255,162,175,175,250,162,0,68,0,3,255,0,116,0,29,242,
+	106,98,162,250,34,42,10,0,5,2,11,242,242,34,0,116,0,5,255,2,0,94,0,63,
+	250,170,34,42,250,242,175,34,175,34,106,246,47,102,162,162,0,6,2,11,242,242,34,0,
+	158,1,0,68,0,43,255,42,47,47,170,242,162,34,255,250,34,0,84,0,13,47,102,42,
+	10,0,13,2,7,242,242,0,68,0,1,15,0,196,1,0,3,175,0,94,0,1,2,0,
+	94,0,3,242,0,84,0,7,242,175,0,126,0,13,162,255,42,10,0,5,2,39,242,162,
+	42,47,47,255,102,162,102,34,0,94,0,17,34,47,162,34,10,0,94,0,13,170,175,42,
+	10,0,10,2,11,162,175,242,0,68,0,21,170,102,42,102,47,2,0,126,0,1,2,0,
+	84,0,5,175,15,0,84,0,5,175,2,0,84,0,8,0,7,250,162,0,126,0,9,162,
+	106,6,0,84,0,94,0,25,162,42,242,42,175,255,10,0,68,0,3,170,0,3,0,9,
+	42,175,2,0,116,0,47,47,246,38,106,38,162,42,170,162,250,47,175,0,5,2,7,170,
+	34,0,84,0,19,162,98,98,175,246,0,76,0,23,162,175,47,242,242,162,0,3,14,37,
+	170,98,246,175,98,47,38,170,242,2,0,94,0,3,162,0,4,6,17,242,34,250,111,6,
+	0,222,1,0,1,2,0,84,0,2,2,100,0,244,2,
+};
+
+static const byte highway_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,7,7,7,7,7,7,7,12,7,7,7,7,
+	15,7,7,12,0,0,0,0,0,0,0,1,0,0,0,0,255,0,0,1,15,12,7,1,
+	2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,3,7,0,0,
+	4,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,
+	2,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static const byte spiral_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,7,7,9,7,2,7,15,12,4,6,11,14,
+	10,8,13,12,0,0,1,0,255,0,1,255,255,1,1,1,1,255,1,255,15,6,7,1,
+	11,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,3,7,0,0,
+	4,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,
+	2,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static const byte square_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,7,11,9,7,2,14,15,12,4,6,8,14,
+	1,10,10,12,0,255,1,0,255,0,1,255,255,1,255,255,1,0,255,255,15,6,7,1,
+	11,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,3,7,0,0,
+	4,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,
+	2,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static const byte square2_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,7,15,7,7,13,7,4,4,7,7,6,7,
+	7,1,10,14,0,255,0,0,1,0,255,255,0,0,1,0,0,255,255,255,6,10,7,1,
+	7,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,3,7,0,0,
+	4,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,
+	2,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static const byte square3_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,7,8,1,2,3,15,4,9,9,13,6,10,
+	11,5,12,14,0,255,255,255,255,1,255,1,1,1,1,255,255,255,255,255,8,1,7,1,
+	14,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,3,7,0,0,
+	4,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,
+	2,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static const byte sword_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,14,9,10,4,8,14,14,1,7,2,3,14,
+	14,14,7,14,0,1,255,255,255,0,0,1,255,1,255,0,0,0,255,0,8,4,14,1,
+	8,0,0,0,72,2,0,0,126,1,0,0,0,0,0,0,20,182,21,0,3,14,0,0,
+	4,0,0,0,204,3,0,0,204,166,1,0,63,1,0,0,66,1,0,0,138,2,0,0,
+	137,2,0,0,0,0,0,0,120,0,0,0,0,0,0,0,35,97,0,0,0,0,0,0,
+	191,2,1,244,5,238,58,0,3,0,3,151,0,226,57,0,3,121,0,4,3,78,0,3,
+	145,0,162,57,0,5,25,7,0,3,0,11,151,113,145,0,226,56,0,7,25,113,0,6,
+	107,206,13,0,11,145,113,145,0,162,56,0,1,9,0,66,0,206,4,0,9,0,3,151,
+	0,130,13,0,13,23,25,23,9,0,226,55,0,1,9,0,66,0,1,7,0,130,4,0,
+	3,121,0,10,0,5,23,9,0,130,13,0,13,23,25,23,9,0,162,55,0,1,9,0,
+	66,0,1,7,0,130,4,0,3,25,0,142,4,0,11,0,7,23,145,0,130,13,0,13,
+	23,25,23,9,0,226,54,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,
+	3,0,3,121,0,13,0,1,7,0,66,0,1,9,0,130,13,0,13,23,25,23,9,0,
+	162,54,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,5,25,7,
+	0,13,0,1,7,0,98,0,1,9,0,130,13,0,13,23,25,23,9,0,226,53,0,1,
+	9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,7,25,113,0,15,0,1,
+	7,0,130,1,0,1,9,0,130,13,0,13,23,25,23,9,0,162,53,0,1,9,0,66,
+	0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,66,0,1,7,0,15,0,
+	1,7,0,162,1,0,1,9,0,130,13,0,13,23,25,23,9,0,226,52,0,1,9,0,
+	66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,98,0,1,7,0,15,
+	0,1,7,0,194,1,0,1,9,0,130,13,0,13,23,25,23,9,0,162,52,0,1,9,
+	0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,1,0,1,7,
+	0,15,0,1,7,0,226,1,0,1,9,0,130,13,0,13,23,25,23,9,0,226,51,0,
+	1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,162,1,0,
+	1,7,0,15,0,1,7,0,130,2,0,1,9,0,130,13,0,13,23,25,23,9,0,162,
+	51,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,194,
+	1,0,1,7,0,15,0,1,7,0,162,2,0,1,9,0,130,13,0,13,23,25,23,9,
+	0,226,50,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,
+	0,226,1,0,1,7,0,15,0,1,7,0,194,2,0,1,9,0,130,13,0,13,23,25,
+	23,9,0,162,50,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,
+	1,9,0,130,2,0,1,7,0,15,0,1,7,0,226,2,0,1,9,0,130,13,0,13,
+	23,25,23,9,0,226,49,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,
+	3,0,1,9,0,162,2,0,1,7,0,15,0,1,7,0,130,3,0,1,9,0,130,13,
+	0,13,23,25,23,9,0,162,49,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,
+	0,194,3,0,1,9,0,194,2,0,1,7,0,15,0,1,7,0,162,3,0,1,9,0,
+	130,13,0,13,23,25,23,9,0,226,48,0,1,9,0,66,0,1,7,0,130,4,0,5,
+	25,7,0,194,3,0,1,9,0,226,2,0,1,7,0,15,0,1,7,0,194,3,0,1,
+	9,0,130,13,0,13,23,25,23,9,0,162,48,0,1,9,0,66,0,1,7,0,130,4,
+	0,5,25,7,0,194,3,0,1,9,0,130,3,0,1,7,0,15,0,1,7,0,226,3,
+	0,1,9,0,130,13,0,13,23,25,23,9,0,226,47,0,1,9,0,66,0,1,7,0,
+	130,4,0,5,25,7,0,194,3,0,1,9,0,162,3,0,1,7,0,15,0,1,7,0,
+	130,4,0,1,9,0,130,13,0,13,23,25,23,9,0,162,47,0,1,9,0,66,0,1,
+	7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,194,3,0,1,7,0,15,0,1,
+	7,0,162,4,0,1,9,0,130,13,0,13,23,25,23,9,0,226,46,0,1,9,0,66,
+	0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,226,3,0,1,7,0,15,
+	0,1,7,0,194,4,0,1,9,0,130,13,0,13,23,25,23,9,0,162,46,0,1,9,
+	0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,4,0,1,7,
+	0,15,0,1,7,0,226,4,0,1,9,0,130,13,0,13,23,25,23,9,0,226,45,0,
+	1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,162,4,0,
+	1,7,0,15,0,1,7,0,130,5,0,1,9,0,130,13,0,13,23,25,23,9,0,162,
+	45,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,194,
+	4,0,1,7,0,15,0,1,7,0,162,5,0,1,9,0,130,13,0,13,23,25,23,9,
+	0,226,44,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,
+	0,226,4,0,1,7,0,15,0,1,7,0,194,5,0,1,9,0,130,13,0,13,23,25,
+	23,9,0,162,44,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,
+	1,9,0,130,5,0,1,7,0,15,0,1,7,0,226,5,0,1,9,0,130,13,0,13,
+	23,25,23,9,0,226,43,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,
+	3,0,1,9,0,162,5,0,1,7,0,15,0,1,7,0,130,6,0,1,9,0,130,13,
+	0,13,23,25,23,9,0,162,43,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,
+	0,194,3,0,1,9,0,194,5,0,1,7,0,15,0,1,7,0,162,6,0,1,9,0,
+	130,13,0,13,23,25,23,9,0,226,42,0,1,9,0,66,0,1,7,0,130,4,0,5,
+	25,7,0,194,3,0,1,9,0,226,5,0,1,7,0,15,0,1,7,0,194,6,0,1,
+	9,0,130,13,0,13,23,25,23,9,0,162,42,0,1,9,0,66,0,1,7,0,130,4,
+	0,5,25,7,0,194,3,0,1,9,0,130,6,0,1,7,0,15,0,1,7,0,226,6,
+	0,1,9,0,130,13,0,13,23,25,23,9,0,226,41,0,1,9,0,66,0,1,7,0,
+	130,4,0,5,25,7,0,194,3,0,1,9,0,162,6,0,1,7,0,15,0,1,7,0,
+	130,7,0,1,9,0,130,13,0,13,23,25,23,9,0,162,41,0,1,9,0,66,0,1,
+	7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,194,6,0,1,7,0,15,0,1,
+	7,0,162,7,0,1,9,0,130,13,0,13,23,25,23,9,0,226,40,0,1,9,0,66,
+	0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,226,6,0,1,7,0,15,
+	0,1,7,0,194,7,0,1,9,0,130,13,0,13,23,25,23,9,0,162,40,0,1,9,
+	0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,7,0,1,7,
+	0,15,0,1,7,0,226,7,0,1,9,0,130,13,0,13,23,25,23,9,0,226,39,0,
+	1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,162,7,0,
+	1,7,0,15,0,1,7,0,130,8,0,1,9,0,130,13,0,13,23,25,23,9,0,162,
+	39,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,194,
+	7,0,1,7,0,15,0,1,7,0,162,8,0,1,9,0,130,13,0,13,23,25,23,9,
+	0,226,38,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,
+	0,226,7,0,1,7,0,15,0,1,7,0,194,8,0,1,9,0,130,13,0,13,23,25,
+	23,9,0,162,38,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,
+	1,9,0,130,8,0,78,0,15,0,1,7,0,226,8,0,1,9,0,130,13,0,13,23,
+	25,23,9,0,226,37,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,
+	0,1,9,0,130,8,0,7,23,121,0,15,0,1,7,0,130,9,0,1,9,0,130,13,
+	0,13,23,25,23,9,0,162,37,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,
+	0,194,3,0,1,9,0,130,8,0,9,23,25,7,0,15,0,1,7,0,162,9,0,1,
+	9,0,130,13,0,13,23,25,23,9,0,226,36,0,1,9,0,66,0,1,7,0,130,4,
+	0,5,25,7,0,194,3,0,1,9,0,130,8,0,11,23,25,113,0,17,0,1,7,0,
+	194,9,0,1,9,0,130,13,0,13,23,25,23,9,0,162,36,0,1,9,0,66,0,1,
+	7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,66,0,
+	1,7,0,17,0,1,7,0,226,9,0,1,9,0,130,13,0,13,23,25,23,9,0,226,
+	35,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,
+	8,0,5,23,9,0,98,0,1,7,0,17,0,1,7,0,130,10,0,1,9,0,130,13,
+	0,13,23,25,23,9,0,162,35,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,
+	0,194,3,0,1,9,0,130,8,0,5,23,9,0,130,1,0,1,7,0,17,0,1,7,
+	0,162,10,0,1,9,0,130,13,0,13,23,25,23,9,0,226,34,0,1,9,0,66,0,
+	1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,162,
+	1,0,1,7,0,17,0,1,7,0,194,10,0,1,9,0,130,13,0,13,23,25,23,9,
+	0,162,34,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,
+	0,130,8,0,5,23,9,0,194,1,0,1,7,0,17,0,1,7,0,226,10,0,1,9,
+	0,130,13,0,13,23,25,23,9,0,226,33,0,1,9,0,66,0,1,7,0,130,4,0,
+	5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,226,1,0,1,7,0,17,
+	0,1,7,0,130,11,0,1,9,0,130,13,0,13,23,25,23,9,0,162,33,0,1,9,
+	0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,
+	9,0,130,2,0,1,7,0,17,0,1,7,0,162,11,0,1,9,0,130,13,0,13,23,
+	25,23,9,0,226,32,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,
+	0,1,9,0,130,8,0,5,23,9,0,162,2,0,1,7,0,17,0,1,7,0,194,11,
+	0,1,9,0,130,13,0,13,23,25,23,9,0,162,32,0,1,9,0,66,0,1,7,0,
+	130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,194,2,0,1,
+	7,0,17,0,1,7,0,226,11,0,1,9,0,130,13,0,13,23,25,23,9,0,226,31,
+	0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,
+	0,5,23,9,0,226,2,0,1,7,0,17,0,1,7,0,130,12,0,1,9,0,130,13,
+	0,13,23,25,23,9,0,162,31,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,
+	0,194,3,0,1,9,0,130,8,0,5,23,9,0,130,3,0,1,7,0,17,0,1,7,
+	0,162,12,0,1,9,0,130,13,0,13,23,25,23,9,0,226,30,0,1,9,0,66,0,
+	1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,162,
+	3,0,1,7,0,17,0,1,7,0,194,12,0,1,9,0,130,13,0,13,23,25,23,9,
+	0,162,30,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,
+	0,130,8,0,5,23,9,0,194,3,0,1,7,0,17,0,1,7,0,226,12,0,1,9,
+	0,130,13,0,13,23,25,23,9,0,226,29,0,1,9,0,66,0,1,7,0,130,4,0,
+	5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,226,3,0,1,7,0,17,
+	0,1,7,0,130,13,0,1,9,0,130,13,0,13,23,25,23,9,0,162,29,0,1,9,
+	0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,
+	9,0,130,4,0,1,7,0,17,0,1,7,0,162,13,0,1,9,0,130,13,0,13,23,
+	25,23,9,0,226,28,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,
+	0,1,9,0,130,8,0,5,23,9,0,162,4,0,1,7,0,17,0,1,7,0,194,13,
+	0,1,9,0,130,13,0,13,23,25,23,9,0,162,28,0,1,9,0,66,0,1,7,0,
+	130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,194,4,0,1,
+	7,0,17,0,1,7,0,226,13,0,1,9,0,130,13,0,13,23,25,23,9,0,226,27,
+	0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,
+	0,5,23,9,0,226,4,0,1,7,0,17,0,1,7,0,130,14,0,1,9,0,130,13,
+	0,13,23,25,23,9,0,162,27,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,
+	0,194,3,0,1,9,0,130,8,0,5,23,9,0,130,5,0,1,7,0,17,0,1,7,
+	0,162,14,0,1,9,0,130,13,0,13,23,25,23,9,0,226,26,0,1,9,0,66,0,
+	1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,162,
+	5,0,1,7,0,17,0,1,7,0,194,14,0,1,9,0,130,13,0,13,23,25,23,9,
+	0,162,26,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,
+	0,130,8,0,5,23,9,0,194,5,0,1,7,0,17,0,1,7,0,226,14,0,1,9,
+	0,130,13,0,13,23,25,23,9,0,226,25,0,1,9,0,66,0,1,7,0,130,4,0,
+	5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,226,5,0,1,7,0,17,
+	0,1,7,0,130,15,0,1,9,0,130,13,0,13,23,25,23,9,0,162,25,0,1,9,
+	0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,
+	9,0,130,6,0,1,7,0,17,0,1,7,0,162,15,0,1,9,0,130,13,0,13,23,
+	25,23,9,0,226,24,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,
+	0,1,9,0,130,8,0,5,23,9,0,162,6,0,1,7,0,17,0,1,7,0,194,15,
+	0,1,9,0,130,13,0,13,23,25,23,9,0,162,24,0,1,9,0,66,0,1,7,0,
+	130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,194,6,0,1,
+	7,0,17,0,1,7,0,226,15,0,1,9,0,130,13,0,13,23,25,23,9,0,226,23,
+	0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,
+	0,5,23,9,0,226,6,0,1,7,0,17,0,1,7,0,130,16,0,1,9,0,130,13,
+	0,13,23,25,23,9,0,162,23,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,
+	0,194,3,0,1,9,0,130,8,0,5,23,9,0,130,7,0,1,7,0,17,0,1,7,
+	0,162,16,0,1,9,0,130,13,0,13,23,25,23,9,0,226,22,0,1,9,0,66,0,
+	1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,162,
+	7,0,1,7,0,17,0,1,7,0,194,16,0,1,9,0,130,13,0,13,23,25,23,9,
+	0,162,22,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,
+	0,130,8,0,5,23,9,0,194,7,0,1,7,0,17,0,1,7,0,226,16,0,1,9,
+	0,130,13,0,13,23,25,23,9,0,226,21,0,1,9,0,66,0,1,7,0,130,4,0,
+	5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,226,7,0,1,7,0,17,
+	0,1,7,0,130,17,0,1,9,0,130,13,0,13,23,25,23,9,0,162,21,0,1,9,
+	0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,
+	9,0,130,8,0,1,7,0,17,0,1,7,0,162,17,0,1,9,0,130,13,0,13,23,
+	25,23,9,0,226,20,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,
+	0,1,9,0,130,8,0,5,23,9,0,162,8,0,1,7,0,19,0,1,7,0,194,17,
+	0,1,9,0,130,13,0,13,23,25,23,9,0,162,12,0,242,3,0,226,3,0,1,9,
+	0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,
+	9,0,194,8,0,1,7,0,22,0,1,7,0,226,17,0,1,9,0,130,13,0,13,23,
+	25,23,9,0,226,7,0,242,3,0,5,145,3,0,244,2,0,3,147,0,194,3,0,1,
+	9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,
+	23,9,0,226,8,0,1,7,0,23,0,1,7,0,130,18,0,1,9,0,130,13,0,11,
+	23,25,23,0,242,7,0,3,50,0,244,2,0,11,147,145,138,0,166,2,0,5,168,9,
+	0,162,3,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,
+	0,130,8,0,5,23,9,0,130,9,0,1,7,0,23,0,1,7,0,162,18,0,1,9,
+	0,130,13,0,11,23,25,39,0,244,7,0,3,67,0,166,2,0,15,168,25,169,131,0,
+	230,1,0,9,56,42,9,0,226,2,0,1,9,0,66,0,1,7,0,130,4,0,5,25,
+	7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,162,9,0,1,7,0,24,0,1,
+	7,0,194,18,0,1,9,0,130,13,0,11,23,153,66,0,198,7,0,5,58,4,0,102,
+	0,104,0,19,56,42,153,58,131,0,166,1,0,11,56,58,147,0,194,2,0,1,9,0,
+	66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,
+	0,194,9,0,1,7,0,29,0,1,7,0,226,18,0,1,9,0,162,12,0,82,0,11,
+	33,170,67,0,198,7,0,5,58,4,0,70,0,13,148,18,163,3,0,84,0,1,2,0,
+	70,0,1,8,0,102,0,11,56,58,164,0,82,0,226,1,0,1,9,0,66,0,1,7,
+	0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,226,9,0,
+	1,7,0,27,0,1,7,0,130,19,0,1,9,0,130,12,0,3,57,0,84,0,9,51,
+	58,4,0,198,7,0,23,58,52,67,137,161,163,0,102,0,1,2,0,70,0,112,0,17,
+	163,67,35,58,2,0,82,0,98,0,1,9,0,66,0,1,7,0,130,4,0,5,25,7,
+	0,194,3,0,1,9,0,130,8,0,5,23,9,0,130,10,0,1,7,0,24,0,1,7,
+	0,162,19,0,1,9,0,226,11,0,5,169,8,0,134,1,0,5,58,4,0,166,6,0,
+	3,68,0,80,0,19,52,52,116,114,164,0,166,1,0,37,50,19,33,167,67,35,67,163,
+	58,2,0,114,0,66,0,1,7,0,130,4,0,5,25,7,0,194,3,0,1,9,0,130,
+	8,0,5,23,9,0,162,10,0,1,7,0,25,0,1,7,0,194,19,0,1,9,0,194,
+	11,0,7,169,131,0,134,1,0,5,58,4,0,134,6,0,21,148,58,35,72,56,8,0,
+	104,0,3,136,0,70,0,37,162,58,17,58,67,35,67,163,67,3,0,116,0,68,0,1,
+	1,0,82,0,162,3,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,
+	194,10,0,1,7,0,24,0,1,7,0,226,19,0,1,9,0,162,10,0,146,1,0,7,
+	58,131,0,134,1,0,5,58,4,0,230,5,0,31,148,24,18,168,113,120,17,42,0,98,
+	0,37,162,52,169,147,52,50,52,58,52,10,0,70,0,5,58,4,0,84,0,3,147,0,
+	130,3,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,226,10,0,1,
+	7,0,27,0,1,7,0,130,20,0,1,9,0,130,10,0,3,57,0,84,0,1,2,0,
+	70,0,1,8,0,134,1,0,5,58,4,0,230,3,0,104,0,80,0,75,119,18,131,20,
+	41,154,34,132,163,138,74,164,33,130,39,67,163,67,163,0,70,0,5,58,4,0,70,0,
+	5,168,9,0,226,2,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,
+	130,11,0,1,7,0,27,0,1,7,0,162,20,0,1,9,0,226,9,0,5,169,8,0,
+	70,0,1,2,0,70,0,1,8,0,134,1,0,5,58,4,0,166,3,0,3,24,0,68,
+	0,79,58,35,146,20,163,145,68,146,33,137,138,169,74,56,58,136,68,163,67,163,0,70,
+	0,5,58,4,0,70,0,9,56,42,9,0,162,2,0,5,25,7,0,194,3,0,1,9,
+	0,130,8,0,5,23,9,0,162,11,0,1,7,0,30,0,1,7,0,194,20,0,1,9,
+	0,226,8,0,82,0,7,162,131,0,70,0,1,2,0,70,0,1,8,0,134,1,0,5,
+	58,4,0,134,3,0,3,168,0,104,0,3,152,0,78,0,65,113,73,39,114,114,74,129,
+	40,132,115,116,120,49,65,58,52,10,0,70,0,5,58,4,0,70,0,13,56,58,35,9,
+	0,226,1,0,5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,194,11,0,
+	1,7,0,34,0,1,7,0,226,20,0,1,9,0,162,8,0,17,41,163,58,58,8,0,
+	70,0,1,2,0,70,0,1,8,0,134,1,0,5,58,4,0,230,2,0,3,168,0,104,
+	0,3,24,0,84,0,53,164,26,161,57,147,151,146,146,36,154,135,71,39,4,0,80,0,
+	3,164,0,70,0,5,58,4,0,70,0,5,56,10,0,102,0,1,2,0,82,0,98,0,
+	5,25,7,0,194,3,0,1,9,0,130,8,0,5,23,9,0,226,11,0,1,7,0,29,
+	0,1,7,0,130,21,0,1,9,0,226,7,0,21,41,51,52,58,58,8,0,70,0,1,
+	2,0,70,0,1,8,0,134,1,0,5,58,4,0,198,2,0,19,168,68,135,23,74,0,
+	148,1,0,3,167,0,78,0,25,65,52,66,36,40,122,3,0,68,0,23,131,33,153,71,
+	135,71,0,70,0,5,56,10,0,134,1,0,19,170,35,25,145,113,0,194,3,0,1,9,
+	0,130,8,0,5,23,9,0,130,12,0,1,7,0,26,0,1,7,0,162,21,0,1,9,
+	0,162,7,0,3,41,0,102,0,13,52,58,58,8,0,70,0,1,2,0,70,0,1,8,
+	0,134,1,0,5,58,4,0,166,2,0,17,36,68,72,116,9,0,68,0,84,0,7,135,
+	56,0,80,0,91,33,147,36,164,116,18,51,116,74,122,147,132,138,51,56,58,68,136,163,
+	138,73,153,113,0,194,3,0,1,9,0,130,8,0,5,23,9,0,162,12,0,1,7,0,
+	27,0,1,7,0,194,21,0,1,9,0,226,6,0,3,41,0,166,1,0,13,52,58,58,
+	8,0,70,0,1,2,0,70,0,1,8,0,134,1,0,5,58,4,0,134,2,0,23,36,
+	68,72,116,41,51,0,72,0,45,137,167,74,115,131,24,73,122,36,71,132,2,0,78,0,
+	31,52,71,136,71,56,67,67,169,0,100,0,13,115,34,145,2,0,162,3,0,1,9,0,
+	130,8,0,5,23,9,0,194,12,0,1,7,0,28,0,1,7,0,226,21,0,1,9,0,
+	162,5,0,146,1,0,1,2,0,230,1,0,13,52,58,58,8,0,70,0,1,2,0,70,
+	0,1,8,0,134,1,0,5,58,4,0,230,1,0,17,36,68,72,39,2,0,102,0,29,
+	72,119,72,170,35,136,19,1,0,72,0,19,49,164,164,51,120,0,104,0,45,153,170,17,
+	73,67,73,72,33,151,152,25,10,0,130,3,0,1,9,0,130,8,0,5,23,9,0,226,
+	12,0,1,7,0,26,0,1,7,0,130,22,0,1,9,0,226,4,0,5,41,3,0,116,
+	0,134,2,0,13,52,58,58,8,0,70,0,1,2,0,70,0,1,8,0,134,1,0,5,
+	58,4,0,166,1,0,17,132,66,120,116,1,0,110,0,33,129,170,164,24,68,26,116,42,
+	7,0,66,0,71,114,148,19,121,19,50,163,148,116,33,132,33,135,20,145,115,137,170,0,
+	226,2,0,1,9,0,130,8,0,5,23,9,0,130,13,0,1,7,0,25,0,1,7,0,
+	162,22,0,1,9,0,194,4,0,7,57,67,0,70,0,1,10,0,134,2,0,13,52,58,
+	58,8,0,70,0,1,2,0,70,0,1,8,0,134,1,0,5,58,4,0,102,0,19,24,
+	66,132,121,116,0,66,0,113,41,50,67,131,145,116,131,25,168,51,17,71,113,169,152,119,
+	132,113,151,114,66,168,119,120,113,113,17,132,8,0,194,2,0,1,9,0,130,8,0,5,
+	23,9,0,162,13,0,1,7,0,22,0,1,7,0,194,22,0,1,9,0,162,4,0,9,
+	169,52,4,0,70,0,1,10,0,134,2,0,13,52,58,58,8,0,70,0,1,2,0,72,
+	0,78,0,21,136,163,67,136,151,10,0,72,0,129,1,167,114,23,20,71,51,72,42,151,
+	131,65,66,147,131,164,23,147,120,41,146,57,19,122,73,115,52,35,120,56,137,52,161,8,
+	0,162,2,0,1,9,0,130,8,0,5,23,9,0,194,13,0,1,7,0,17,0,1,7,
+	0,226,22,0,1,9,0,130,4,0,11,169,67,67,0,70,0,1,10,0,134,2,0,13,
+	52,58,58,8,0,70,0,169,1,154,18,67,19,52,122,58,164,131,56,56,154,25,52,34,
+	42,153,51,26,147,169,57,119,147,132,52,120,73,147,39,55,162,72,73,147,167,164,148,24,
+	146,114,138,2,0,130,2,0,1,9,0,130,8,0,5,23,9,0,226,13,0,1,7,0,
+	19,0,1,7,0,130,23,0,1,9,0,162,3,0,82,0,11,58,67,67,0,70,0,1,
+	10,0,134,2,0,13,52,58,58,8,0,70,0,80,0,161,1,19,161,135,131,56,65,151,
+	73,71,163,56,148,49,55,65,51,66,26,36,67,39,24,36,17,154,50,65,152,129,138,148,
+	147,119,169,18,33,41,52,113,138,2,0,226,1,0,1,9,0,130,8,0,5,23,9,0,
+	130,14,0,1,7,0,19,0,1,7,0,162,23,0,1,9,0,130,3,0,7,57,42,0,
+	70,0,5,52,4,0,70,0,1,10,0,134,2,0,161,1,52,58,74,55,131,145,145,120,
+	18,153,36,129,58,33,51,164,41,26,113,65,74,162,162,147,162,121,135,163,57,55,163,20,
+	20,19,74,56,148,17,169,23,2,0,66,0,17,147,136,49,130,2,0,194,1,0,1,9,
+	0,130,8,0,5,23,9,0,162,14,0,1,7,0,23,0,1,7,0,194,23,0,1,9,
+	0,226,2,0,9,169,56,2,0,70,0,5,52,4,0,70,0,1,10,0,134,2,0,57,
+	68,147,73,72,36,164,36,146,25,41,49,129,33,18,4,0,82,0,17,65,114,164,55,1,
+	0,100,0,61,55,122,162,74,19,168,36,40,41,153,138,116,56,39,145,9,0,70,0,29,
+	132,23,19,56,49,49,146,9,0,98,0,1,9,0,130,8,0,5,23,9,0,194,14,0,
+	1,7,0,15,0,1,7,0,226,23,0,1,9,0,194,2,0,11,169,131,35,0,70,0,
+	5,52,4,0,70,0,1,10,0,230,1,0,195,1,39,115,132,19,20,73,20,26,138,154,
+	51,154,154,152,151,130,162,34,115,153,122,148,65,120,26,121,151,147,50,41,71,65,154,114,
+	36,73,25,153,40,138,170,73,19,161,132,17,71,25,145,0,130,8,0,5,23,9,0,226,
+	14,0,1,7,0,17,0,1,7,0,130,24,0,1,9,0,162,2,0,13,169,51,56,2,
+	0,70,0,5,52,4,0,70,0,1,10,0,198,1,0,131,1,71,153,49,52,19,137,146,
+	132,120,153,24,51,58,68,138,131,66,40,167,42,169,151,40,49,161,49,146,167,52,164,145,
+	72,152,0,70,0,55,23,72,153,40,169,19,36,33,20,33,115,71,145,145,0,130,8,0,
+	5,23,9,0,130,15,0,1,7,0,19,0,1,7,0,162,24,0,1,9,0,130,2,0,
+	3,169,0,70,0,5,56,2,0,70,0,5,52,4,0,70,0,1,10,0,166,1,0,161,
+	1,71,39,49,151,35,55,23,115,152,115,65,161,65,33,42,147,113,129,52,115,56,57,163,
+	42,151,26,36,163,73,72,122,136,167,34,167,39,56,114,39,146,9,0,68,0,23,58,35,
+	67,114,151,146,0,130,8,0,5,23,9,0,162,15,0,1,7,0,22,0,1,7,0,194,
+	24,0,1,9,0,226,1,0,3,169,0,102,0,5,56,2,0,70,0,5,52,4,0,70,
+	0,1,10,0,134,1,0,3,71,0,66,0,1,3,0,78,0,68,0,167,1,113,164,121,
+	120,23,114,138,74,121,42,18,161,18,167,146,135,122,55,164,169,119,120,151,131,147,151,36,
+	36,35,41,120,132,24,167,122,132,132,152,168,113,148,147,0,226,7,0,5,23,9,0,194,
+	15,0,1,7,0,17,0,1,7,0,226,24,0,1,9,0,194,1,0,3,169,0,134,1,
+	0,5,56,2,0,70,0,5,52,4,0,70,0,1,10,0,102,0,193,1,164,17,162,119,
+	74,71,55,114,116,50,114,135,66,17,120,120,167,137,164,57,41,168,113,24,168,148,121,68,
+	33,129,145,26,114,122,138,148,35,40,148,145,66,24,116,65,154,164,154,35,9,0,162,7,
+	0,5,23,9,0,226,15,0,1,7,0,21,0,1,7,0,130,25,0,1,9,0,162,1,
+	0,3,169,0,166,1,0,5,56,2,0,70,0,5,52,4,0,70,0,1,10,0,70,0,
+	21,36,120,33,148,116,7,0,80,0,125,49,122,164,137,56,26,121,145,113,135,36,113,52,
+	74,52,161,73,114,169,153,74,36,67,148,122,66,20,55,153,34,170,8,0,98,0,31,52,
+	146,73,121,40,57,55,147,0,130,7,0,5,23,9,0,130,16,0,1,7,0,17,0,1,
+	7,0,162,25,0,1,9,0,130,1,0,3,169,0,198,1,0,5,56,2,0,70,0,5,
+	52,4,0,70,0,103,58,67,130,39,50,57,153,42,17,167,71,42,119,50,121,130,72,73,
+	40,18,41,147,52,152,162,35,0,70,0,89,42,41,35,115,56,33,148,41,114,51,49,55,
+	66,137,66,40,130,137,122,74,73,164,9,0,226,6,0,5,23,9,0,162,16,0,1,7,
+	0,17,0,1,7,0,194,25,0,1,9,0,98,0,3,169,0,230,1,0,5,56,2,0,
+	70,0,5,52,4,0,70,0,55,58,164,167,148,147,154,26,24,121,135,74,153,18,132,0,
+	84,0,137,1,51,167,36,36,114,163,114,25,40,120,51,164,121,26,167,121,114,146,35,137,
+	73,20,135,120,39,115,164,66,170,148,65,137,56,42,9,0,162,6,0,5,23,9,0,194,
+	16,0,1,7,0,20,0,1,7,0,226,25,0,1,9,0,66,0,3,169,0,134,2,0,
+	5,56,2,0,70,0,5,52,4,0,70,0,9,74,154,4,0,84,0,57,163,36,114,55,
+	66,51,135,67,137,138,152,25,33,163,1,0,84,0,117,116,55,49,24,152,119,120,169,135,
+	113,135,42,131,34,20,152,20,51,148,163,40,50,17,151,146,135,132,163,51,2,0,82,0,
+	162,5,0,5,23,9,0,226,16,0,1,7,0,17,0,1,7,0,130,26,0,9,25,145,
+	10,0,166,2,0,3,136,0,102,0,5,52,4,0,102,0,139,1,154,35,56,131,68,67,
+	42,24,33,50,67,151,132,169,20,120,68,19,152,130,57,42,113,34,167,71,146,135,148,55,
+	35,154,132,121,131,0,116,0,37,151,129,167,51,168,51,151,72,52,10,0,70,0,7,170,
+	147,0,130,5,0,5,23,9,0,130,17,0,1,7,0,15,0,1,7,0,162,26,0,7,
+	25,169,0,166,2,0,5,168,2,0,72,0,49,67,67,51,168,153,154,57,131,146,25,56,
+	170,1,0,82,0,1,2,0,80,0,149,1,154,161,20,148,169,120,25,65,23,66,170,41,
+	74,162,161,49,19,113,121,138,152,17,138,49,148,115,122,55,163,146,40,24,56,67,51,58,
+	168,9,0,226,4,0,5,23,9,0,162,17,0,1,7,0,13,0,1,7,0,194,26,0,
+	5,153,10,0,166,2,0,89,56,129,121,72,56,52,168,65,115,50,35,161,130,71,17,136,
+	170,65,72,33,36,55,8,0,82,0,85,42,57,55,116,74,58,151,23,34,65,119,164,71,
+	73,151,132,17,170,151,168,119,4,0,66,0,37,24,73,72,119,120,137,164,131,163,9,0,
+	194,4,0,5,23,9,0,194,17,0,1,7,0,13,0,1,7,0,226,26,0,3,162,0,
+	166,2,0,119,71,132,73,42,113,120,148,56,19,114,65,132,50,167,115,71,65,161,167,67,
+	41,33,56,23,153,161,154,113,146,33,0,104,0,25,113,114,131,56,145,145,4,0,80,0,
+	65,151,169,26,132,131,114,72,40,33,153,65,115,148,51,56,163,9,0,162,4,0,5,23,
+	9,0,226,17,0,1,7,0,13,0,1,7,0,226,26,0,5,50,10,0,134,2,0,161,
+	1,151,116,162,72,74,72,164,41,49,34,116,57,131,115,17,154,25,58,137,20,73,138,115,
+	145,34,19,49,161,167,168,145,169,58,152,55,121,50,71,58,25,8,0,84,0,47,131,40,
+	129,162,35,51,146,147,57,36,151,136,0,70,0,3,154,0,130,4,0,5,23,9,0,130,
+	18,0,1,7,0,14,0,1,7,0,194,25,0,132,1,0,7,170,163,0,230,1,0,163,
+	1,151,50,152,42,113,67,36,65,39,163,35,71,71,116,130,131,164,56,136,17,168,39,33,
+	73,58,121,41,67,41,72,138,148,18,145,57,58,55,42,164,23,52,0,78,0,45,19,52,
+	40,130,116,50,138,161,68,146,168,8,0,70,0,3,154,0,226,3,0,5,23,9,0,162,
+	18,0,1,7,0,13,0,1,7,0,194,25,0,3,130,0,70,0,9,58,58,10,0,198,
+	1,0,215,1,71,114,52,113,68,73,162,145,66,135,116,163,55,162,51,161,33,65,17,162,
+	71,136,26,161,168,24,146,68,34,131,18,41,146,67,116,66,67,34,122,136,66,167,18,49,
+	40,18,66,33,170,121,39,119,161,132,0,70,0,3,154,0,194,3,0,5,23,9,0,194,
+	18,0,1,7,0,13,0,1,7,0,194,25,0,5,50,8,0,70,0,9,58,58,10,0,
+	166,1,0,215,1,56,18,169,146,119,114,168,52,74,73,114,19,163,131,73,152,34,68,170,
+	25,130,68,138,24,57,20,129,131,19,57,33,50,135,33,66,162,119,72,40,57,151,119,170,
+	147,122,154,71,168,151,164,74,151,42,67,0,70,0,3,154,0,162,3,0,5,23,9,0,
+	226,18,0,1,7,0,19,0,1,7,0,194,25,0,7,50,131,0,70,0,9,58,58,10,
+	0,102,0,23,116,147,136,113,35,17,0,72,0,3,18,0,84,0,11,164,36,121,0,70,
+	0,159,1,138,121,152,168,148,138,170,66,67,151,115,65,39,170,51,36,17,146,68,49,152,
+	72,170,116,25,122,57,19,24,73,167,19,68,74,129,41,18,51,58,72,0,70,0,3,154,
+	0,130,3,0,5,23,9,0,130,19,0,1,7,0,15,0,1,7,0,194,25,0,1,2,
+	0,70,0,1,8,0,70,0,9,58,58,10,0,70,0,217,1,148,115,136,161,18,57,119,
+	18,167,131,115,39,131,68,40,137,55,116,162,39,57,148,35,26,130,36,138,51,164,33,55,
+	52,72,152,122,57,57,40,119,170,119,152,132,170,132,153,68,129,122,41,119,131,34,132,4,
+	0,70,0,3,154,0,226,2,0,5,23,9,0,162,19,0,1,7,0,17,0,1,7,0,
+	194,25,0,1,2,0,102,0,1,8,0,70,0,87,58,58,58,67,41,36,50,129,131,41,
+	50,168,51,152,116,164,164,52,152,19,19,131,0,66,0,103,57,164,36,50,26,114,49,120,
+	55,41,26,19,122,131,130,33,145,136,153,136,39,57,154,162,145,26,0,70,0,27,164,66,
+	55,135,168,74,72,0,70,0,3,154,0,194,2,0,5,23,9,0,194,19,0,1,7,0,
+	17,0,1,7,0,194,25,0,1,2,0,134,1,0,1,8,0,70,0,19,58,58,58,148,
+	115,0,70,0,113,137,20,73,35,148,138,35,113,130,24,130,68,55,34,19,119,147,138,121,
+	34,52,114,50,18,50,20,49,25,8,0,70,0,83,50,151,146,35,115,26,161,162,55,113,
+	167,65,132,19,18,115,58,35,162,51,72,0,70,0,3,154,0,162,2,0,5,23,9,0,
+	226,19,0,1,7,0,13,0,1,7,0,194,25,0,1,2,0,166,1,0,1,8,0,70,
+	0,227,1,58,58,74,137,34,163,33,49,23,71,18,163,132,151,40,120,169,121,74,145,169,
+	68,33,163,23,132,72,131,41,130,66,121,35,164,33,24,24,52,57,58,57,49,131,36,121,
+	57,132,18,49,50,73,17,55,57,35,52,72,0,70,0,3,154,0,130,2,0,5,23,9,
+	0,130,20,0,1,7,0,16,0,1,7,0,194,25,0,1,2,0,198,1,0,80,0,5,
+	55,8,0,66,0,51,26,119,163,41,116,33,65,55,66,19,42,56,34,0,70,0,157,1,
+	25,122,161,49,52,131,167,67,137,119,35,49,148,148,168,25,35,17,66,23,148,52,121,40,
+	17,58,58,18,68,26,39,18,163,120,161,167,119,116,120,8,0,70,0,3,154,0,226,1,
+	0,5,23,9,0,162,20,0,1,7,0,15,0,1,7,0,194,25,0,1,2,0,198,1,
+	0,85,39,162,136,74,24,136,74,52,116,34,120,26,56,114,154,162,68,74,130,137,169,4,
+	0,82,0,45,24,122,40,120,19,168,35,146,169,145,40,9,0,66,0,89,40,122,26,66,
+	74,50,35,135,51,130,114,26,120,40,17,138,42,135,19,137,68,120,8,0,70,0,3,154,
+	0,194,1,0,5,23,9,0,194,20,0,1,7,0,11,0,1,7,0,194,25,0,1,2,
+	0,198,1,0,233,1,55,152,41,35,74,145,130,72,120,132,122,41,65,57,50,162,67,119,
+	121,50,65,17,73,25,18,161,56,56,19,169,40,55,163,72,115,73,135,36,153,113,23,72,
+	18,161,74,114,120,116,170,148,147,164,25,58,73,34,35,116,8,0,70,0,3,154,0,162,
+	1,0,5,23,9,0,226,20,0,1,7,0,16,0,1,7,0,194,25,0,1,2,0,70,
+	0,104,0,27,168,121,33,153,152,169,71,0,80,0,141,1,114,56,20,58,57,145,66,25,
+	162,135,164,65,26,24,52,129,147,168,119,24,138,145,56,50,26,129,36,42,35,35,52,164,
+	129,113,66,2,0,114,0,49,164,71,168,18,49,58,71,73,17,169,119,50,8,0,70,0,
+	3,154,0,130,1,0,5,23,9,0,130,21,0,1,7,0,13,0,1,7,0,194,25,0,
+	1,2,0,70,0,165,1,148,18,51,151,35,66,42,50,132,138,147,131,19,20,120,153,168,
+	74,20,146,162,132,161,24,122,130,161,113,20,18,65,132,50,147,49,114,33,57,152,114,145,
+	9,0,72,0,69,49,19,18,71,114,132,73,136,58,35,74,40,24,66,55,26,49,8,0,
+	70,0,3,154,0,98,0,5,23,9,0,162,21,0,1,7,0,18,0,1,7,0,194,25,
+	0,1,2,0,70,0,41,148,152,33,26,50,33,162,129,170,161,2,0,82,0,61,42,73,
+	74,42,58,42,33,18,152,74,130,147,162,66,167,2,0,66,0,78,0,35,131,162,17,74,
+	40,73,24,49,154,0,98,0,39,114,67,58,153,131,161,34,169,116,116,0,72,0,29,115,
+	74,168,161,24,74,20,8,0,70,0,15,42,25,113,145,0,194,21,0,1,7,0,11,0,
+	1,7,0,194,25,0,1,2,0,70,0,207,1,68,71,135,119,113,52,147,120,161,114,113,
+	41,71,33,168,56,55,148,41,148,162,56,18,114,135,42,169,147,147,39,164,19,51,121,129,
+	41,146,19,71,67,120,42,36,135,121,24,66,42,131,17,168,115,0,66,0,25,56,72,36,
+	24,132,151,4,0,70,0,15,58,147,113,145,0,226,21,0,1,7,0,9,0,1,7,0,
+	194,25,0,1,2,0,70,0,205,1,23,113,135,68,114,161,114,168,52,35,161,167,122,34,
+	57,17,168,114,35,57,164,20,162,119,122,115,18,25,113,35,169,67,23,49,146,136,147,132,
+	114,50,71,36,41,41,19,145,152,33,51,41,153,2,0,66,0,47,154,119,50,131,138,66,
+	73,51,58,164,121,145,0,130,22,0,1,7,0,9,0,1,7,0,130,24,0,196,1,0,
+	70,0,101,55,72,132,74,50,147,66,137,34,148,168,148,35,36,113,50,17,120,35,135,66,
+	41,40,169,154,4,0,78,0,149,1,136,18,40,164,25,164,161,146,23,20,42,40,52,23,
+	55,50,114,23,40,162,169,131,72,148,19,137,137,18,40,23,23,167,73,163,67,163,17,9,
+	0,162,22,0,1,7,0,11,0,1,7,0,130,24,0,3,130,0,134,1,0,111,50,131,
+	122,56,119,17,23,33,66,25,129,151,50,164,41,56,68,113,41,148,51,168,52,154,168,18,
+	40,18,0,68,0,83,51,114,136,36,162,24,41,73,72,136,58,23,170,115,132,113,34,68,
+	120,57,40,0,80,0,53,52,25,138,121,39,74,55,115,122,164,67,51,42,9,0,194,22,
+	0,1,7,0,9,0,1,7,0,130,24,0,5,50,8,0,134,1,0,247,1,50,136,26,
+	55,57,24,18,121,145,50,74,115,23,52,146,24,56,146,138,42,163,73,148,50,113,151,145,
+	71,164,40,114,52,39,167,18,114,131,151,49,135,68,57,33,17,20,73,17,24,116,169,24,
+	131,147,115,26,114,33,120,34,36,40,67,0,102,0,3,154,0,194,22,0,1,7,0,17,
+	0,1,7,0,130,24,0,7,50,131,0,134,1,0,1,2,0,72,0,83,25,34,152,130,
+	23,151,68,138,168,65,169,17,170,52,33,120,55,66,19,154,41,0,78,0,35,19,130,131,
+	36,40,18,170,164,36,0,72,0,55,67,33,25,136,132,25,170,35,56,55,23,68,135,130,
+	0,84,0,41,121,49,36,169,18,34,135,17,168,71,4,0,134,1,0,3,154,0,194,22,
+	0,1,7,0,15,0,1,7,0,130,24,0,1,2,0,70,0,1,8,0,134,1,0,41,
+	138,146,18,114,20,51,34,131,36,116,3,0,78,0,161,1,131,130,147,137,116,68,55,115,
+	147,114,137,152,52,55,23,42,41,151,132,65,19,71,120,146,121,146,66,67,147,65,114,167,
+	56,154,71,25,162,148,56,41,10,0,102,0,23,122,56,119,36,55,138,0,134,1,0,3,
+	154,0,194,22,0,1,7,0,11,0,1,7,0,130,24,0,1,2,0,102,0,5,56,3,
+	0,72,0,239,1,19,57,132,40,163,17,52,33,154,67,33,72,113,19,138,170,23,50,138,
+	161,154,17,132,167,52,36,147,130,18,40,66,67,67,164,41,131,50,153,67,136,151,138,132,
+	34,138,164,145,39,39,49,162,138,40,17,68,65,56,35,163,132,0,134,1,0,3,154,0,
+	194,22,0,1,7,0,18,0,1,7,0,130,24,0,1,2,0,134,1,0,49,136,151,145,
+	164,74,56,132,52,19,114,152,56,1,0,70,0,41,135,147,148,23,121,138,164,163,66,121,
+	2,0,80,0,57,113,23,138,25,56,113,66,33,122,129,34,35,57,40,7,0,82,0,65,
+	65,161,40,151,131,161,18,66,50,71,34,41,151,42,148,120,10,0,78,0,68,0,3,132,
+	0,134,1,0,3,154,0,194,22,0,1,7,0,15,0,1,7,0,130,24,0,1,2,0,
+	134,1,0,7,168,25,0,68,0,25,71,115,56,167,25,58,2,0,82,0,43,113,116,161,
+	151,71,145,132,148,68,71,162,0,80,0,155,1,17,19,116,151,42,19,121,71,66,23,132,
+	41,136,58,170,130,50,25,40,152,129,55,145,163,20,68,138,168,121,18,113,138,120,151,65,
+	116,19,58,71,0,102,0,3,154,0,194,22,0,1,7,0,9,0,1,7,0,130,24,0,
+	1,2,0,134,1,0,251,1,120,154,17,119,148,58,119,129,18,36,36,137,119,131,137,34,
+	147,116,146,41,163,23,116,19,65,34,138,24,40,35,55,161,113,42,35,148,131,137,34,49,
+	36,119,65,36,152,167,114,67,131,153,66,41,168,131,162,131,20,36,50,72,58,130,73,0,
+	102,0,3,154,0,194,22,0,1,7,0,17,0,1,7,0,130,24,0,1,2,0,134,1,
+	0,47,120,147,18,119,114,65,136,20,137,33,33,57,0,82,0,5,167,2,0,84,0,49,
+	153,74,34,168,66,154,66,115,114,51,162,162,1,0,72,0,9,26,122,7,0,72,0,113,
+	114,51,65,138,116,40,152,164,130,67,73,162,161,138,56,66,20,26,51,50,138,148,121,58,
+	41,56,58,154,4,0,102,0,5,42,9,0,162,22,0,1,7,0,15,0,1,7,0,130,
+	24,0,1,2,0,134,1,0,23,120,73,136,147,25,49,0,82,0,77,74,42,129,169,130,
+	116,20,57,19,24,113,146,19,152,26,129,33,23,58,1,0,72,0,101,56,26,25,20,56,
+	33,68,119,130,41,136,18,152,119,57,132,41,146,66,131,148,138,72,25,148,9,0,68,0,
+	29,119,113,71,167,71,132,72,4,0,70,0,7,58,147,0,162,22,0,1,7,0,13,0,
+	1,7,0,130,24,0,1,2,0,134,1,0,19,120,152,135,19,35,0,70,0,5,41,4,
+	0,66,0,201,1,36,20,50,138,164,119,153,33,163,147,146,167,148,42,73,26,113,129,50,
+	146,130,163,169,39,137,19,18,65,116,121,136,68,39,152,55,116,73,168,164,163,66,52,151,
+	113,152,129,116,115,42,163,7,0,230,1,0,9,58,164,9,0,162,22,0,1,7,0,9,
+	0,1,7,0,130,24,0,1,2,0,102,0,243,1,116,132,71,148,23,25,51,114,72,136,
+	164,20,148,55,116,50,122,42,137,67,147,113,161,41,115,161,153,24,130,71,56,153,138,68,
+	153,72,56,72,65,152,74,137,42,71,39,56,49,19,154,73,116,50,18,162,121,57,40,162,
+	55,163,137,0,166,1,0,11,58,52,154,0,162,22,0,1,7,0,13,0,1,7,0,130,
+	24,0,1,2,0,102,0,19,148,55,164,152,51,0,84,0,159,1,40,57,39,35,20,167,
+	56,114,115,169,67,130,145,136,51,18,68,170,113,145,116,33,137,122,68,17,132,169,115,121,
+	73,50,58,35,58,145,122,114,50,72,0,70,0,53,72,40,49,68,19,74,138,132,147,72,
+	36,49,26,4,0,102,0,13,58,52,163,9,0,162,22,0,1,7,0,11,0,1,7,0,
+	130,24,0,1,2,0,102,0,133,1,55,50,19,169,120,49,55,164,167,136,55,74,131,39,
+	39,167,74,36,154,24,39,130,66,162,161,152,19,56,169,164,73,49,18,1,0,68,0,117,
+	55,122,153,115,135,147,161,26,114,138,66,42,49,116,42,121,65,115,36,74,25,138,41,49,
+	57,36,135,51,58,4,0,70,0,3,154,0,162,22,0,1,7,0,13,0,1,7,0,130,
+	24,0,1,2,0,102,0,37,135,73,23,136,119,113,73,135,23,10,0,82,0,153,1,122,
+	138,56,72,116,65,167,68,145,161,35,168,116,42,129,34,40,129,66,152,51,56,36,17,137,
+	161,169,151,25,145,72,74,167,168,20,42,119,58,3,0,80,0,51,161,119,137,138,35,68,
+	147,25,135,68,26,164,67,0,102,0,3,154,0,162,22,0,1,7,0,13,0,1,7,0,
+	130,24,0,1,2,0,102,0,169,1,148,121,148,147,74,162,121,136,65,42,138,154,121,153,
+	33,154,20,135,170,72,161,24,25,42,147,131,148,19,18,132,19,114,56,116,26,162,115,161,
+	154,120,129,23,9,0,136,1,0,57,162,58,49,68,34,138,146,36,163,135,168,36,58,25,
+	8,0,104,0,7,50,67,0,134,1,0,3,154,0,162,22,0,1,7,0,11,0,1,7,
+	0,130,24,0,1,2,0,70,0,45,52,74,56,74,161,52,120,33,25,57,40,2,0,66,
+	0,201,1,18,135,113,120,120,56,138,73,57,36,24,120,151,40,121,26,72,151,163,35,67,
+	67,56,34,52,26,67,56,33,23,152,138,41,130,164,17,26,19,67,169,42,65,50,34,122,
+	26,168,113,68,49,4,0,166,1,0,3,154,0,162,22,0,1,7,0,15,0,1,7,0,
+	130,24,0,79,50,67,163,51,52,122,136,129,41,163,71,51,34,115,164,50,114,42,132,36,
+	0,80,0,65,153,58,73,73,58,162,66,71,115,26,137,18,49,132,67,17,9,0,72,0,
+	61,74,153,152,113,26,131,116,164,161,56,25,65,72,73,154,10,0,100,0,3,24,0,82,
+	0,21,138,116,36,121,26,4,0,198,1,0,3,154,0,162,22,0,1,7,0,9,0,1,
+	7,0,130,24,0,9,50,52,10,0,70,0,243,1,52,122,25,51,24,67,49,26,71,167,
+	135,148,36,17,71,170,135,120,114,58,145,154,130,153,40,135,33,151,168,73,136,57,152,146,
+	131,57,162,136,57,168,132,65,113,131,147,74,146,152,130,147,119,147,74,129,147,24,50,113,
+	146,56,138,0,198,1,0,3,154,0,162,22,0,1,7,0,13,0,1,7,0,130,24,0,
+	7,66,163,0,70,0,109,52,36,55,72,66,55,19,164,153,42,147,39,116,162,40,71,152,
+	26,33,71,19,169,145,121,55,19,49,4,0,80,0,5,115,8,0,72,0,117,33,135,35,
+	113,164,137,57,162,145,20,65,24,113,66,58,58,163,146,119,122,161,131,138,130,145,71,26,
+	49,168,8,0,198,1,0,3,154,0,162,22,0,1,7,0,11,0,1,7,0,130,24,0,
+	5,162,10,0,70,0,85,52,138,71,146,152,68,138,49,74,24,151,135,114,55,52,154,122,
+	72,137,135,116,3,0,68,0,155,1,55,161,72,33,131,153,17,41,68,168,18,132,113,154,
+	132,42,49,132,65,120,36,73,41,131,41,130,148,25,23,146,26,24,136,164,23,113,17,68,
+	138,0,198,1,0,3,154,0,162,22,0,1,7,0,9,0,1,7,0,162,24,0,1,2,
+	0,70,0,249,1,52,58,138,71,67,25,167,52,146,49,145,56,131,36,55,52,146,58,129,
+	25,152,34,71,168,49,164,34,35,151,138,71,51,132,122,39,52,23,119,19,18,40,115,41,
+	39,20,131,73,154,24,35,137,138,67,72,17,138,167,122,34,119,164,164,8,0,198,1,0,
+	3,154,0,162,22,0,1,7,0,13,0,1,7,0,162,24,0,229,1,50,67,163,67,130,
+	113,67,163,49,17,34,55,116,120,152,65,65,153,71,74,19,138,116,72,170,51,138,113,50,
+	119,26,33,170,35,19,65,122,164,57,121,24,115,146,19,119,17,120,148,65,161,132,168,119,
+	129,35,41,24,8,0,78,0,1,9,0,84,0,1,8,0,70,0,5,40,4,0,198,1,
+	0,3,154,0,162,22,0,1,7,0,9,0,1,7,0,162,24,0,133,1,50,52,58,52,
+	55,116,33,151,116,121,42,50,49,39,57,73,36,35,68,152,35,41,51,17,115,163,17,25,
+	136,34,23,49,52,8,0,72,0,117,115,18,162,52,26,49,152,18,41,26,154,163,34,138,
+	18,72,168,135,161,34,132,115,39,168,24,74,146,145,24,4,0,198,1,0,3,154,0,162,
+	22,0,1,7,0,17,0,1,7,0,162,24,0,39,66,163,51,170,56,33,67,40,130,26,
+	0,70,0,21,114,52,137,147,167,4,0,70,0,49,137,18,33,20,58,17,138,113,18,67,
+	122,17,9,0,84,0,53,56,120,55,164,131,20,168,163,119,41,72,131,138,1,0,84,0,
+	13,20,170,119,8,0,68,0,47,33,40,65,58,152,132,71,135,154,147,129,65,0,198,1,
+	0,3,154,0,162,22,0,1,7,0,15,0,1,7,0,162,24,0,5,162,10,0,70,0,
+	123,119,136,35,152,162,152,135,116,167,66,72,170,116,148,162,36,116,162,24,67,20,161,50,
+	132,74,74,163,24,40,170,40,0,82,0,19,135,131,33,49,73,0,70,0,73,152,24,146,
+	25,154,17,50,119,50,116,56,129,115,58,146,162,164,162,4,0,114,0,9,146,138,4,0,
+	166,1,0,3,154,0,162,22,0,1,7,0,15,0,1,7,0,194,24,0,1,2,0,70,
+	0,121,40,163,162,33,148,19,40,167,115,161,148,113,36,71,130,145,132,39,74,138,57,40,
+	113,34,51,146,72,162,49,137,3,0,78,0,27,146,163,56,162,146,151,23,0,112,0,53,
+	26,51,50,138,115,66,56,115,49,162,55,50,17,9,0,72,0,25,119,51,73,23,119,152,
+	4,0,166,1,0,3,154,0,162,22,0,1,7,0,13,0,1,7,0,194,24,0,1,2,
+	0,70,0,107,168,17,121,67,58,40,154,52,42,131,74,131,71,26,154,135,162,145,73,41,
+	130,55,66,39,20,19,137,0,98,0,21,57,120,161,57,151,3,0,80,0,105,161,167,161,
+	42,137,161,58,36,129,36,148,154,131,51,154,114,135,129,148,71,131,162,24,41,161,147,4,
+	0,166,1,0,3,154,0,162,22,0,1,7,0,13,0,1,7,0,194,24,0,1,2,0,
+	70,0,47,52,115,18,66,65,58,164,114,66,17,153,71,0,98,0,179,1,121,151,39,119,
+	169,34,49,33,23,163,162,39,36,71,136,20,136,170,33,19,135,55,20,39,148,113,114,58,
+	33,33,121,162,17,163,67,55,161,52,114,72,71,73,122,148,25,0,80,0,7,119,68,0,
+	166,1,0,3,154,0,162,22,0,1,7,0,11,0,1,7,0,194,24,0,1,2,0,70,
+	0,121,20,138,148,19,34,129,66,137,137,65,151,136,147,162,20,169,51,73,57,137,18,168,
+	163,129,25,55,71,35,163,154,1,0,84,0,111,114,42,170,68,41,153,151,154,58,73,119,
+	116,72,115,138,131,168,25,39,132,36,131,25,42,132,146,51,132,0,198,2,0,3,154,0,
+	162,22,0,1,7,0,13,0,1,7,0,194,24,0,1,2,0,102,0,15,162,26,131,24,
+	0,84,0,93,23,136,132,17,36,17,163,114,41,138,135,153,55,137,65,72,19,115,116,68,
+	147,72,129,2,0,66,0,115,120,146,122,66,42,145,20,41,24,164,115,50,135,58,56,19,
+	122,41,74,19,26,151,152,148,138,26,119,33,132,0,198,2,0,3,154,0,162,22,0,1,
+	7,0,9,0,1,7,0,194,24,0,5,50,3,0,72,0,235,1,168,23,152,26,146,66,
+	36,50,20,56,153,163,168,154,131,66,26,25,148,164,17,56,135,114,135,170,148,132,148,136,
+	42,51,145,67,154,167,24,34,161,153,135,120,56,71,148,50,153,68,24,42,137,18,119,116,
+	23,40,68,42,130,0,198,2,0,3,154,0,162,22,0,1,7,0,8,0,1,7,0,226,
+	23,0,68,0,247,1,170,67,57,74,33,121,168,121,122,55,161,73,135,42,132,164,116,121,
+	17,132,42,40,121,146,74,34,122,72,164,168,55,17,66,57,74,162,40,145,138,119,145,169,
+	130,35,168,50,113,66,161,135,121,49,56,49,56,122,168,136,113,152,55,132,0,198,2,0,
+	3,154,0,162,22,0,1,7,0,11,0,1,7,0,226,23,0,49,130,163,163,148,120,153,
+	147,146,71,151,51,36,8,0,66,0,117,52,136,18,146,163,167,129,56,161,72,17,151,36,
+	121,52,135,74,170,49,169,116,168,135,42,52,36,138,167,132,10,0,70,0,75,49,33,55,
+	26,170,71,122,131,50,18,129,57,135,72,36,42,164,163,131,0,166,2,0,3,154,0,162,
+	22,0,1,7,0,9,0,1,7,0,226,23,0,73,50,56,58,146,136,154,121,23,34,33,
+	164,120,162,24,23,132,20,147,3,0,80,0,177,1,36,40,168,73,50,145,164,50,153,50,
+	154,65,146,67,18,74,116,151,163,50,116,121,129,120,137,58,170,136,151,40,136,65,114,26,
+	41,119,120,131,121,74,131,56,58,58,8,0,134,2,0,3,154,0,162,22,0,1,7,0,
+	17,0,1,7,0,226,23,0,99,50,131,52,147,136,42,167,169,154,122,35,167,121,130,129,
+	163,168,56,74,115,26,168,35,56,50,0,84,0,1,4,0,116,0,5,49,8,0,70,0,
+	15,137,51,129,17,0,70,0,3,164,0,70,0,99,138,51,135,151,20,72,167,42,121,26,
+	170,114,146,122,34,74,168,34,49,121,148,68,163,163,131,0,230,1,0,3,154,0,162,22,
+	0,1,7,0,15,0,1,7,0,226,23,0,79,50,131,18,161,116,73,170,25,154,67,170,
+	17,169,18,122,56,119,74,24,170,0,70,0,29,132,24,164,50,153,154,146,3,0,116,0,
+	45,56,132,50,131,74,52,135,145,18,132,19,7,0,72,0,39,146,161,74,34,129,115,35,
+	163,131,168,0,72,0,39,42,20,18,153,68,58,67,163,163,131,0,198,1,0,3,154,0,
+	162,22,0,1,7,0,11,0,1,7,0,226,23,0,41,50,131,122,58,164,56,131,73,113,
+	25,4,0,84,0,193,1,57,52,33,137,168,50,67,135,52,132,132,33,68,73,57,138,66,
+	132,24,120,115,34,163,18,114,72,35,18,55,137,130,138,33,24,23,114,121,122,145,19,26,
+	52,74,58,169,136,145,17,9,0,116,0,13,51,58,58,8,0,166,1,0,3,154,0,162,
+	22,0,1,7,0,11,0,1,7,0,226,23,0,225,1,50,131,122,55,52,116,129,148,163,
+	135,17,162,137,146,154,119,66,131,169,148,58,66,74,119,145,138,40,26,33,33,23,121,162,
+	35,136,161,35,153,146,19,129,25,148,147,65,136,137,132,148,137,161,71,138,130,50,115,9,
+	0,80,0,17,154,25,129,168,10,0,70,0,9,58,58,8,0,134,1,0,3,154,0,162,
+	22,0,1,7,0,11,0,1,7,0,226,23,0,1,2,0,70,0,241,1,26,66,52,34,
+	122,135,163,39,19,136,73,116,132,18,153,119,67,57,162,42,33,67,138,36,162,26,65,135,
+	151,18,49,49,120,148,49,50,19,168,169,151,151,72,57,57,49,33,35,33,58,35,52,23,
+	33,72,135,168,162,161,162,55,4,0,102,0,9,58,58,8,0,102,0,3,154,0,162,22,
+	0,1,7,0,11,0,1,7,0,226,23,0,1,2,0,70,0,239,1,74,161,26,119,136,
+	74,40,130,20,71,56,146,23,114,151,132,17,20,113,152,148,122,151,154,40,147,68,56,131,
+	146,42,116,36,20,116,34,138,39,122,167,154,113,135,135,114,24,25,19,58,121,153,65,168,
+	132,135,145,55,115,72,67,0,166,1,0,9,58,58,8,0,70,0,3,154,0,162,22,0,
+	1,7,0,9,0,1,7,0,226,23,0,7,50,131,0,68,0,231,1,132,122,148,152,120,
+	152,57,131,36,132,116,72,167,24,40,169,42,49,167,164,25,66,40,113,161,114,42,52,66,
+	51,68,24,161,169,131,42,33,132,137,57,19,56,52,50,73,135,147,33,72,169,131,20,114,
+	146,137,152,164,67,0,230,1,0,17,58,58,56,163,9,0,162,22,0,1,7,0,11,0,
+	1,7,0,226,23,0,7,50,131,0,66,0,5,68,9,0,80,0,217,1,129,170,73,130,
+	40,67,51,154,24,137,135,58,148,20,131,65,58,148,113,122,161,163,73,145,170,148,66,56,
+	138,19,35,152,41,24,36,17,66,19,164,153,26,71,26,66,51,169,167,41,40,136,164,49,
+	115,51,4,0,166,2,0,15,58,58,56,154,0,162,22,0,1,7,0,7,0,1,7,0,
+	226,23,0,241,1,50,131,34,67,42,154,145,36,56,120,120,24,33,33,120,58,52,135,24,
+	115,136,23,170,168,119,66,167,35,56,42,120,39,168,58,68,56,135,57,40,132,36,56,35,
+	19,71,17,42,153,148,55,168,168,51,168,154,136,20,153,113,52,4,0,230,2,0,13,58,
+	58,168,9,0,162,22,0,1,7,0,14,0,1,7,0,226,23,0,121,50,131,131,50,66,
+	168,161,163,129,151,148,56,132,164,168,135,132,114,164,132,24,119,41,148,137,147,137,114,122,
+	41,8,0,70,0,53,34,33,67,58,114,154,130,169,73,49,73,25,52,1,0,78,0,15,
+	120,170,51,122,0,72,0,23,137,121,114,151,151,52,0,72,0,166,3,0,11,58,170,147,
+	0,162,22,0,1,7,0,20,0,1,7,0,226,23,0,1,2,0,70,0,31,122,57,40,
+	23,114,167,72,130,0,78,0,45,162,41,152,130,71,20,113,24,72,58,39,7,0,82,0,
+	13,56,129,148,4,0,66,0,37,26,51,40,116,164,71,58,40,55,2,0,70,0,35,161,
+	20,71,163,18,36,120,152,147,0,72,0,33,120,58,164,66,164,132,114,74,8,0,230,3,
+	0,3,42,0,82,0,162,22,0,1,7,0,7,0,1,7,0,226,23,0,237,1,50,163,
+	153,168,154,145,58,25,23,50,119,161,67,153,120,68,120,58,33,65,154,170,57,169,122,148,
+	23,164,152,169,49,162,167,119,169,40,19,169,129,121,72,154,148,154,131,122,26,66,114,24,
+	67,164,132,49,116,58,73,136,113,8,0,230,3,0,3,154,0,130,23,0,1,7,0,7,
+	0,1,7,0,226,23,0,237,1,50,67,167,137,169,65,40,66,73,39,19,52,138,152,18,
+	42,26,136,115,72,25,65,26,167,161,129,51,132,20,147,148,20,115,168,20,164,167,73,145,
+	120,136,153,148,41,49,161,121,164,73,18,57,131,34,25,51,23,130,58,162,8,0,230,3,
+	0,3,154,0,130,23,0,1,7,0,7,0,1,7,0,226,23,0,237,1,50,67,17,40,
+	154,66,52,20,24,34,119,115,72,39,36,67,147,115,153,119,161,115,154,35,18,121,71,36,
+	71,24,145,18,41,20,23,137,116,136,66,137,131,138,114,131,73,52,40,120,72,40,131,58,
+	163,147,52,26,23,34,129,8,0,230,3,0,3,154,0,130,23,0,1,7,0,9,0,1,
+	7,0,226,23,0,75,50,67,35,152,115,162,120,55,115,26,122,163,129,36,154,131,146,154,
+	51,0,82,0,157,1,19,23,163,55,49,72,49,132,74,35,25,56,72,56,56,35,131,71,
+	42,152,23,129,145,35,130,145,71,120,56,35,121,67,168,163,74,164,154,19,51,8,0,198,
+	3,0,3,154,0,130,23,0,1,7,0,7,0,1,7,0,226,23,0,241,1,50,67,41,
+	152,115,42,42,130,129,39,23,132,58,67,19,119,148,49,114,152,169,147,121,152,57,26,130,
+	50,137,129,148,74,33,130,115,41,71,66,40,148,56,161,161,36,57,57,35,24,138,169,121,
+	163,20,151,131,116,35,74,74,58,8,0,166,3,0,3,154,0,130,23,0,1,7,0,13,
+	0,1,7,0,226,23,0,19,50,52,74,120,72,0,68,0,61,20,36,136,145,65,20,49,
+	24,24,152,161,56,73,18,114,1,0,84,0,63,68,147,120,131,24,52,17,131,135,23,39,
+	39,57,168,42,152,0,68,0,79,39,148,116,65,73,56,71,147,152,132,58,152,152,113,169,
+	161,74,130,163,131,0,134,3,0,3,154,0,130,23,0,1,7,0,9,0,1,7,0,226,
+	23,0,183,1,66,163,163,34,122,57,122,41,169,148,167,68,51,66,51,65,19,151,121,138,
+	66,170,146,146,115,40,56,71,40,56,52,162,25,162,66,153,65,120,136,26,169,35,67,161,
+	72,153,0,78,0,55,129,131,74,167,50,19,151,164,20,18,33,136,163,131,0,230,2,0,
+	3,154,0,130,23,0,1,7,0,11,0,1,7,0,226,23,0,45,162,58,67,170,148,55,
+	68,121,17,41,56,2,0,114,0,123,36,39,35,161,33,135,39,130,57,39,161,26,115,52,
+	168,65,52,120,42,57,113,132,26,55,35,35,130,35,42,74,42,0,112,0,61,51,121,42,
+	52,73,114,71,35,148,163,132,65,73,52,58,8,0,198,2,0,3,154,0,130,23,0,1,
+	7,0,11,0,1,7,0,130,24,0,1,2,0,102,0,49,72,116,164,34,163,39,131,113,
+	168,148,56,58,7,0,72,0,181,1,169,35,20,67,56,74,41,17,74,131,131,138,26,67,
+	71,154,57,36,120,65,74,168,42,26,169,65,49,154,113,33,113,65,137,115,136,26,137,20,
+	34,35,36,148,52,52,58,8,0,166,2,0,3,154,0,130,23,0,1,7,0,11,0,1,
+	7,0,130,24,0,1,2,0,134,1,0,49,135,115,52,137,146,137,41,35,41,50,42,162,
+	2,0,70,0,181,1,71,136,121,162,42,68,121,52,161,168,113,42,74,163,129,18,57,129,
+	114,73,163,122,120,56,170,23,121,152,115,73,151,52,58,71,51,68,113,56,147,71,130,72,
+	51,52,58,8,0,134,2,0,3,154,0,130,23,0,1,7,0,13,0,1,7,0,130,24,
+	0,1,2,0,134,1,0,57,132,161,41,163,151,71,147,145,113,19,161,18,129,51,9,0,
+	78,0,157,1,19,18,25,49,132,72,148,120,121,25,120,25,72,23,135,24,74,146,116,162,
+	67,56,36,19,42,121,36,20,42,55,25,56,132,26,138,67,135,73,74,9,0,102,0,9,
+	52,58,8,0,230,1,0,3,154,0,130,23,0,1,7,0,13,0,1,7,0,130,24,0,
+	1,2,0,102,0,41,138,161,136,36,131,145,39,56,114,65,1,0,80,0,179,1,113,146,
+	169,67,71,163,33,135,33,162,162,73,115,57,121,73,122,114,23,170,135,135,18,146,168,74,
+	152,39,131,36,131,18,130,114,131,74,151,18,18,25,119,68,114,137,161,0,70,0,9,52,
+	58,8,0,198,1,0,3,154,0,130,23,0,1,7,0,17,0,1,7,0,130,24,0,1,
+	2,0,70,0,71,58,132,135,40,116,55,36,72,138,51,26,50,18,73,71,23,66,121,0,
+	116,0,1,9,0,72,0,99,23,122,18,24,57,19,73,131,36,20,49,116,68,73,135,26,
+	154,49,138,129,138,161,68,67,153,0,112,0,35,147,71,73,36,65,154,135,67,36,0,70,
+	0,9,52,58,8,0,166,1,0,3,154,0,130,23,0,1,7,0,11,0,1,7,0,130,
+	24,0,89,50,163,67,67,163,36,116,169,25,24,116,17,135,74,152,116,121,55,135,17,163,
+	20,1,0,80,0,145,1,39,138,51,148,114,35,169,151,161,131,34,152,121,151,129,24,132,
+	73,39,24,164,113,151,148,161,135,71,115,114,51,146,137,113,41,66,52,2,0,70,0,9,
+	52,58,8,0,134,1,0,3,154,0,130,23,0,1,7,0,9,0,1,7,0,130,24,0,
+	243,1,50,58,52,52,58,36,116,114,161,135,17,18,39,153,33,24,36,24,51,56,119,152,
+	116,164,57,148,131,153,129,119,131,40,162,145,67,58,56,153,20,145,18,35,51,72,34,122,
+	154,136,145,151,146,42,25,148,170,137,25,116,40,52,35,0,70,0,9,52,58,8,0,102,
+	0,3,154,0,130,23,0,1,7,0,11,0,1,7,0,130,24,0,237,1,162,67,67,163,
+	51,20,74,65,151,52,34,145,24,23,41,122,120,50,18,73,131,116,65,57,148,49,137,26,
+	130,169,40,18,56,164,120,67,151,129,58,119,17,56,20,55,113,41,66,65,161,152,132,164,
+	120,130,17,147,71,122,40,4,0,70,0,1,2,0,70,0,9,52,58,8,0,70,0,3,
+	154,0,130,23,0,1,7,0,13,0,1,7,0,226,23,0,15,153,74,67,163,0,102,0,
+	61,120,121,26,115,170,152,33,19,115,161,148,24,135,161,42,7,0,68,0,147,1,161,20,
+	169,67,67,114,24,71,168,131,162,56,67,121,145,132,35,19,161,168,136,42,167,119,20,19,
+	49,135,138,72,147,19,151,39,153,35,65,0,102,0,1,2,0,70,0,17,52,58,56,163,
+	9,0,130,23,0,1,7,0,13,0,1,7,0,194,23,0,15,25,57,67,163,0,166,1,
+	0,199,1,148,164,129,33,58,42,167,162,72,24,72,122,153,154,25,39,66,162,18,71,152,
+	67,154,68,120,152,162,51,17,50,74,120,113,19,36,116,129,170,66,120,116,66,17,20,19,
+	119,115,72,58,72,0,110,0,72,0,134,1,0,1,2,0,70,0,15,52,58,56,154,0,
+	130,23,0,1,7,0,13,0,1,7,0,162,23,0,15,25,39,67,163,0,198,1,0,197,
+	1,148,71,113,23,148,138,56,68,119,66,130,132,169,130,65,52,137,164,55,65,58,49,154,
+	163,164,169,135,148,24,121,36,40,26,153,145,129,67,164,51,36,132,24,115,65,55,24,164,
+	151,24,4,0,230,1,0,1,4,0,134,1,0,1,2,0,70,0,13,52,58,168,9,0,
+	130,23,0,1,7,0,13,0,1,7,0,130,23,0,15,25,23,66,163,0,230,1,0,197,
+	1,148,121,116,113,138,74,52,114,72,116,146,170,152,52,66,138,18,120,26,34,113,151,40,
+	164,120,147,148,146,72,33,153,67,170,24,52,68,33,113,42,40,130,152,154,138,122,40,73,
+	114,71,4,0,134,2,0,1,4,0,134,1,0,1,2,0,70,0,11,52,170,147,0,130,
+	23,0,1,7,0,14,0,1,7,0,226,22,0,15,25,23,33,170,0,134,2,0,199,1,
+	55,72,168,164,153,18,57,146,168,132,19,57,20,132,170,50,49,129,129,163,151,74,136,154,
+	152,55,72,130,147,152,58,132,122,36,151,71,20,20,65,136,33,122,130,58,39,73,121,68,
+	169,67,0,134,2,0,1,4,0,134,1,0,1,2,0,84,0,3,35,0,82,0,130,23,
+	0,1,7,0,22,0,1,7,0,194,22,0,5,25,7,0,98,0,1,2,0,166,2,0,
+	59,135,146,170,167,50,169,71,167,154,132,135,58,52,122,40,0,72,0,1,7,0,80,0,
+	55,74,115,19,161,39,119,68,74,19,51,114,152,49,132,0,78,0,31,122,17,137,129,113,
+	20,58,116,0,66,0,27,18,131,131,116,122,36,67,0,134,2,0,1,4,0,102,0,1,
+	10,0,146,1,0,226,23,0,1,7,0,13,0,1,7,0,162,22,0,5,25,7,0,130,
+	1,0,1,2,0,166,2,0,203,1,151,50,34,170,115,73,25,119,20,55,66,170,72,131,
+	169,132,35,39,129,49,26,67,20,116,129,19,35,58,121,148,25,24,151,169,65,19,113,163,
+	41,162,49,65,50,131,34,17,55,34,56,35,67,0,134,2,0,1,4,0,70,0,3,154,
+	0,226,24,0,1,7,0,17,0,1,7,0,130,22,0,5,25,7,0,162,1,0,1,2,
+	0,134,2,0,65,72,116,136,169,135,51,129,35,39,163,152,130,35,152,19,19,7,0,82,
+	0,59,35,23,163,136,33,23,120,74,72,116,42,67,57,152,25,0,102,0,55,20,39,129,
+	146,33,154,74,58,116,17,40,130,115,132,0,70,0,5,50,4,0,134,2,0,9,52,163,
+	9,0,226,24,0,1,7,0,17,0,1,7,0,226,21,0,5,25,7,0,194,1,0,1,
+	2,0,230,1,0,1,8,0,102,0,9,132,163,10,0,70,0,173,1,68,39,129,24,18,
+	130,24,119,147,113,162,71,52,132,161,56,163,65,168,65,146,151,20,58,164,122,72,19,35,
+	151,132,72,24,161,131,122,168,25,23,50,168,122,58,8,0,70,0,5,50,4,0,134,2,
+	0,7,52,154,0,226,24,0,1,7,0,21,0,1,7,0,194,21,0,5,25,7,0,226,
+	1,0,1,2,0,198,1,0,1,8,0,70,0,51,74,73,131,120,23,170,49,154,131,138,
+	73,121,168,0,114,0,61,26,161,145,162,25,120,74,20,116,73,163,163,130,57,145,10,0,
+	66,0,45,164,121,39,120,135,19,163,50,168,151,147,4,0,80,0,15,145,135,163,131,0,
+	70,0,5,50,4,0,134,2,0,5,164,9,0,226,24,0,1,7,0,15,0,1,7,0,
+	162,21,0,5,25,7,0,130,2,0,1,2,0,166,1,0,1,8,0,70,0,199,1,58,
+	52,119,153,131,146,137,42,74,41,119,114,122,74,51,49,39,170,147,116,24,114,114,120,40,
+	136,66,145,68,67,20,56,55,73,55,58,147,119,50,58,26,136,39,114,74,49,146,68,163,
+	131,0,70,0,5,50,4,0,166,2,0,1,9,0,226,24,0,1,7,0,17,0,1,7,
+	0,130,21,0,5,25,7,0,162,2,0,1,2,0,134,1,0,1,8,0,70,0,131,1,
+	58,115,135,57,137,23,136,41,147,170,114,145,170,52,72,57,132,39,137,116,18,169,121,19,
+	168,129,68,51,145,115,130,137,113,0,82,0,65,49,26,114,74,121,152,154,57,55,131,19,
+	153,148,52,52,58,8,0,70,0,5,50,4,0,230,1,0,3,146,0,226,24,0,1,7,
+	0,15,0,1,7,0,226,20,0,5,25,7,0,194,2,0,1,2,0,102,0,1,8,0,
+	70,0,207,1,58,74,73,147,114,71,34,169,137,152,152,148,39,55,67,137,72,164,163,168,
+	151,66,163,147,147,73,148,49,164,23,136,153,40,170,57,73,113,68,51,68,67,26,116,55,
+	145,146,23,145,52,67,163,131,0,70,0,5,50,4,0,166,1,0,3,146,0,130,25,0,
+	1,7,0,17,0,1,7,0,194,20,0,5,25,7,0,226,2,0,1,2,0,70,0,1,
+	8,0,70,0,193,1,58,58,136,42,39,147,56,169,169,138,163,35,25,25,66,121,41,167,
+	161,33,114,114,114,153,58,66,40,39,130,40,67,148,72,26,163,167,26,169,67,163,67,115,
+	18,65,25,136,17,136,10,0,102,0,9,52,58,8,0,70,0,5,50,4,0,102,0,3,
+	146,0,162,25,0,1,7,0,13,0,1,7,0,162,20,0,5,25,7,0,130,3,0,7,
+	50,131,0,70,0,199,1,58,58,56,36,138,162,50,137,23,51,56,49,39,20,66,129,40,
+	71,23,154,39,66,34,154,50,116,58,33,19,151,34,116,164,36,23,52,145,151,36,67,163,
+	67,51,116,148,168,58,162,55,40,0,70,0,9,52,58,8,0,70,0,13,50,52,35,9,
+	0,194,25,0,1,7,0,17,0,1,7,0,130,20,0,5,25,7,0,162,3,0,5,50,
+	8,0,70,0,37,58,58,56,67,161,114,167,72,18,7,0,82,0,67,138,131,132,167,74,
+	74,40,42,168,74,51,114,145,167,26,132,72,0,78,0,85,35,36,36,169,135,113,26,57,
+	121,52,50,52,58,52,58,72,132,72,74,153,56,2,0,70,0,9,52,58,8,0,70,0,
+	9,162,35,9,0,226,25,0,1,7,0,14,0,1,7,0,226,19,0,5,25,7,0,194,
+	3,0,3,130,0,70,0,9,58,58,8,0,70,0,191,1,122,66,35,115,20,33,73,66,
+	57,72,56,169,115,163,162,26,120,42,145,56,58,52,129,33,132,121,34,116,122,151,72,119,
+	137,130,121,67,35,67,163,67,163,67,163,67,51,170,68,35,0,70,0,15,52,58,56,163,
+	0,82,0,130,26,0,1,7,0,18,0,1,7,0,194,19,0,5,25,7,0,226,3,0,
+	132,1,0,7,170,131,0,70,0,19,58,131,132,33,115,0,114,0,99,52,52,65,67,164,
+	18,129,113,35,51,52,36,113,135,72,50,170,20,20,67,23,74,168,18,57,0,68,0,49,
+	138,18,56,52,50,52,58,52,58,52,58,52,10,0,70,0,5,52,2,0,70,0,15,52,
+	58,56,154,0,194,26,0,1,7,0,19,0,1,7,0,162,19,0,5,25,7,0,162,5,
+	0,5,50,8,0,70,0,1,10,0,70,0,15,58,67,116,55,0,82,0,69,164,51,68,
+	66,55,122,113,113,169,163,116,170,162,119,153,146,116,3,0,82,0,81,113,65,138,116,34,
+	40,57,67,40,130,51,52,50,52,58,52,58,52,58,52,10,0,70,0,5,52,2,0,70,
+	0,13,52,58,168,9,0,194,26,0,1,7,0,23,0,1,7,0,130,19,0,5,25,7,
+	0,194,5,0,3,130,0,70,0,1,10,0,70,0,1,10,0,134,1,0,5,74,2,0,
+	72,0,9,170,40,4,0,84,0,99,56,49,152,50,167,72,39,40,68,73,36,41,115,73,
+	41,168,153,120,49,163,23,23,66,115,137,0,70,0,37,52,50,52,58,52,58,52,58,52,
+	10,0,70,0,5,52,2,0,70,0,11,52,170,147,0,194,26,0,1,7,0,17,0,1,
+	7,0,226,18,0,5,25,7,0,226,5,0,132,1,0,7,58,163,0,134,1,0,131,1,
+	58,136,116,23,67,35,161,25,49,167,39,147,115,20,50,147,18,122,65,72,161,167,130,36,
+	55,56,74,72,138,74,72,136,68,0,70,0,37,52,50,52,58,52,58,52,58,52,10,0,
+	70,0,5,52,2,0,84,0,3,35,0,82,0,194,26,0,1,7,0,18,0,1,7,0,
+	194,18,0,5,25,7,0,162,7,0,5,162,10,0,134,1,0,45,58,56,58,74,50,67,
+	147,163,65,146,114,10,0,82,0,53,71,41,33,122,130,130,147,145,154,122,168,65,154,4,
+	0,68,0,23,42,42,120,132,168,67,0,70,0,37,52,50,52,58,52,58,52,58,52,10,
+	0,70,0,3,164,0,146,1,0,162,27,0,1,7,0,17,0,1,7,0,162,18,0,5,
+	25,7,0,226,7,0,1,2,0,134,1,0,35,58,56,58,58,39,68,135,169,41,0,70,
+	0,45,167,131,121,55,41,17,120,55,25,56,19,7,0,70,0,45,152,23,33,36,55,154,
+	65,73,122,55,58,4,0,70,0,35,52,50,52,58,52,58,52,58,164,0,132,1,0,1,
+	9,0,162,28,0,1,7,0,16,0,1,7,0,130,18,0,5,25,7,0,130,8,0,1,
+	2,0,102,0,63,58,56,58,58,132,40,122,35,148,161,35,132,25,120,162,33,0,72,0,
+	73,65,163,39,121,135,17,72,145,49,145,34,163,33,41,71,113,51,58,4,0,70,0,27,
+	52,50,52,58,52,58,164,0,68,0,162,1,0,1,9,0,130,28,0,1,7,0,16,0,
+	1,7,0,226,17,0,5,25,7,0,130,8,0,127,162,58,163,131,163,163,67,131,72,26,
+	129,51,18,164,161,65,56,55,33,68,19,169,72,17,40,115,34,169,71,66,49,72,0,78,
+	0,7,40,68,0,134,1,0,5,58,4,0,70,0,19,52,50,52,58,164,0,68,0,162,
+	2,0,1,9,0,226,27,0,1,7,0,16,0,1,7,0,194,17,0,5,25,7,0,130,
+	8,0,53,162,51,170,67,42,170,67,67,161,146,147,40,115,3,0,80,0,85,52,25,34,
+	161,167,72,170,24,136,114,163,57,121,136,122,17,68,50,153,56,58,4,0,134,1,0,5,
+	58,4,0,70,0,11,52,50,164,0,68,0,162,3,0,1,9,0,194,27,0,1,7,0,
+	18,0,1,7,0,162,17,0,5,25,7,0,130,8,0,3,162,0,70,0,9,170,163,2,
+	0,84,0,123,163,58,66,23,114,26,65,113,66,132,137,153,154,68,161,67,17,170,132,65,
+	51,136,18,33,120,137,72,147,40,36,67,0,134,1,0,5,58,4,0,70,0,3,52,0,
+	68,0,162,4,0,1,9,0,162,27,0,1,7,0,22,0,1,7,0,130,17,0,5,25,
+	7,0,130,8,0,3,162,0,70,0,9,58,163,10,0,102,0,84,0,45,164,131,151,73,
+	119,164,131,154,72,25,65,4,0,80,0,23,135,164,120,66,162,148,0,78,0,37,163,121,
+	18,23,34,148,40,52,50,4,0,134,1,0,5,58,4,0,70,0,3,36,0,130,5,0,
+	1,9,0,130,27,0,1,7,0,17,0,1,7,0,226,16,0,5,25,7,0,130,8,0,
+	3,162,0,70,0,1,10,0,230,2,0,95,136,39,67,24,130,146,58,170,49,170,73,121,
+	132,72,136,35,132,50,35,52,129,68,115,24,0,84,0,19,68,33,52,35,67,0,134,1,
+	0,13,58,52,163,2,0,162,5,0,1,9,0,226,26,0,1,7,0,19,0,1,7,0,
+	194,16,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,134,3,0,39,136,35,
+	17,67,55,169,65,56,147,58,0,84,0,65,131,161,58,135,41,151,138,131,56,148,40,113,
+	24,55,168,122,4,0,70,0,5,50,4,0,134,1,0,9,58,164,2,0,226,5,0,1,
+	9,0,194,26,0,1,7,0,18,0,1,7,0,162,16,0,5,25,7,0,130,8,0,3,
+	162,0,70,0,1,10,0,134,2,0,123,68,119,116,167,113,25,20,147,20,35,164,120,74,
+	132,132,164,67,71,130,135,151,147,55,131,58,162,66,116,52,50,67,0,70,0,5,50,4,
+	0,102,0,1,10,0,68,0,162,6,0,1,9,0,162,26,0,1,7,0,19,0,1,7,
+	0,130,16,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,166,2,0,7,148,
+	51,0,82,0,25,42,146,24,130,66,18,9,0,80,0,79,71,73,131,20,162,20,147,130,
+	71,58,56,147,35,161,163,56,164,161,164,67,0,70,0,13,50,52,163,2,0,162,7,0,
+	1,9,0,130,26,0,1,7,0,15,0,1,7,0,226,15,0,5,25,7,0,130,8,0,
+	3,162,0,70,0,1,10,0,198,2,0,127,148,23,23,115,17,57,146,167,161,26,169,49,
+	71,153,26,72,17,131,56,167,66,130,115,147,20,18,161,138,72,146,163,67,0,70,0,9,
+	50,164,2,0,226,7,0,1,9,0,226,25,0,1,7,0,15,0,1,7,0,194,15,0,
+	5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,230,2,0,129,1,132,35,41,120,
+	162,19,169,154,56,24,146,57,25,151,115,151,138,41,17,39,51,162,24,19,74,122,145,24,
+	132,55,56,58,4,0,70,0,68,0,162,8,0,1,9,0,194,25,0,1,7,0,13,0,
+	1,7,0,162,15,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,134,3,0,
+	137,1,132,113,18,66,24,148,33,115,138,39,41,24,25,161,57,68,167,51,162,136,20,73,
+	71,113,163,66,170,130,115,168,71,163,67,51,2,0,130,9,0,1,9,0,162,25,0,1,
+	7,0,13,0,1,7,0,130,15,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,
+	0,166,3,0,137,1,148,74,41,50,68,42,50,19,154,169,40,65,33,131,72,49,19,66,
+	137,146,147,50,122,57,119,18,35,19,113,120,169,51,58,52,2,0,162,9,0,1,9,0,
+	130,25,0,1,7,0,19,0,1,7,0,226,14,0,5,25,7,0,130,8,0,3,162,0,
+	70,0,1,10,0,198,3,0,47,148,23,20,41,138,33,164,33,42,146,42,121,0,82,0,
+	19,72,168,71,23,151,0,72,0,43,58,19,138,71,121,23,116,25,73,115,169,0,70,0,
+	7,58,36,0,194,9,0,1,9,0,226,24,0,1,7,0,19,0,1,7,0,194,14,0,
+	5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,198,3,0,25,24,138,121,49,58,
+	167,10,0,102,0,41,56,26,116,26,20,169,129,68,58,23,10,0,70,0,43,136,164,152,
+	40,135,131,137,116,73,35,72,0,102,0,5,170,2,0,226,9,0,1,9,0,194,24,0,
+	1,7,0,15,0,1,7,0,162,14,0,5,25,7,0,130,8,0,3,162,0,70,0,1,
+	10,0,198,3,0,125,116,19,52,39,137,131,73,71,58,52,147,154,39,26,163,129,119,68,
+	25,148,113,50,113,154,68,137,137,33,72,19,25,4,0,166,1,0,1,2,0,162,10,0,
+	1,9,0,162,24,0,1,7,0,15,0,1,7,0,130,14,0,5,25,7,0,130,8,0,
+	3,162,0,70,0,1,10,0,198,3,0,125,132,57,18,115,25,71,152,65,162,74,41,130,
+	119,138,20,163,55,152,168,136,34,72,66,36,152,113,170,18,148,73,35,8,0,198,1,0,
+	1,2,0,194,10,0,1,9,0,130,24,0,1,7,0,15,0,1,7,0,226,13,0,5,
+	25,7,0,130,8,0,3,162,0,70,0,1,10,0,230,3,0,125,148,20,122,24,161,116,
+	136,148,57,151,51,152,120,148,152,56,40,163,162,146,119,49,20,25,131,25,35,163,116,58,
+	55,8,0,198,1,0,1,2,0,226,10,0,1,9,0,226,23,0,1,7,0,16,0,1,
+	7,0,194,13,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,198,3,0,72,
+	0,125,153,19,136,33,58,72,24,52,121,137,17,52,19,73,56,167,138,161,137,23,41,132,
+	67,147,17,41,152,49,40,40,116,4,0,166,1,0,1,2,0,130,11,0,1,9,0,194,
+	23,0,1,7,0,17,0,1,7,0,162,13,0,5,25,7,0,130,8,0,3,162,0,70,
+	0,1,10,0,230,3,0,25,148,66,122,20,39,136,4,0,70,0,99,26,34,136,122,151,
+	20,164,56,119,58,167,120,115,114,169,18,58,121,146,73,114,113,129,162,73,0,166,1,0,
+	1,2,0,162,11,0,1,9,0,162,23,0,1,7,0,18,0,1,7,0,130,13,0,5,
+	25,7,0,130,8,0,3,162,0,70,0,1,10,0,198,3,0,72,0,59,153,122,72,39,
+	67,52,163,40,56,132,129,17,136,147,129,0,102,0,61,58,135,23,145,119,136,162,35,35,
+	130,35,146,25,52,138,8,0,166,1,0,1,2,0,194,11,0,1,9,0,130,23,0,1,
+	7,0,21,0,1,7,0,226,12,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,
+	0,230,3,0,65,148,66,122,131,116,50,71,170,65,163,49,169,114,41,145,138,4,0,134,
+	1,0,5,58,4,0,70,0,33,152,39,50,148,113,52,121,49,3,0,84,0,9,147,58,
+	8,0,134,1,0,1,2,0,226,11,0,1,9,0,226,22,0,1,7,0,20,0,1,7,
+	0,194,12,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,198,3,0,72,0,
+	63,153,122,72,116,65,65,168,35,122,73,56,135,145,119,137,73,0,166,1,0,47,58,164,
+	138,71,18,35,114,151,17,152,168,121,0,72,0,7,163,131,0,102,0,1,2,0,130,12,
+	0,1,9,0,194,22,0,1,7,0,21,0,1,7,0,162,12,0,5,25,7,0,130,8,
+	0,3,162,0,70,0,1,10,0,230,3,0,69,148,66,122,131,68,55,115,66,129,74,170,
+	116,36,168,58,163,146,4,0,198,1,0,1,10,0,70,0,35,20,119,68,154,52,40,18,
+	170,129,0,102,0,9,52,58,8,0,70,0,1,2,0,162,12,0,1,9,0,162,22,0,
+	1,7,0,26,0,1,7,0,130,12,0,5,25,7,0,130,8,0,3,162,0,70,0,1,
+	10,0,198,3,0,72,0,9,153,122,8,0,136,1,0,39,130,154,168,148,71,36,135,33,
+	72,136,0,104,0,230,1,0,1,10,0,70,0,176,1,0,3,68,0,102,0,104,0,166,
+	1,0,15,52,58,56,35,0,194,12,0,1,9,0,130,22,0,1,7,0,21,0,1,7,
+	0,226,11,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,230,3,0,15,148,
+	66,122,131,0,72,0,15,23,40,131,164,0,66,0,15,50,72,67,65,0,230,3,0,1,
+	10,0,134,6,0,13,52,58,56,2,0,226,12,0,1,9,0,226,21,0,1,7,0,20,
+	0,1,7,0,194,11,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,198,3,
+	0,72,0,37,153,122,72,132,56,40,146,148,34,3,0,84,0,13,135,129,26,4,0,134,
+	4,0,1,10,0,134,6,0,11,52,58,40,0,130,13,0,1,9,0,194,21,0,1,7,
+	0,20,0,1,7,0,162,11,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,
+	230,3,0,43,148,66,122,131,68,152,18,34,36,113,154,0,116,0,13,71,120,130,4,0,
+	134,4,0,1,10,0,134,6,0,3,164,0,68,0,162,13,0,1,9,0,162,21,0,1,
+	7,0,19,0,1,7,0,130,11,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,
+	0,198,3,0,72,0,9,153,122,8,0,104,0,45,138,67,67,136,167,42,41,18,56,120,
+	148,4,0,134,4,0,1,10,0,196,6,0,162,14,0,1,9,0,130,21,0,1,7,0,
+	17,0,1,7,0,226,10,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,230,
+	3,0,15,148,66,122,131,0,72,0,47,136,36,36,131,148,39,18,73,67,51,170,73,0,
+	230,3,0,3,42,0,162,21,0,1,9,0,226,20,0,1,7,0,20,0,1,7,0,194,
+	10,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,198,3,0,72,0,9,153,
+	122,8,0,104,0,23,58,41,137,145,34,25,0,110,0,17,72,154,135,72,4,0,198,3,
+	0,3,42,0,226,21,0,1,9,0,194,20,0,1,7,0,17,0,1,7,0,162,10,0,
+	5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,230,3,0,15,148,66,122,131,0,
+	72,0,41,136,148,66,154,65,25,71,56,67,18,8,0,198,4,0,3,42,0,162,22,0,
+	1,9,0,162,20,0,1,7,0,18,0,1,7,0,130,10,0,5,25,7,0,130,8,0,
+	3,162,0,70,0,1,10,0,198,3,0,72,0,9,153,122,8,0,104,0,41,58,41,161,
+	120,19,168,71,132,68,122,4,0,198,4,0,3,42,0,226,22,0,1,9,0,130,20,0,
+	1,7,0,17,0,1,7,0,226,9,0,5,25,7,0,130,8,0,3,162,0,70,0,1,
+	10,0,230,3,0,15,148,66,122,131,0,72,0,41,136,148,66,137,56,67,122,56,67,18,
+	8,0,198,4,0,3,42,0,162,23,0,1,9,0,226,19,0,1,7,0,20,0,1,7,
+	0,194,9,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,198,3,0,72,0,
+	9,153,122,8,0,104,0,21,58,41,161,136,167,2,0,66,0,13,135,68,122,4,0,198,
+	4,0,3,42,0,226,23,0,1,9,0,194,19,0,1,7,0,17,0,1,7,0,162,9,
+	0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,230,3,0,15,148,66,122,131,
+	0,72,0,41,136,148,66,137,148,120,71,56,67,18,8,0,198,4,0,3,42,0,162,24,
+	0,1,9,0,162,19,0,1,7,0,20,0,1,7,0,130,9,0,5,25,7,0,130,8,
+	0,3,162,0,70,0,1,10,0,198,3,0,72,0,9,153,122,8,0,104,0,23,58,41,
+	161,136,39,137,0,72,0,11,72,164,71,0,198,4,0,3,42,0,226,24,0,1,9,0,
+	130,19,0,1,7,0,19,0,1,7,0,226,8,0,5,25,7,0,130,8,0,3,162,0,
+	70,0,1,10,0,230,3,0,15,148,66,122,131,0,72,0,19,136,148,66,137,148,0,80,
+	0,15,132,51,36,129,0,198,4,0,3,42,0,162,25,0,1,9,0,226,18,0,1,7,
+	0,20,0,1,7,0,194,8,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,
+	198,3,0,72,0,9,153,122,8,0,104,0,23,58,41,161,136,39,137,0,72,0,11,72,
+	164,71,0,198,4,0,3,42,0,226,25,0,1,9,0,194,18,0,1,7,0,19,0,1,
+	7,0,162,8,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,230,3,0,15,
+	148,66,122,131,0,72,0,19,136,148,66,137,148,0,80,0,15,132,51,36,129,0,198,4,
+	0,3,42,0,162,26,0,1,9,0,162,18,0,1,7,0,20,0,1,7,0,130,8,0,
+	5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,198,3,0,72,0,9,153,122,8,
+	0,104,0,23,58,41,161,136,39,137,0,72,0,11,72,164,71,0,198,4,0,3,42,0,
+	226,26,0,1,9,0,130,18,0,1,7,0,19,0,1,7,0,226,7,0,5,25,7,0,
+	130,8,0,3,162,0,70,0,1,10,0,230,3,0,15,148,66,122,131,0,72,0,19,136,
+	148,66,137,148,0,80,0,15,132,51,36,129,0,198,4,0,3,42,0,162,27,0,1,9,
+	0,226,17,0,1,7,0,20,0,1,7,0,194,7,0,5,25,7,0,130,8,0,3,162,
+	0,70,0,1,10,0,198,3,0,72,0,9,153,122,8,0,104,0,23,58,41,161,136,39,
+	137,0,72,0,11,72,164,71,0,198,4,0,3,42,0,226,27,0,1,9,0,194,17,0,
+	1,7,0,19,0,1,7,0,162,7,0,5,25,7,0,130,8,0,3,162,0,70,0,1,
+	10,0,230,3,0,15,148,66,122,131,0,72,0,19,136,148,66,137,148,0,80,0,15,132,
+	51,36,129,0,198,4,0,3,42,0,162,28,0,1,9,0,162,17,0,1,7,0,20,0,
+	1,7,0,130,7,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,198,3,0,
+	72,0,9,153,122,8,0,104,0,23,58,41,161,136,39,137,0,72,0,11,72,164,71,0,
+	198,4,0,3,42,0,226,28,0,1,9,0,130,17,0,1,7,0,19,0,1,7,0,226,
+	6,0,5,25,7,0,130,8,0,3,162,0,70,0,1,10,0,230,3,0,15,148,66,122,
+	131,0,72,0,19,136,148,66,137,148,0,80,0,15,132,51,36,129,0,198,4,0,3,42,
+	0,162,29,0,1,9,0,226,16,0,1,7,0,20,0,1,7,0,194,6,0,5,25,7,
+	0,130,8,0,3,162,0,70,0,1,10,0,198,3,0,72,0,9,153,122,8,0,104,0,
+	23,58,41,161,136,39,137,0,72,0,11,72,164,71,0,198,4,0,3,42,0,226,29,0,
+	1,9,0,194,16,0,1,7,0,19,0,1,7,0,162,6,0,5,25,7,0,130,8,0,
+	3,162,0,70,0,1,10,0,230,3,0,15,148,66,122,131,0,72,0,19,136,148,66,137,
+	148,0,80,0,15,132,51,36,129,0,198,4,0,3,42,0,162,30,0,1,9,0,162,16,
+	0,1,7,0,20,0,1,7,0,130,6,0,5,25,7,0,130,8,0,3,162,0,70,0,
+	1,10,0,198,3,0,72,0,9,153,122,8,0,104,0,23,58,41,161,136,39,137,0,72,
+	0,11,72,164,71,0,198,4,0,3,42,0,226,30,0,1,9,0,130,16,0,1,7,0,
+	19,0,1,7,0,226,5,0,5,25,7,0,194,7,0,7,41,170,0,70,0,1,10,0,
+	230,3,0,15,148,66,122,131,0,72,0,19,136,148,66,137,148,0,80,0,15,132,51,36,
+	129,0,198,4,0,3,42,0,162,31,0,1,9,0,226,15,0,1,7,0,20,0,1,7,
+	0,194,5,0,5,25,7,0,194,7,0,3,41,0,134,1,0,1,10,0,198,3,0,72,
+	0,9,153,122,8,0,104,0,23,58,41,161,136,39,137,0,72,0,11,72,164,71,0,198,
+	4,0,3,42,0,226,31,0,1,9,0,194,15,0,1,7,0,19,0,1,7,0,162,5,
+	0,5,25,7,0,194,7,0,3,41,0,134,1,0,1,10,0,230,3,0,15,148,66,122,
+	131,0,72,0,19,136,148,66,137,148,0,80,0,15,132,51,36,129,0,198,4,0,3,42,
+	0,162,32,0,1,9,0,162,15,0,1,7,0,20,0,1,7,0,130,5,0,5,25,7,
+	0,194,7,0,3,41,0,134,1,0,1,10,0,198,3,0,72,0,9,153,122,8,0,104,
+	0,23,58,41,161,136,39,137,0,72,0,11,72,164,71,0,198,4,0,3,42,0,226,32,
+	0,1,9,0,130,15,0,1,7,0,20,0,1,7,0,226,4,0,5,25,7,0,130,7,
+	0,82,0,1,2,0,134,1,0,1,10,0,230,3,0,15,148,66,122,131,0,72,0,19,
+	136,148,66,137,148,0,80,0,15,132,51,36,129,0,198,4,0,3,42,0,162,33,0,1,
+	9,0,226,14,0,1,7,0,20,0,1,7,0,194,4,0,5,25,7,0,162,7,0,7,
+	57,170,0,102,0,1,10,0,198,3,0,72,0,9,153,122,8,0,104,0,23,58,41,161,
+	136,39,137,0,72,0,11,72,164,71,0,198,4,0,3,42,0,226,33,0,1,9,0,194,
+	14,0,1,7,0,17,0,1,7,0,162,4,0,5,25,7,0,194,7,0,15,169,56,58,
+	163,0,230,3,0,15,148,66,122,131,0,72,0,19,136,148,66,137,148,0,80,0,15,132,
+	51,36,129,0,198,4,0,3,42,0,162,34,0,1,9,0,162,14,0,1,7,0,18,0,
+	1,7,0,130,4,0,5,25,7,0,194,7,0,15,41,58,56,170,0,198,3,0,72,0,
+	9,153,122,8,0,104,0,23,58,41,161,136,39,137,0,72,0,11,72,164,71,0,198,4,
+	0,3,42,0,226,34,0,1,9,0,130,14,0,1,7,0,15,0,1,7,0,226,3,0,
+	5,25,7,0,226,7,0,15,57,163,131,170,0,198,3,0,41,148,66,122,115,120,135,72,
+	41,148,72,9,0,80,0,15,132,51,36,129,0,198,4,0,3,42,0,162,35,0,1,9,
+	0,226,13,0,1,7,0,15,0,1,7,0,194,3,0,5,25,7,0,130,8,0,17,169,
+	52,170,56,10,0,166,2,0,51,23,113,148,169,135,132,169,129,41,161,136,39,137,0,72,
+	0,11,72,164,71,0,198,4,0,3,42,0,226,35,0,1,9,0,194,13,0,1,7,0,
+	16,0,1,7,0,162,3,0,5,25,7,0,130,8,0,21,41,58,164,58,56,10,0,166,
+	1,0,80,0,45,18,41,71,122,131,132,57,148,41,148,72,9,0,80,0,15,132,51,36,
+	129,0,198,4,0,3,42,0,162,36,0,1,9,0,162,13,0,1,7,0,19,0,1,7,
+	0,130,3,0,5,25,7,0,130,8,0,23,41,51,170,52,58,120,0,144,1,0,3,57,
+	0,98,0,11,136,66,135,0,72,0,25,72,65,52,132,120,146,8,0,72,0,11,72,164,
+	71,0,198,4,0,3,42,0,226,36,0,1,9,0,130,13,0,1,7,0,19,0,1,7,
+	0,226,2,0,5,25,7,0,130,8,0,3,41,0,70,0,17,170,67,163,121,8,0,100,
+	0,23,20,71,74,136,55,136,0,72,0,19,120,130,36,131,148,0,80,0,15,132,51,36,
+	129,0,198,4,0,3,42,0,162,37,0,1,9,0,226,12,0,1,7,0,15,0,1,7,
+	0,194,2,0,5,25,7,0,130,8,0,3,41,0,70,0,79,58,163,67,55,152,66,51,
+	122,170,136,146,162,71,136,132,73,116,17,41,137,0,72,0,11,72,164,71,0,198,4,0,
+	3,42,0,226,37,0,1,9,0,194,12,0,1,7,0,15,0,1,7,0,162,2,0,5,
+	25,7,0,130,8,0,3,41,0,70,0,1,10,0,102,0,87,74,161,74,114,40,152,55,
+	57,74,145,72,152,26,57,49,17,20,135,132,51,36,129,0,198,4,0,3,42,0,162,38,
+	0,1,9,0,162,12,0,1,7,0,19,0,1,7,0,130,2,0,5,25,7,0,130,8,
+	0,3,41,0,70,0,1,10,0,198,1,0,5,162,2,0,80,0,9,138,18,4,0,110,
+	0,51,24,119,56,55,147,164,148,122,114,72,72,164,71,0,198,4,0,3,42,0,226,38,
+	0,1,9,0,130,12,0,1,7,0,15,0,1,7,0,226,1,0,5,25,7,0,130,8,
+	0,3,41,0,70,0,1,10,0,198,1,0,81,153,122,136,162,35,67,40,145,167,25,145,
+	40,115,52,170,49,147,55,67,18,8,0,198,4,0,3,42,0,162,39,0,1,9,0,226,
+	11,0,1,7,0,15,0,1,7,0,194,1,0,5,25,7,0,130,8,0,3,41,0,70,
+	0,1,10,0,198,1,0,81,71,18,71,71,151,169,132,146,167,67,121,170,73,73,121,154,
+	33,121,68,122,4,0,198,4,0,3,42,0,226,39,0,1,9,0,194,11,0,1,7,0,
+	17,0,1,7,0,162,1,0,5,25,7,0,130,8,0,3,41,0,70,0,1,10,0,230,
+	1,0,67,71,73,25,135,115,18,25,52,153,138,39,50,72,154,49,129,120,0,72,0,5,
+	18,8,0,198,4,0,3,42,0,162,40,0,1,9,0,162,11,0,1,7,0,15,0,1,
+	7,0,130,1,0,5,25,7,0,130,8,0,3,41,0,70,0,1,10,0,134,2,0,77,
+	56,169,36,57,154,136,151,163,119,66,136,132,41,20,148,72,132,68,122,4,0,198,4,0,
+	3,42,0,226,40,0,1,9,0,130,11,0,1,7,0,17,0,1,7,0,98,0,5,25,
+	7,0,130,8,0,3,41,0,70,0,1,10,0,166,2,0,37,56,55,34,19,170,73,162,
+	33,120,3,0,80,0,31,74,129,52,146,136,51,36,129,0,198,4,0,3,42,0,162,41,
+	0,1,9,0,226,10,0,1,7,0,20,0,1,7,0,66,0,5,25,7,0,194,6,0,
+	210,1,0,1,2,0,70,0,1,10,0,198,2,0,45,56,41,50,17,41,18,154,34,120,
+	138,24,9,0,68,0,3,154,0,112,0,9,68,122,4,0,198,4,0,3,42,0,226,41,
+	0,1,9,0,194,10,0,1,7,0,15,0,11,23,145,113,0,226,6,0,3,57,0,180,
+	1,0,5,51,10,0,230,2,0,25,56,73,20,113,170,168,4,0,70,0,39,26,130,57,
+	41,49,154,136,51,36,129,0,198,4,0,3,42,0,162,42,0,1,9,0,162,10,0,1,
+	7,0,18,0,9,23,25,7,0,130,7,0,5,169,8,0,134,1,0,3,170,0,198,2,
+	0,80,0,23,25,66,52,114,121,57,0,136,1,0,19,19,74,66,154,148,0,104,0,5,
+	122,4,0,198,4,0,3,42,0,226,42,0,1,9,0,130,10,0,1,7,0,15,0,7,
+	151,113,0,162,7,0,7,169,131,0,102,0,3,170,0,230,1,0,7,23,50,0,132,1,
+	0,59,116,115,20,34,145,72,121,18,56,147,39,49,20,34,129,0,198,4,0,3,42,0,
+	162,43,0,1,9,0,226,9,0,1,7,0,14,0,78,0,194,7,0,21,169,51,56,163,
+	51,10,0,198,1,0,31,71,135,67,57,39,67,42,161,0,104,0,29,115,41,167,73,170,
+	167,65,7,0,72,0,198,4,0,3,42,0,226,43,0,1,9,0,194,9,0,1,7,0,
+	17,4,1,7,0,194,7,0,3,169,0,70,0,3,168,0,102,0,1,10,0,166,1,0,
+	53,56,135,132,57,116,132,137,114,39,42,42,73,154,4,0,116,0,7,19,129,0,134,5,
+	0,3,42,0,162,44,0,1,9,0,162,9,0,1,7,0,17,0,1,7,0,194,7,0,
+	3,169,0,70,0,3,138,0,134,1,0,1,10,0,134,1,0,53,136,34,170,57,71,52,
+	74,122,167,33,25,49,138,2,0,98,0,5,152,4,0,134,5,0,3,42,0,226,44,0,
+	1,9,0,130,9,0,1,7,0,15,0,1,7,0,194,7,0,15,169,51,58,131,0,134,
+	1,0,1,10,0,102,0,3,119,0,70,0,57,24,167,148,18,168,131,40,167,56,35,36,
+	135,51,148,4,0,230,4,0,3,42,0,162,45,0,1,9,0,226,8,0,1,7,0,19,
+	0,1,7,0,194,7,0,7,169,163,0,102,0,1,8,0,134,1,0,1,10,0,70,0,
+	33,151,56,130,114,58,56,131,74,4,0,70,0,15,162,163,51,138,0,72,0,5,122,4,
+	0,198,4,0,3,42,0,226,45,0,1,9,0,194,8,0,1,7,0,15,0,1,7,0,
+	194,7,0,5,169,10,0,166,1,0,1,8,0,134,1,0,1,10,0,78,0,63,153,119,
+	33,50,154,65,113,168,25,164,114,19,39,26,34,129,0,198,4,0,3,42,0,162,46,0,
+	1,9,0,162,8,0,1,7,0,12,0,1,7,0,194,7,0,3,41,0,230,1,0,73,
+	120,135,120,161,20,154,162,17,67,131,161,73,26,132,167,120,65,151,8,0,72,0,198,4,
+	0,3,42,0,226,46,0,1,9,0,130,8,0,1,7,0,11,0,1,7,0,162,7,0,
+	5,25,2,0,230,1,0,73,56,52,36,73,41,168,115,41,67,67,121,135,65,42,66,120,
+	113,151,4,0,134,5,0,3,42,0,162,47,0,1,9,0,226,7,0,1,7,0,11,0,
+	1,7,0,130,7,0,7,25,33,0,230,1,0,73,136,163,35,39,168,33,154,169,116,19,
+	163,18,121,68,138,73,135,19,4,0,230,4,0,3,42,0,226,47,0,1,9,0,194,7,
+	0,1,7,0,13,0,1,7,0,226,6,0,1,9,0,66,0,1,2,0,230,1,0,73,
+	136,115,136,18,24,145,168,58,55,18,19,145,56,161,40,73,58,19,4,0,198,4,0,3,
+	42,0,162,48,0,1,9,0,162,7,0,1,7,0,15,0,1,7,0,194,6,0,1,9,
+	0,98,0,1,2,0,230,1,0,55,136,130,130,71,137,164,151,130,169,137,50,19,49,73,
+	0,102,0,9,73,151,4,0,166,4,0,3,42,0,226,48,0,1,9,0,130,7,0,1,
+	7,0,18,0,1,7,0,162,6,0,1,9,0,130,1,0,1,2,0,230,1,0,78,0,
+	13,131,122,116,2,0,66,0,29,41,154,34,154,72,120,130,9,0,110,0,9,58,122,4,
+	0,134,4,0,3,42,0,162,49,0,1,9,0,226,6,0,1,7,0,15,0,1,7,0,
+	130,6,0,1,9,0,162,1,0,1,2,0,230,1,0,53,153,151,23,122,146,23,65,132,
+	51,18,50,40,26,1,0,142,1,0,7,58,138,0,134,4,0,3,42,0,226,49,0,1,
+	9,0,194,6,0,1,7,0,15,0,1,7,0,226,5,0,1,9,0,194,1,0,1,2,
+	0,230,1,0,53,121,114,131,18,146,145,68,152,164,33,68,136,57,7,0,98,0,9,130,
+	129,7,0,230,3,0,3,42,0,162,50,0,1,9,0,162,6,0,1,7,0,17,0,1,
+	7,0,194,5,0,1,9,0,226,1,0,1,2,0,198,1,0,25,132,49,72,73,72,73,
+	7,0,84,0,23,67,151,57,162,25,161,0,146,1,0,7,168,113,0,198,3,0,3,42,
+	0,226,50,0,1,9,0,130,6,0,1,7,0,14,0,1,7,0,162,5,0,1,9,0,
+	130,2,0,1,2,0,166,1,0,59,52,67,72,154,122,55,33,132,72,114,19,65,168,39,
+	148,0,142,1,0,134,4,0,3,42,0,162,51,0,1,9,0,226,5,0,1,7,0,15,
+	0,1,7,0,130,5,0,1,9,0,162,2,0,1,2,0,134,1,0,1,4,0,70,0,
+	53,138,56,152,65,114,52,121,121,51,33,120,39,66,8,0,134,5,0,3,42,0,226,51,
+	0,1,9,0,194,5,0,1,7,0,15,0,1,7,0,226,4,0,1,9,0,194,2,0,
+	1,2,0,102,0,1,4,0,70,0,55,58,68,74,51,49,71,146,122,49,56,72,164,17,
+	132,0,230,4,0,3,42,0,162,52,0,1,9,0,162,5,0,1,7,0,15,0,1,7,
+	0,194,4,0,1,9,0,226,2,0,1,2,0,70,0,1,4,0,70,0,59,58,67,35,
+	67,132,73,41,40,42,168,145,136,154,167,71,0,166,4,0,3,42,0,226,52,0,1,9,
+	0,130,5,0,1,7,0,15,0,1,7,0,162,4,0,1,9,0,130,3,0,7,50,67,
+	0,70,0,1,10,0,70,0,53,72,50,136,138,42,49,50,146,39,130,42,121,148,4,0,
+	134,4,0,3,42,0,162,53,0,1,9,0,226,4,0,1,7,0,17,0,1,7,0,130,
+	4,0,1,9,0,162,3,0,5,50,4,0,70,0,1,10,0,70,0,7,116,36,0,70,
+	0,41,74,73,161,138,39,26,114,35,71,148,4,0,230,3,0,3,42,0,226,53,0,1,
+	9,0,194,4,0,1,7,0,15,0,1,7,0,226,3,0,1,9,0,194,3,0,3,66,
+	0,70,0,1,10,0,102,0,55,148,23,130,66,132,73,161,68,19,120,36,113,164,71,0,
+	198,3,0,3,42,0,162,54,0,1,9,0,162,4,0,1,7,0,15,0,1,7,0,194,
+	3,0,1,9,0,226,3,0,9,162,51,10,0,134,1,0,41,55,17,131,169,50,136,71,
+	73,17,132,8,0,84,0,5,18,8,0,198,3,0,3,42,0,226,54,0,1,9,0,130,
+	4,0,1,7,0,17,0,1,7,0,162,3,0,1,9,0,162,4,0,5,162,10,0,166,
+	1,0,33,55,68,49,135,65,42,170,50,8,0,70,0,1,9,0,80,0,3,68,0,198,
+	3,0,3,42,0,162,55,0,1,9,0,226,3,0,1,7,0,15,0,1,7,0,130,3,
+	0,1,9,0,226,4,0,1,2,0,198,1,0,33,116,121,26,72,145,151,36,23,1,0,
+	72,0,1,7,0,198,4,0,3,42,0,226,55,0,1,9,0,194,3,0,1,7,0,14,
+	0,1,7,0,226,2,0,1,9,0,130,5,0,1,2,0,166,1,0,43,52,68,152,36,
+	122,25,167,153,71,145,116,0,104,0,166,3,0,3,42,0,162,56,0,1,9,0,162,3,
+	0,1,7,0,13,0,1,7,0,194,2,0,1,9,0,162,5,0,1,2,0,134,1,0,
+	53,52,52,67,152,42,41,163,20,170,51,121,121,153,4,0,134,3,0,3,42,0,226,56,
+	0,1,9,0,130,3,0,1,7,0,15,0,1,7,0,162,2,0,1,9,0,194,5,0,
+	1,2,0,102,0,5,52,4,0,102,0,41,132,57,132,116,55,162,152,148,51,168,8,0,
+	230,2,0,3,42,0,162,57,0,1,9,0,226,2,0,1,7,0,19,0,1,7,0,130,
+	2,0,1,9,0,226,5,0,1,2,0,70,0,5,52,4,0,166,1,0,9,68,151,10,
+	0,82,0,13,120,154,49,8,0,66,0,3,131,0,198,2,0,3,42,0,226,57,0,1,
+	9,0,194,2,0,1,7,0,13,0,1,7,0,226,1,0,1,9,0,130,6,0,11,50,
+	67,67,0,134,2,0,35,122,33,55,129,26,151,169,74,137,0,166,2,0,3,42,0,162,
+	58,0,1,9,0,162,2,0,1,7,0,16,0,1,7,0,194,1,0,1,9,0,162,6,
+	0,9,50,52,4,0,134,2,0,21,58,131,167,169,39,9,0,72,0,5,131,8,0,72,
+	0,230,1,0,3,42,0,226,58,0,1,9,0,130,2,0,1,7,0,17,0,1,7,0,
+	162,1,0,1,9,0,194,6,0,7,66,67,0,134,2,0,1,10,0,102,0,19,20,147,
+	120,68,170,0,166,1,0,1,4,0,166,1,0,3,42,0,162,59,0,1,9,0,226,1,
+	0,1,7,0,19,0,1,7,0,130,1,0,1,9,0,226,6,0,5,162,4,0,134,2,
+	0,1,10,0,70,0,13,68,136,167,10,0,80,0,3,170,0,198,1,0,1,4,0,102,
+	0,3,42,0,226,59,0,1,9,0,194,1,0,1,7,0,12,0,1,7,0,98,0,1,
+	9,0,162,7,0,196,2,0,31,58,67,131,164,147,137,72,163,0,230,1,0,9,52,163,
+	2,0,162,60,0,1,9,0,162,1,0,1,7,0,13,0,1,7,0,66,0,1,9,0,
+	162,10,0,5,162,4,0,70,0,17,146,119,41,163,10,0,166,2,0,5,164,2,0,226,
+	60,0,1,9,0,130,1,0,1,7,0,10,0,7,23,145,0,226,10,0,132,1,0,9,
+	25,119,1,0,82,0,132,3,0,162,61,0,1,9,0,98,0,1,7,0,9,0,5,23,
+	9,0,162,12,0,7,25,119,0,66,0,1,9,0,226,64,0,1,9,0,66,0,1,7,
+	0,5,0,3,151,0,226,12,0,11,121,23,145,0,162,65,0,7,25,113,0,4,0,142,
+	14,0,3,145,0,226,65,0,5,25,7,0,3,112,3,151,0,162,66,0,3,121,0,1,
+	0,174,67,
+};
+
+static const byte test_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,7,11,9,7,2,13,15,12,4,6,8,13,
+	1,10,13,12,0,255,1,0,255,0,1,255,255,1,255,255,1,1,0,255,15,6,7,1,
+	11,0,0,0,236,1,0,0,142,1,0,0,2,0,0,0,62,154,18,0,3,7,0,0,
+	4,0,0,0,204,3,0,0,219,218,1,0,53,1,0,0,52,1,0,0,149,2,0,0,
+	148,2,0,0,0,0,0,0,120,0,0,0,0,0,0,0,114,143,0,0,0,0,0,0,
+	181,2,13,188,9,120,2,3,204,4,3,204,2,3,204,2,3,204,2,3,204,2,3,204,
+	2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,0,5,1,1,12,0,
+	118,0,7,17,187,0,98,0,85,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,
+	17,187,17,187,17,187,12,0,3,0,5,188,10,0,188,12,0,5,186,12,0,3,2,5,
+	225,10,0,252,11,0,7,234,203,0,69,207,4,120,4,3,204,2,3,204,2,3,204,2,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,20,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,
+	3,204,2,3,204,2,184,1,2,3,204,2,3,204,2,3,204,6,3,204,2,3,204,2,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,4,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,7,225,174,0,188,11,
+	0,9,234,190,12,0,17,1,1,12,0,118,0,98,0,85,187,17,187,17,187,17,187,17,
+	187,17,187,17,187,17,187,17,187,17,187,17,187,12,16,85,28,177,27,177,27,177,27,177,
+	27,177,27,177,27,177,27,177,27,177,27,177,27,1,0,182,1,0,23,17,187,17,187,17,
+	187,0,162,1,0,139,1,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,
+	17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,0,98,0,177,1,187,
+	17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,
+	17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,11,0,92,0,1,
+	10,0,252,10,0,1,10,0,92,0,3,203,0,18,0,5,188,10,0,188,11,0,5,186,
+	12,1,3,204,2,3,204,2,3,204,2,3,204,1,1,12,0,86,0,1,10,0,156,56,
+	0,1,11,0,92,0,1,10,0,188,10,0,1,10,0,124,0,3,203,0,11,2,5,225,
+	10,0,252,10,0,55,234,27,177,27,177,27,177,27,177,27,177,17,190,171,0,220,55,0,
+	1,11,0,92,0,1,10,0,252,9,0,1,10,0,156,1,0,3,203,0,14,0,7,225,
+	174,0,188,10,0,5,234,11,0,252,4,0,86,0,11,17,190,171,0,156,55,0,1,11,
+	0,92,0,1,10,0,188,9,0,1,10,0,188,1,0,3,203,0,16,1,3,188,0,92,
+	0,1,10,0,252,9,0,5,234,11,0,252,5,0,86,0,11,17,190,171,0,220,54,0,
+	1,11,0,92,0,1,10,0,252,8,0,1,10,0,220,1,0,1,1,0,16,0,3,188,
+	0,124,0,1,10,0,188,9,0,5,234,11,0,252,6,0,86,0,11,17,190,171,0,156,
+	54,0,1,11,0,92,0,1,10,0,188,8,0,1,10,0,252,1,0,1,1,0,16,2,
+	1,1,0,156,1,0,1,10,0,252,8,0,5,234,11,0,252,7,0,86,0,11,17,190,
+	171,0,220,53,0,1,11,0,92,0,1,10,0,252,7,0,1,10,0,156,2,0,3,203,
+	0,16,3,7,28,28,0,156,1,0,1,10,0,188,8,0,5,234,11,0,252,8,0,86,
+	0,11,17,190,171,0,156,53,0,1,11,0,92,0,1,10,0,188,7,0,1,10,0,188,
+	2,0,3,203,0,16,0,9,188,203,1,0,156,1,0,1,10,0,252,7,0,5,234,11,
+	0,252,9,0,86,0,11,17,190,171,0,220,52,0,1,11,0,92,0,1,10,0,252,6,
+	0,1,10,0,220,2,0,1,1,0,18,2,9,225,203,1,0,156,1,0,1,10,0,252,
+	2,0,180,1,0,252,2,0,5,234,11,0,252,10,0,86,0,11,17,190,171,0,156,52,
+	0,1,11,0,92,0,1,10,0,188,6,0,1,10,0,252,2,0,1,1,0,21,0,11,
+	225,190,28,0,124,0,3,36,0,200,2,0,1,2,0,108,0,1,2,0,200,1,0,124,
+	0,5,234,11,0,252,11,0,86,0,11,17,190,171,0,220,51,0,1,11,0,92,0,1,
+	10,0,252,5,0,1,10,0,156,3,0,1,1,0,20,1,3,188,0,92,0,5,203,1,
+	0,92,0,37,164,72,164,42,66,164,138,201,97,8,0,180,1,0,1,4,0,92,0,5,
+	234,11,0,252,12,0,86,0,11,17,190,171,0,156,51,0,1,11,0,92,0,1,10,0,
+	188,5,0,1,10,0,188,3,0,1,1,0,17,0,3,188,0,124,0,47,203,225,78,74,
+	184,186,161,174,132,244,188,33,0,72,0,84,0,11,228,174,190,0,252,13,0,86,0,11,
+	17,190,171,0,220,50,0,1,11,0,92,0,1,10,0,252,4,0,1,10,0,220,3,0,
+	3,203,0,14,2,1,1,0,156,1,0,67,203,225,132,184,78,170,66,226,26,36,171,97,
+	107,232,46,170,190,0,252,14,0,86,0,11,17,190,171,0,156,50,0,1,11,0,92,0,
+	1,10,0,188,4,0,1,10,0,252,3,0,3,203,0,14,0,1,1,0,188,1,0,63,
+	203,129,234,234,26,161,232,100,68,38,230,107,40,142,102,178,0,252,15,0,86,0,11,17,
+	190,171,0,220,49,0,1,11,0,92,0,1,10,0,252,3,0,1,10,0,156,4,0,1,
+	1,0,14,1,3,188,0,220,1,0,61,203,190,238,178,104,33,24,171,228,136,33,180,234,
+	130,110,4,0,220,16,0,86,0,11,17,190,171,0,156,49,0,1,11,0,92,0,1,10,
+	0,188,3,0,1,10,0,188,4,0,1,1,0,14,0,3,188,0,252,1,0,59,155,20,
+	232,162,190,139,162,106,138,24,34,129,186,134,75,0,188,17,0,86,0,11,17,190,171,0,
+	220,48,0,1,11,0,92,0,1,10,0,252,2,0,1,10,0,220,4,0,3,203,0,16,
+	2,1,1,0,252,1,0,35,106,44,171,162,161,20,27,36,168,0,80,0,17,38,171,130,
+	168,4,0,156,18,0,86,0,11,17,190,171,0,156,48,0,1,11,0,92,0,1,10,0,
+	188,2,0,1,10,0,252,4,0,3,203,0,14,0,1,1,0,220,1,0,61,234,244,238,
+	38,168,26,166,235,142,110,225,40,98,232,66,4,0,252,18,0,86,0,11,17,190,171,0,
+	220,47,0,1,11,0,92,0,1,10,0,188,1,0,5,186,11,0,156,5,0,1,1,0,
+	14,1,3,188,0,220,1,0,43,27,244,156,186,201,166,234,166,174,136,226,0,86,0,11,
+	180,40,74,0,220,19,0,86,0,11,17,190,171,0,156,47,0,9,235,174,8,0,104,0,
+	7,168,187,0,156,5,0,1,1,0,12,0,3,188,0,220,1,0,19,27,139,132,233,172,
+	0,88,0,35,106,138,68,161,102,66,186,43,74,0,188,20,0,86,0,11,17,190,171,0,
+	220,46,0,23,235,107,97,207,230,177,0,156,5,0,3,203,0,12,2,1,1,0,188,1,
+	0,21,234,235,174,104,159,10,0,82,0,35,162,226,187,174,134,70,238,230,74,0,156,21,
+	0,86,0,11,17,190,171,0,156,46,0,21,139,204,79,248,24,11,0,156,5,0,3,203,
+	0,14,0,1,1,0,188,1,0,63,27,75,132,187,132,246,100,177,180,178,138,36,38,168,
+	235,74,0,252,21,0,86,0,5,17,14,0,118,0,27,186,174,190,174,190,174,190,0,156,
+	1,0,141,1,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,
+	234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,11,0,92,0,197,1,234,235,234,
+	235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,
+	235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,152,132,42,202,130,10,0,
+	156,5,0,1,1,0,14,1,3,188,0,188,1,0,27,27,75,132,17,174,238,201,0,82,
+	0,29,171,97,228,187,74,166,130,8,0,220,22,0,150,1,0,31,174,41,174,190,174,190,
+	174,190,0,156,1,0,141,1,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,
+	234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,11,0,92,0,195,
+	1,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,
+	235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,248,204,239,
+	41,78,0,188,5,0,1,1,0,7,0,3,188,0,188,1,0,139,2,187,78,26,78,107,
+	97,134,34,175,104,134,106,110,66,234,75,190,174,190,174,190,174,190,174,190,174,190,174,190,
+	174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,
+	174,190,174,190,174,190,174,190,174,190,174,42,47,171,0,156,44,0,19,24,30,175,153,142,
+	0,188,5,0,3,203,0,7,2,1,1,0,188,1,0,145,2,187,78,190,100,66,22,43,
+	254,246,75,36,100,20,166,190,33,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,
+	174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,
+	174,190,174,190,174,190,174,190,174,242,140,225,187,10,0,188,43,0,21,24,169,142,26,164,
+	10,0,156,5,0,3,203,0,9,0,1,1,0,188,1,0,63,187,78,184,234,72,97,182,
+	200,198,36,238,75,34,33,232,65,0,252,23,0,23,146,73,187,17,190,171,0,252,42,0,
+	21,201,172,130,65,235,10,0,252,4,0,1,1,0,12,1,3,188,0,188,1,0,55,187,
+	174,168,97,130,186,132,164,204,18,104,171,107,70,0,66,0,1,4,0,188,25,0,86,0,
+	11,17,190,171,0,252,41,0,23,27,25,238,187,226,187,0,252,4,0,1,1,0,12,0,
+	3,188,0,188,1,0,13,187,174,104,10,0,68,0,45,177,184,98,187,38,74,187,234,164,
+	129,110,4,0,252,25,0,86,0,11,17,190,171,0,252,40,0,27,203,225,168,34,68,238,
+	17,0,220,4,0,3,203,0,12,2,1,1,0,188,1,0,65,187,78,98,106,36,166,130,
+	168,164,150,108,190,235,164,136,20,4,0,220,26,0,86,0,11,17,190,171,0,252,39,0,
+	9,203,225,10,0,252,1,0,3,187,0,220,4,0,3,203,0,12,0,1,1,0,156,1,
+	0,67,234,235,174,162,104,129,170,158,111,40,255,186,100,72,97,43,65,0,188,27,0,86,
+	0,11,17,190,171,0,252,38,0,9,203,225,10,0,156,2,0,5,235,10,0,188,4,0,
+	1,1,0,16,0,1,1,0,156,1,0,5,27,11,0,92,0,55,68,66,207,40,145,233,
+	22,18,102,34,42,230,38,65,0,156,28,0,86,0,11,17,190,171,0,252,37,0,9,203,
+	225,10,0,188,1,0,3,187,0,92,0,5,235,10,0,156,4,0,1,1,0,14,0,1,
+	1,0,156,1,0,5,27,11,0,92,0,55,68,70,156,75,27,235,138,102,20,142,20,43,
+	130,65,0,252,28,0,86,0,7,17,174,0,188,37,0,9,203,225,10,0,156,3,0,5,
+	235,10,0,252,3,0,3,203,0,18,0,1,1,0,156,1,0,3,187,0,124,0,55,164,
+	168,65,97,97,42,68,184,226,30,132,166,138,65,0,220,29,0,86,0,3,150,0,86,0,
+	1,10,0,252,35,0,9,203,225,10,0,252,1,0,3,170,0,156,1,0,5,235,10,0,
+	220,3,0,3,203,0,13,0,1,1,0,156,1,0,3,187,0,124,0,55,164,72,24,182,
+	234,27,40,27,42,102,180,226,138,65,0,156,30,0,19,106,230,17,190,171,0,252,34,0,
+	9,203,225,10,0,156,4,0,5,235,10,0,188,3,0,1,1,0,19,0,1,1,0,124,
+	0,5,234,11,0,124,0,11,164,72,22,0,80,0,37,42,132,142,168,30,177,75,170,24,
+	4,0,156,30,0,116,0,86,0,11,17,190,171,0,252,33,0,9,203,225,10,0,188,2,
+	0,3,187,0,220,1,0,5,235,10,0,156,3,0,1,1,0,20,0,1,1,0,124,0,
+	5,27,11,0,124,0,9,164,138,6,0,98,0,7,22,230,0,80,0,5,66,8,0,100,
+	0,9,74,26,4,0,252,31,0,86,0,11,17,190,171,0,252,32,0,9,203,225,10,0,
+	156,5,0,5,235,10,0,252,2,0,3,203,0,22,1,3,188,0,124,0,5,27,11,0,
+	124,0,72,0,3,98,0,86,0,13,186,78,168,14,0,84,0,176,1,0,7,138,65,0,
+	220,32,0,86,0,11,17,190,171,0,252,31,0,9,203,225,10,0,252,2,0,3,170,0,
+	156,2,0,5,235,10,0,220,2,0,3,203,0,18,0,3,188,0,92,0,5,234,11,0,
+	252,1,0,3,170,0,136,1,0,9,161,235,11,0,194,2,0,3,75,0,188,33,0,86,
+	0,11,17,190,171,0,252,30,0,9,203,225,10,0,156,6,0,5,235,10,0,188,2,0,
+	1,1,0,18,0,3,188,0,92,0,5,27,11,0,188,3,0,7,20,97,0,168,3,0,
+	1,2,0,156,34,0,86,0,11,17,190,171,0,252,29,0,9,203,225,10,0,188,3,0,
+	3,187,0,220,2,0,5,235,10,0,156,2,0,1,1,0,16,0,3,188,0,92,0,5,
+	27,11,0,188,3,0,104,0,220,3,0,1,10,0,220,34,0,86,0,11,17,190,171,0,
+	252,28,0,9,203,225,10,0,156,7,0,5,235,10,0,252,1,0,3,203,0,16,2,11,
+	225,174,190,0,188,4,0,3,170,0,220,3,0,1,10,0,156,35,0,86,0,11,17,190,
+	171,0,252,27,0,9,203,225,10,0,252,3,0,3,170,0,156,3,0,5,235,10,0,220,
+	1,0,3,203,0,12,0,11,225,190,177,0,252,8,0,1,10,0,220,35,0,86,0,11,
+	17,190,171,0,252,26,0,9,203,225,10,0,156,8,0,5,235,10,0,188,1,0,1,1,
+	0,16,1,13,188,238,27,11,0,188,4,0,3,187,0,156,4,0,1,10,0,156,36,0,
+	86,0,11,17,190,171,0,252,25,0,9,203,225,10,0,188,4,0,3,187,0,220,3,0,
+	5,235,10,0,156,1,0,1,1,0,12,0,11,188,174,190,0,220,9,0,1,10,0,220,
+	36,0,86,0,11,17,190,171,0,252,24,0,9,203,225,10,0,156,9,0,5,235,10,0,
+	124,0,3,203,0,16,2,9,225,27,11,0,220,4,0,3,170,0,220,4,0,1,10,0,
+	156,37,0,86,0,11,17,190,171,0,252,23,0,9,203,225,10,0,252,4,0,3,170,0,
+	156,4,0,5,235,10,0,92,0,3,203,0,10,0,9,225,27,11,0,156,10,0,1,10,
+	0,220,37,0,86,0,11,17,190,171,0,252,22,0,9,203,225,10,0,156,10,0,11,235,
+	234,30,0,14,1,9,188,234,11,0,252,4,0,3,187,0,156,5,0,1,10,0,156,38,
+	0,86,0,11,17,190,171,0,252,21,0,9,203,225,10,0,188,5,0,3,187,0,220,4,
+	0,9,235,234,1,0,10,0,9,188,27,11,0,252,10,0,1,10,0,220,38,0,86,0,
+	11,17,190,171,0,252,20,0,9,203,225,10,0,156,11,0,9,235,186,12,0,15,2,7,
+	177,177,0,252,4,0,3,170,0,220,5,0,1,10,0,156,39,0,86,0,11,17,190,171,
+	0,252,19,0,9,203,225,10,0,252,5,0,3,170,0,156,5,0,86,0,1,12,0,10,
+	0,5,177,11,0,220,11,0,1,10,0,220,39,0,86,0,11,17,190,171,0,252,18,0,
+	9,203,225,10,0,252,11,0,5,193,12,0,14,0,5,204,1,0,156,5,0,3,187,0,
+	156,6,0,1,10,0,156,40,0,86,0,11,17,190,171,0,252,17,0,9,203,225,10,0,
+	188,6,0,3,187,0,156,5,0,1,1,0,10,4,1,1,0,156,12,0,1,10,0,220,
+	40,0,86,0,11,17,190,171,0,252,16,0,9,203,225,10,0,188,12,0,3,203,0,14,
+	1,3,188,0,156,5,0,3,170,0,220,6,0,1,10,0,156,41,0,86,0,11,17,190,
+	171,0,252,15,0,9,203,225,10,0,252,6,0,3,170,0,156,5,0,3,203,0,10,0,
+	3,188,0,220,12,0,1,10,0,220,41,0,86,0,11,17,190,171,0,252,14,0,9,203,
+	225,10,0,252,12,0,1,1,0,14,2,1,1,0,156,5,0,3,187,0,156,7,0,1,
+	10,0,156,42,0,86,0,11,17,190,171,0,252,13,0,9,203,225,10,0,188,7,0,3,
+	187,0,156,5,0,1,1,0,11,0,1,1,0,156,13,0,1,10,0,220,42,0,86,0,
+	11,17,190,171,0,188,10,0,148,2,0,11,168,17,174,0,188,13,0,3,203,0,14,1,
+	3,188,0,156,5,0,3,170,0,220,7,0,1,10,0,156,43,0,86,0,11,17,190,171,
+	0,220,9,0,27,74,136,164,40,68,189,170,0,252,7,0,3,170,0,156,5,0,3,203,
+	0,13,0,3,188,0,220,13,0,1,10,0,220,43,0,86,0,11,17,190,171,0,188,2,
+	0,180,2,0,252,1,0,148,2,0,25,72,72,198,137,189,138,10,0,220,13,0,1,1,
+	0,20,2,1,1,0,156,5,0,3,187,0,156,8,0,1,10,0,156,44,0,86,0,11,
+	17,190,171,0,220,1,0,3,74,0,176,1,0,3,164,0,252,1,0,3,74,0,208,1,
+	0,25,74,34,45,223,173,136,10,0,252,7,0,3,187,0,156,5,0,5,193,12,0,23,
+	0,1,1,0,156,14,0,1,10,0,124,0,180,8,0,156,35,0,86,0,11,17,190,171,
+	0,124,0,5,138,4,0,112,0,3,132,0,244,1,0,72,0,5,130,8,0,68,0,7,
+	102,98,0,94,0,3,150,0,112,0,1,10,0,220,13,0,5,187,1,0,22,1,3,188,
+	0,156,5,0,3,170,0,220,8,0,1,10,0,92,0,3,74,0,176,7,0,3,164,0,
+	252,35,0,86,0,33,17,190,171,174,72,130,72,168,8,0,68,0,13,136,34,249,6,0,
+	68,0,25,22,189,207,193,169,249,2,0,80,0,1,10,0,252,7,0,3,170,0,252,4,
+	0,7,27,27,0,14,0,3,188,0,220,14,0,11,234,174,72,0,240,6,0,5,132,10,
+	0,252,4,0,180,4,0,156,27,0,86,0,79,17,190,107,156,34,68,34,22,252,102,47,
+	191,38,201,168,111,141,193,156,41,0,80,0,1,10,0,188,13,0,9,27,187,12,0,21,
+	2,1,1,0,156,5,0,3,187,0,156,9,0,11,234,138,72,0,176,6,0,7,132,168,
+	0,252,4,0,3,74,0,176,3,0,3,164,0,252,27,0,23,187,189,33,198,26,193,0,
+	94,0,47,141,218,241,105,187,41,221,38,201,252,193,38,0,112,0,1,10,0,252,7,0,
+	3,187,0,252,4,0,9,235,186,12,0,22,0,1,1,0,156,15,0,3,170,0,80,0,
+	1,4,0,176,4,0,72,0,7,170,68,0,80,0,148,2,0,252,2,0,5,138,4,0,
+	240,2,0,3,132,0,180,26,0,112,0,116,0,75,72,66,105,42,28,253,28,207,104,24,
+	193,28,40,130,204,150,152,111,47,0,112,0,84,0,220,12,0,9,27,235,1,0,30,1,
+	3,188,0,156,5,0,3,170,0,188,9,0,5,138,10,0,80,0,1,4,0,240,2,0,
+	136,1,0,3,98,0,114,0,7,130,168,0,208,1,0,3,164,0,252,2,0,7,138,72,
+	0,176,2,0,5,132,10,0,144,26,0,11,148,111,132,0,72,0,1,2,0,76,0,67,
+	33,196,242,154,172,153,205,44,184,139,44,152,209,77,34,105,41,0,80,0,7,138,164,0,
+	188,7,0,3,170,0,220,4,0,9,27,235,1,0,22,0,3,188,0,156,15,0,7,138,
+	168,0,80,0,1,4,0,176,2,0,29,148,111,68,246,43,248,130,10,0,208,1,0,3,
+	132,0,180,3,0,80,0,1,4,0,240,1,0,5,132,10,0,144,26,0,17,148,209,79,
+	36,6,0,94,0,69,28,139,248,65,250,25,220,105,177,209,107,73,161,72,106,255,150,2,
+	0,80,0,9,138,132,10,0,220,12,0,11,235,234,203,0,31,2,1,1,0,156,5,0,
+	3,187,0,188,9,0,1,10,0,80,0,1,10,0,80,0,1,4,0,240,1,0,29,244,
+	173,33,148,155,134,76,10,0,208,1,0,5,132,10,0,176,3,0,1,10,0,80,0,1,
+	4,0,176,1,0,5,132,10,0,144,26,0,39,244,45,18,111,246,187,177,72,107,29,0,
+	82,0,37,47,185,162,136,138,220,145,43,210,11,0,66,0,3,44,0,80,0,11,138,132,
+	168,0,188,7,0,3,187,0,188,4,0,13,27,235,190,12,0,23,0,1,1,0,156,15,
+	0,1,10,0,112,0,1,10,0,80,0,1,4,0,164,1,0,27,100,154,202,156,38,134,
+	250,0,240,1,0,5,132,10,0,144,1,0,7,164,74,0,208,1,0,7,138,72,0,164,
+	1,0,3,164,0,144,26,0,105,244,45,220,148,28,204,138,218,203,140,168,138,26,220,216,
+	217,217,98,70,203,28,189,17,73,136,138,4,0,80,0,1,10,0,188,12,0,11,27,235,
+	30,0,24,1,3,188,0,156,5,0,3,170,0,188,9,0,1,10,0,144,1,0,67,138,
+	72,249,207,17,207,146,202,177,139,34,250,136,34,153,102,164,0,144,1,0,11,132,170,72,
+	0,208,1,0,7,138,100,0,126,0,1,6,0,240,25,0,72,0,17,185,173,66,188,4,
+	0,66,0,79,253,172,191,98,184,219,136,173,246,186,157,111,47,38,42,98,220,41,164,72,
+	0,112,0,1,10,0,188,7,0,3,170,0,188,4,0,11,235,234,30,0,20,0,3,188,
+	0,156,15,0,1,10,0,176,1,0,45,74,146,22,184,75,102,73,28,34,72,29,6,0,
+	82,0,37,246,171,109,66,170,68,168,136,138,4,0,208,1,0,5,106,1,0,120,0,3,
+	130,0,104,0,176,23,0,117,68,34,36,102,143,212,157,189,134,218,109,251,173,105,20,241,
+	41,77,200,166,20,20,77,242,109,134,221,111,136,4,0,144,1,0,1,10,0,156,12,0,
+	5,27,11,0,92,0,3,203,0,46,2,1,1,0,156,5,0,3,187,0,188,9,0,1,
+	10,0,240,1,0,73,102,25,170,194,130,70,28,68,66,173,74,26,255,219,72,250,105,130,
+	10,0,112,0,3,74,0,68,0,3,136,0,68,0,23,172,36,200,66,98,38,0,72,0,
+	3,136,0,104,0,112,0,104,0,112,0,104,0,112,0,104,0,112,0,104,0,112,0,104,
+	0,112,0,104,0,112,0,104,0,112,0,104,0,112,0,104,0,112,0,104,0,112,0,117,
+	148,252,31,150,220,207,136,42,150,252,98,191,194,244,129,218,20,241,129,109,223,138,26,253,
+	102,255,200,200,130,4,0,176,1,0,1,10,0,188,7,0,3,187,0,156,4,0,5,27,
+	11,0,92,0,3,203,0,15,0,1,1,0,156,15,0,1,10,0,208,1,0,73,146,255,
+	209,217,202,168,249,136,36,173,17,187,79,164,42,221,152,40,10,0,80,0,3,34,0,76,
+	0,211,2,255,130,201,186,216,107,205,38,207,97,201,162,98,159,68,170,98,159,68,170,98,
+	159,68,170,98,159,68,170,98,159,68,170,98,159,68,170,98,159,68,170,98,159,68,170,98,
+	159,68,170,98,159,68,170,98,159,68,170,242,189,139,108,33,170,219,38,198,162,204,45,207,
+	186,129,108,150,150,97,138,171,148,98,129,162,33,217,200,66,0,208,1,0,84,0,220,11,
+	0,5,235,10,0,92,0,1,1,0,17,1,3,188,0,156,5,0,3,170,0,188,9,0,
+	1,10,0,240,1,0,105,191,171,20,26,33,79,150,171,106,248,189,41,77,20,33,180,159,
+	200,105,65,130,130,161,29,42,253,2,0,66,0,187,2,47,41,141,217,223,186,209,20,249,
+	28,209,20,249,28,209,20,249,28,209,20,249,28,209,20,249,28,209,20,249,28,209,20,249,
+	28,209,20,249,28,209,20,249,28,209,20,249,28,209,20,249,28,209,132,74,36,166,47,79,
+	104,22,73,205,203,207,244,177,25,220,155,156,42,219,102,108,72,106,43,207,219,79,0,176,
+	1,0,7,138,164,0,252,6,0,3,170,0,252,3,0,5,27,11,0,124,0,1,1,0,
+	16,0,3,188,0,156,15,0,1,10,0,144,1,0,72,0,25,33,134,194,129,223,17,2,
+	0,88,0,203,2,22,204,17,68,29,109,180,172,27,209,161,175,138,18,109,24,255,29,102,
+	105,191,168,108,137,139,153,66,164,209,66,72,164,209,66,72,164,209,66,72,164,209,66,72,
+	164,209,66,72,164,209,66,72,164,209,66,72,164,209,66,72,164,209,66,72,164,209,66,72,
+	164,209,66,40,137,24,205,107,204,22,242,76,79,27,152,155,0,76,0,57,65,109,171,20,
+	214,75,212,217,104,250,111,38,132,244,4,0,144,1,0,9,138,132,10,0,188,11,0,5,
+	27,11,0,124,0,3,203,0,15,2,1,1,0,156,5,0,3,187,0,188,9,0,1,10,
+	0,144,1,0,175,3,100,214,139,107,150,138,187,250,20,172,22,45,75,205,172,134,28,173,
+	107,219,204,134,156,172,223,146,191,75,244,152,150,97,28,180,194,212,72,186,152,29,72,186,
+	152,29,72,186,152,29,72,186,152,29,72,186,152,29,72,186,152,29,72,186,152,29,72,186,
+	152,29,72,186,152,29,72,186,152,29,72,186,152,189,242,130,106,79,77,212,75,221,74,146,
+	188,18,250,162,242,98,246,194,152,68,76,43,28,203,108,209,34,196,0,144,1,0,11,138,
+	132,168,0,252,6,0,3,187,0,252,3,0,5,235,10,0,124,0,3,203,0,15,0,1,
+	1,0,156,15,0,1,10,0,144,1,0,167,3,244,42,223,198,217,187,26,202,34,216,198,
+	76,27,210,34,106,182,217,136,74,107,194,219,180,216,44,139,65,100,200,196,136,255,184,148,
+	189,168,17,136,177,168,17,136,177,168,17,136,177,168,17,136,177,168,17,136,177,168,17,136,
+	177,168,17,136,177,168,17,136,177,168,17,136,177,168,17,136,177,168,17,136,139,41,36,188,
+	153,159,72,177,214,26,156,214,76,241,248,221,145,212,193,159,166,168,214,70,153,136,26,0,
+	68,0,1,15,0,112,0,5,138,4,0,80,0,1,10,0,156,11,0,5,27,11,0,156,
+	1,0,1,1,0,19,1,3,188,0,156,5,0,3,170,0,188,9,0,1,10,0,112,0,
+	185,2,132,108,20,246,38,130,155,44,216,17,44,41,171,188,210,148,184,107,36,177,201,242,
+	73,134,246,139,161,253,221,17,218,241,204,255,177,252,204,153,207,252,204,153,207,252,204,153,
+	207,252,204,153,207,252,204,153,207,252,204,153,207,252,204,153,207,252,204,153,207,252,204,153,
+	207,252,204,153,207,252,204,153,15,0,88,0,113,187,207,138,139,134,218,161,34,182,191,17,
+	28,173,77,70,143,171,29,253,40,203,98,255,157,241,169,241,41,15,0,80,0,5,138,4,
+	0,112,0,1,10,0,252,6,0,3,170,0,220,3,0,5,27,11,0,156,1,0,1,1,
+	0,39,0,3,188,0,156,15,0,1,10,0,80,0,37,132,106,97,217,253,221,33,182,27,
+	10,0,88,0,105,134,193,68,152,184,255,130,168,154,76,180,170,189,251,178,22,153,198,105,
+	38,249,70,72,36,198,44,8,0,72,0,9,98,70,8,0,72,0,9,98,70,8,0,72,
+	0,9,98,70,8,0,72,0,9,98,70,8,0,72,0,9,98,70,8,0,72,0,9,98,
+	70,8,0,72,0,9,98,70,8,0,72,0,9,98,70,8,0,72,0,9,98,70,8,0,
+	72,0,9,98,70,8,0,72,0,9,98,70,8,0,68,0,17,209,184,75,193,13,0,80,
+	0,89,17,169,196,249,40,169,70,161,221,218,159,130,97,169,140,242,102,76,155,202,136,138,
+	4,0,144,1,0,1,10,0,156,11,0,5,235,10,0,156,1,0,3,203,0,42,2,1,
+	1,0,156,5,0,3,187,0,188,9,0,75,138,72,168,136,132,200,210,43,166,106,157,162,
+	138,45,108,72,111,105,162,0,156,1,0,39,154,28,108,246,111,111,43,216,187,253,0,200,
+	1,0,112,0,7,146,41,0,112,0,104,0,112,0,104,0,112,0,104,0,112,0,104,0,
+	112,0,104,0,112,0,104,0,112,0,104,0,112,0,104,0,112,0,104,0,112,0,104,0,
+	112,0,104,0,80,0,113,100,219,220,26,68,209,25,168,161,201,173,185,140,150,218,172,188,
+	136,201,201,66,155,220,31,79,18,70,138,4,0,176,1,0,1,10,0,252,6,0,3,187,
+	0,188,3,0,5,27,11,0,188,1,0,3,203,0,17,0,1,1,0,156,15,0,9,138,
+	132,10,0,112,0,57,36,143,214,219,164,188,207,194,31,146,100,108,41,136,10,0,188,1,
+	0,39,42,28,255,102,111,28,220,250,207,70,0,144,26,0,3,36,0,76,0,101,255,65,
+	212,189,24,107,36,111,244,145,202,186,204,185,146,104,26,145,130,130,97,250,36,97,136,4,
+	0,208,1,0,1,10,0,252,10,0,5,27,11,0,188,1,0,1,1,0,27,1,3,188,
+	0,156,5,0,3,170,0,188,9,0,7,74,168,0,144,1,0,51,194,34,150,105,255,209,
+	70,106,132,76,201,203,130,0,148,1,0,124,0,11,74,25,107,0,94,0,11,203,150,102,
+	0,68,0,3,68,0,176,26,0,168,1,0,65,194,218,204,100,100,209,132,132,145,180,75,
+	136,250,43,111,138,15,0,72,0,23,221,105,97,20,43,72,0,240,1,0,1,10,0,252,
+	6,0,3,170,0,188,3,0,5,235,10,0,188,1,0,1,1,0,20,0,3,188,0,156,
+	15,0,84,0,144,1,0,53,146,17,152,172,28,31,169,40,70,216,31,189,79,10,0,80,
+	0,3,164,0,124,0,5,74,9,0,88,0,98,0,5,156,2,0,208,29,0,93,100,246,
+	161,132,42,40,100,24,24,210,73,107,216,34,164,154,156,161,185,105,252,248,76,4,0,144,
+	2,0,1,10,0,220,10,0,5,27,11,0,220,1,0,3,203,0,27,2,1,1,0,156,
+	5,0,3,187,0,252,9,0,1,10,0,144,1,0,49,242,141,252,182,146,159,250,28,244,
+	44,161,250,9,0,112,0,5,132,10,0,124,0,3,74,0,68,0,108,0,68,0,240,29,
+	0,72,0,3,201,0,86,0,75,106,217,79,186,20,210,41,196,186,186,186,246,100,164,41,
+	191,129,200,41,0,176,2,0,1,10,0,252,6,0,3,187,0,156,3,0,5,27,11,0,
+	220,1,0,3,203,0,18,0,1,1,0,220,15,0,1,10,0,176,1,0,43,166,216,105,
+	249,136,150,33,155,141,76,109,0,168,1,0,5,136,10,0,124,0,208,33,0,3,68,0,
+	68,0,73,156,24,141,129,77,18,143,17,106,132,132,130,210,253,198,41,109,108,2,0,208,
+	2,0,1,10,0,220,10,0,5,235,10,0,220,1,0,1,1,0,24,1,3,188,0,156,
+	5,0,3,170,0,252,9,0,1,10,0,112,0,45,170,20,107,22,36,17,153,203,74,66,
+	143,4,0,114,0,3,38,0,80,0,116,0,3,168,0,176,34,0,41,100,255,102,194,189,
+	223,44,198,98,188,10,0,76,0,27,170,137,212,162,45,207,38,0,208,2,0,1,10,0,
+	252,6,0,3,170,0,252,2,0,5,27,11,0,252,1,0,1,1,0,21,0,3,188,0,
+	220,15,0,1,10,0,80,0,9,138,138,6,0,68,0,9,28,252,15,0,90,0,33,40,
+	180,186,154,209,173,43,136,10,0,80,0,5,132,8,0,148,1,0,144,33,0,136,1,0,
+	67,146,209,204,136,98,250,217,201,76,186,108,66,186,248,246,156,41,0,176,2,0,1,10,
+	0,188,10,0,5,27,11,0,252,1,0,3,203,0,24,2,1,1,0,156,5,0,3,187,
+	0,252,9,0,15,138,168,40,136,0,72,0,49,198,17,150,98,141,180,140,169,189,155,180,
+	130,10,0,80,0,1,4,0,80,0,116,0,3,168,0,240,33,0,43,100,241,38,200,28,
+	171,212,203,76,38,25,0,86,0,21,200,253,185,138,251,2,0,144,2,0,1,10,0,252,
+	6,0,3,187,0,252,2,0,5,235,10,0,252,1,0,3,203,0,20,0,1,1,0,220,
+	15,0,13,138,138,66,4,0,80,0,49,244,187,241,68,198,253,168,28,139,159,223,47,8,
+	0,104,0,80,0,1,10,0,80,0,5,132,8,0,148,1,0,240,31,0,84,0,71,201,
+	203,241,207,28,18,244,109,191,188,198,75,41,169,242,102,74,44,0,144,2,0,1,10,0,
+	156,10,0,5,27,11,0,156,2,0,1,1,0,25,1,3,188,0,156,5,0,3,170,0,
+	252,9,0,11,170,40,68,0,112,0,47,244,29,186,68,194,180,171,77,79,44,75,150,0,
+	126,0,7,130,168,0,80,0,1,4,0,80,0,116,0,3,168,0,240,30,0,84,0,77,
+	168,154,65,207,169,98,150,44,44,196,250,186,209,185,201,216,132,159,105,4,0,144,2,0,
+	1,10,0,252,6,0,3,170,0,220,2,0,5,27,11,0,156,2,0,1,1,0,19,0,
+	3,188,0,188,15,0,11,234,42,68,0,144,1,0,61,250,152,25,130,200,66,216,172,108,
+	214,129,102,209,193,130,10,0,80,0,1,4,0,80,0,1,10,0,80,0,5,132,8,0,
+	244,30,0,85,168,138,68,185,203,136,220,180,73,70,200,138,45,244,171,221,107,138,141,40,
+	38,4,0,240,1,0,1,10,0,156,10,0,5,235,10,0,156,2,0,3,203,0,25,2,
+	1,1,0,156,5,0,3,187,0,188,9,0,11,234,174,138,0,180,1,0,59,152,248,185,
+	164,148,252,161,140,159,219,186,200,219,108,164,0,80,0,1,4,0,80,0,1,10,0,80,
+	0,1,4,0,80,0,148,1,0,188,29,0,87,138,132,42,191,136,132,187,210,216,18,207,
+	201,143,161,219,194,156,70,210,136,182,70,0,240,1,0,1,10,0,252,6,0,3,187,0,
+	188,2,0,5,27,11,0,188,2,0,3,203,0,26,0,1,1,0,252,14,0,1,10,0,
+	92,0,1,11,0,156,1,0,84,0,55,248,26,187,164,132,42,255,44,185,66,244,198,24,
+	108,0,112,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,
+	3,164,0,188,29,0,91,138,72,148,43,249,250,204,148,24,66,97,72,255,43,148,205,220,
+	188,168,77,139,79,34,0,176,1,0,1,10,0,252,9,0,5,27,11,0,188,2,0,1,
+	1,0,35,1,3,188,0,156,5,0,3,170,0,252,8,0,1,10,0,92,0,1,11,0,
+	188,1,0,27,74,168,172,193,44,136,138,0,72,0,27,182,219,196,132,214,137,47,0,80,
+	0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,5,132,10,
+	0,188,29,0,1,10,0,80,0,33,194,161,177,132,154,166,28,136,2,0,88,0,43,249,
+	194,242,26,108,194,180,216,139,150,156,0,176,1,0,1,10,0,252,6,0,3,170,0,188,
+	2,0,5,235,10,0,188,2,0,1,1,0,27,0,3,188,0,188,14,0,1,10,0,92,
+	0,1,11,0,220,1,0,59,138,68,65,164,108,168,72,168,36,175,185,182,74,66,250,0,
+	100,0,7,132,168,0,80,0,1,4,0,80,0,1,10,0,80,0,7,132,168,0,188,29,
+	0,1,10,0,80,0,33,180,246,18,156,189,198,185,146,9,0,72,0,43,193,186,43,43,
+	253,188,148,72,146,28,145,0,176,1,0,1,10,0,220,9,0,5,27,11,0,220,2,0,
+	3,203,0,27,2,1,1,0,156,5,0,3,187,0,188,8,0,1,10,0,92,0,1,11,
+	0,252,1,0,73,138,40,139,170,44,168,132,138,132,252,221,178,170,219,168,150,111,132,10,
+	0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,148,1,0,188,28,0,
+	91,138,72,210,188,203,26,98,152,68,193,180,219,108,139,223,164,70,169,104,162,152,186,47,
+	0,176,1,0,1,10,0,252,6,0,3,187,0,156,2,0,5,27,11,0,220,2,0,3,
+	203,0,25,0,1,1,0,252,13,0,1,10,0,92,0,1,11,0,156,2,0,71,138,40,
+	191,252,79,138,168,72,168,187,33,212,219,139,241,26,108,164,0,80,0,1,4,0,80,0,
+	1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,164,0,188,28,0,89,138,72,
+	22,253,42,191,204,137,242,251,156,201,244,76,214,250,143,171,242,244,41,253,2,0,208,1,
+	0,1,10,0,220,9,0,5,235,10,0,220,2,0,1,1,0,31,1,3,188,0,156,5,
+	0,3,170,0,252,7,0,1,10,0,92,0,1,11,0,188,2,0,67,138,242,171,205,73,
+	168,138,132,138,205,79,104,200,191,42,68,45,0,112,0,1,4,0,80,0,1,10,0,80,
+	0,1,4,0,80,0,1,10,0,80,0,5,132,10,0,188,28,0,41,138,40,177,251,76,
+	77,255,220,193,106,12,0,82,0,41,152,76,41,107,22,220,175,249,41,145,2,0,208,1,
+	0,1,10,0,252,6,0,3,170,0,252,1,0,5,27,11,0,252,2,0,1,1,0,29,
+	0,3,188,0,188,13,0,1,10,0,92,0,1,11,0,220,2,0,7,138,194,0,72,0,
+	29,154,132,170,132,138,100,157,8,0,98,0,13,246,108,220,1,0,112,0,1,4,0,80,
+	0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,7,132,168,0,188,28,0,89,
+	138,40,75,26,220,193,28,150,184,22,216,173,104,41,68,159,168,155,109,40,20,252,2,0,
+	208,1,0,1,10,0,188,9,0,5,27,11,0,252,2,0,3,203,0,32,2,1,1,0,
+	156,5,0,3,187,0,188,7,0,1,10,0,92,0,1,11,0,252,2,0,47,138,100,77,
+	136,140,168,136,138,132,106,17,159,0,94,0,13,27,38,198,6,0,72,0,80,0,1,10,
+	0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,148,1,0,188,27,0,
+	89,74,36,38,139,169,140,162,143,184,143,244,210,255,102,33,252,66,255,220,29,47,98,2,
+	0,208,1,0,1,10,0,252,6,0,3,187,0,252,1,0,5,235,10,0,252,2,0,3,
+	203,0,25,0,1,1,0,252,12,0,1,10,0,92,0,1,11,0,156,3,0,79,138,36,
+	129,177,76,132,170,72,168,72,66,98,130,194,159,41,204,102,130,168,0,80,0,1,4,0,
+	80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,164,0,188,27,0,91,
+	170,198,153,172,25,217,223,185,130,249,72,189,204,255,188,161,242,153,204,255,68,136,68,0,
+	176,1,0,1,10,0,156,9,0,5,27,11,0,156,3,0,1,1,0,31,1,3,188,0,
+	156,5,0,3,170,0,252,6,0,1,10,0,92,0,1,11,0,188,3,0,55,138,168,65,
+	29,111,132,170,132,138,132,138,68,136,36,0,104,0,13,152,28,134,10,0,80,0,1,4,
+	0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,5,132,10,0,188,27,
+	0,93,170,185,157,221,194,198,155,170,209,132,98,79,153,45,129,196,182,105,209,107,132,132,
+	138,4,0,144,1,0,1,10,0,252,6,0,3,170,0,220,1,0,5,27,11,0,156,3,
+	0,1,1,0,25,0,3,188,0,188,12,0,1,10,0,92,0,1,11,0,220,3,0,75,
+	138,168,44,137,108,132,138,168,72,168,72,168,72,168,72,170,66,201,166,0,80,0,1,4,
+	0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,7,132,168,0,188,27,
+	0,95,152,65,156,77,36,70,38,196,187,108,178,168,152,241,210,28,205,191,159,77,132,72,
+	168,72,0,112,0,1,10,0,156,9,0,5,235,10,0,156,3,0,3,203,0,32,2,1,
+	1,0,156,5,0,3,187,0,188,6,0,1,10,0,92,0,1,11,0,252,3,0,75,138,
+	72,223,136,44,132,168,138,132,138,132,138,132,138,132,74,132,154,108,0,72,0,80,0,1,
+	10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,148,1,0,252,25,
+	0,85,170,200,143,203,184,27,177,68,248,33,218,100,201,70,41,47,187,194,41,136,65,10,
+	0,80,0,9,132,138,4,0,80,0,1,10,0,252,6,0,3,187,0,188,1,0,5,27,
+	11,0,188,3,0,3,203,0,27,0,1,1,0,252,11,0,1,10,0,92,0,1,11,0,
+	156,4,0,19,138,72,25,27,79,0,80,0,61,170,132,138,132,138,132,138,132,138,164,42,
+	194,108,38,136,10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,
+	10,0,80,0,3,164,0,252,25,0,87,40,180,170,252,178,241,223,26,77,189,205,253,129,
+	180,152,29,132,221,187,178,47,168,0,80,0,15,132,138,132,168,0,252,8,0,5,27,11,
+	0,188,3,0,3,203,0,33,1,3,188,0,156,5,0,3,170,0,252,5,0,1,10,0,
+	92,0,1,11,0,188,4,0,19,138,148,161,26,73,0,80,0,39,138,168,72,168,72,168,
+	72,168,72,168,0,72,0,13,152,28,134,10,0,80,0,1,4,0,80,0,1,10,0,80,
+	0,1,4,0,80,0,1,10,0,80,0,5,132,10,0,188,25,0,93,74,249,97,253,162,
+	193,150,25,145,111,249,193,106,65,201,138,97,223,79,38,214,44,136,10,0,80,0,13,132,
+	138,132,10,0,252,6,0,3,170,0,188,1,0,5,235,10,0,188,3,0,3,203,0,31,
+	0,3,188,0,188,11,0,1,10,0,92,0,1,11,0,220,4,0,7,138,244,0,72,0,
+	5,154,4,0,112,0,55,170,72,168,72,168,72,168,72,168,72,170,66,201,166,0,80,0,
+	1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,7,132,168,0,
+	188,25,0,87,178,204,100,169,203,102,111,66,66,40,249,102,253,220,198,109,100,132,214,182,
+	25,44,0,80,0,1,10,0,80,0,11,132,138,164,0,220,8,0,5,27,11,0,220,3,
+	0,3,203,0,37,2,1,1,0,156,5,0,3,187,0,188,5,0,1,10,0,92,0,1,
+	11,0,252,4,0,17,138,100,77,136,12,0,144,1,0,55,170,132,138,132,138,132,138,132,
+	138,132,74,132,154,108,0,72,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,
+	80,0,1,4,0,80,0,148,1,0,252,23,0,43,74,143,148,111,178,28,159,105,130,170,
+	136,0,68,0,41,22,201,129,172,207,175,77,201,184,150,2,0,112,0,1,10,0,80,0,
+	3,132,0,84,0,252,6,0,3,187,0,156,1,0,5,27,11,0,220,3,0,3,203,0,
+	33,0,1,1,0,252,10,0,1,10,0,92,0,1,11,0,156,5,0,21,138,36,129,177,
+	76,4,0,80,0,67,138,168,72,168,72,168,72,168,72,168,72,170,34,204,102,130,168,0,
+	80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,164,
+	0,252,23,0,27,152,65,108,41,184,255,38,0,104,0,3,170,0,144,1,0,39,18,40,
+	191,68,79,107,148,146,186,47,0,176,1,0,1,10,0,80,0,3,164,0,156,9,0,5,
+	235,10,0,220,3,0,1,1,0,37,1,3,188,0,156,5,0,3,170,0,252,4,0,1,
+	10,0,92,0,1,11,0,188,5,0,21,138,168,65,29,111,4,0,112,0,43,170,72,168,
+	72,168,72,168,72,168,72,168,0,72,0,13,152,28,134,10,0,80,0,1,4,0,80,0,
+	1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,5,132,10,0,188,23,0,31,138,
+	148,42,168,193,220,156,66,0,144,1,0,1,10,0,144,1,0,43,18,146,161,139,217,170,
+	79,249,36,43,68,0,144,1,0,148,1,0,188,7,0,3,170,0,124,0,5,27,11,0,
+	252,3,0,1,1,0,31,0,3,188,0,188,10,0,1,10,0,92,0,1,11,0,220,5,
+	0,21,138,168,44,137,108,4,0,112,0,61,170,132,138,132,138,132,138,132,138,132,138,164,
+	42,148,108,10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,
+	0,80,0,7,132,168,0,188,23,0,31,154,31,180,207,193,220,200,66,0,112,0,1,10,
+	0,144,1,0,45,98,157,166,169,107,40,194,36,145,143,108,4,0,144,1,0,1,10,0,
+	252,9,0,5,27,11,0,252,3,0,3,203,0,37,2,1,1,0,156,5,0,3,187,0,
+	188,4,0,1,10,0,92,0,1,11,0,252,5,0,21,138,72,223,136,44,4,0,112,0,
+	61,138,168,72,168,72,168,72,168,72,168,72,168,68,168,201,6,0,72,0,80,0,1,10,
+	0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,148,1,0,252,21,0,
+	84,0,29,185,29,134,98,159,22,97,4,0,80,0,1,10,0,176,1,0,45,201,219,244,
+	188,45,255,214,145,196,241,20,2,0,144,1,0,1,10,0,188,8,0,3,187,0,124,0,
+	5,235,10,0,252,3,0,3,203,0,32,0,1,1,0,252,9,0,1,10,0,92,0,1,
+	11,0,156,6,0,19,138,72,25,27,79,0,176,1,0,71,170,72,168,72,168,72,168,72,
+	168,72,168,72,170,34,204,102,130,168,0,80,0,1,4,0,80,0,1,10,0,80,0,1,
+	4,0,80,0,1,10,0,80,0,3,164,0,252,21,0,15,74,100,203,70,0,208,1,0,
+	3,34,0,116,0,208,1,0,47,201,198,141,36,214,68,29,161,161,25,172,47,0,112,0,
+	1,10,0,220,9,0,5,27,11,0,156,4,0,1,1,0,39,1,3,188,0,156,5,0,
+	3,170,0,252,3,0,1,10,0,92,0,1,11,0,188,6,0,19,138,148,161,26,73,0,
+	176,1,0,49,170,132,138,132,138,132,138,132,138,132,138,132,10,0,72,0,13,152,28,134,
+	10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,
+	5,132,10,0,252,21,0,5,42,15,0,66,0,7,70,168,0,188,2,0,1,10,0,208,
+	1,0,49,34,196,250,109,137,102,66,141,47,109,150,253,2,0,80,0,1,10,0,188,8,
+	0,3,170,0,92,0,5,27,11,0,156,4,0,1,1,0,33,0,3,188,0,188,9,0,
+	1,10,0,92,0,1,11,0,220,6,0,7,138,244,0,72,0,5,154,4,0,176,1,0,
+	116,0,59,72,168,72,168,72,168,72,168,72,168,72,170,66,201,166,0,80,0,1,4,0,
+	80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,7,132,168,0,252,21,0,
+	19,42,203,102,66,168,0,188,2,0,1,10,0,176,2,0,49,18,191,97,98,136,26,47,
+	249,138,98,253,130,8,0,84,0,156,9,0,5,235,10,0,156,4,0,3,203,0,34,2,
+	1,1,0,156,5,0,3,187,0,188,3,0,1,10,0,92,0,1,11,0,252,6,0,17,
+	138,100,77,136,12,0,208,1,0,67,234,174,132,138,132,138,132,138,132,138,132,138,132,74,
+	132,154,108,0,72,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,
+	4,0,80,0,148,1,0,252,20,0,9,154,102,4,0,80,0,3,164,0,188,2,0,1,
+	10,0,176,2,0,55,100,161,75,242,65,173,248,150,31,65,140,130,138,164,0,252,7,0,
+	13,187,238,27,11,0,188,4,0,3,203,0,33,0,1,1,0,252,8,0,1,10,0,92,
+	0,1,11,0,156,7,0,21,138,36,129,177,76,4,0,144,1,0,5,234,14,0,84,0,
+	67,72,168,72,168,72,168,72,168,72,168,72,170,34,204,102,130,168,0,80,0,1,4,0,
+	80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,164,0,220,20,0,3,
+	74,0,112,0,148,1,0,188,2,0,1,10,0,176,2,0,55,100,156,253,186,250,220,170,
+	108,41,242,105,166,72,168,0,252,8,0,5,27,11,0,188,4,0,1,1,0,35,1,3,
+	188,0,156,5,0,3,170,0,252,2,0,1,10,0,92,0,1,11,0,188,7,0,21,138,
+	168,65,29,111,4,0,144,1,0,1,10,0,124,0,47,74,168,72,168,72,168,72,168,72,
+	168,72,168,0,72,0,13,152,28,134,10,0,80,0,1,4,0,80,0,1,10,0,80,0,
+	1,4,0,80,0,1,10,0,80,0,5,132,10,0,188,20,0,5,74,10,0,220,4,0,
+	1,10,0,176,2,0,55,148,253,75,207,73,98,68,252,130,40,172,33,132,168,0,252,7,
+	0,13,170,238,235,10,0,188,4,0,1,1,0,35,0,3,188,0,188,8,0,1,10,0,
+	92,0,1,11,0,220,7,0,21,138,168,44,137,108,4,0,144,1,0,1,10,0,124,0,
+	84,0,59,72,168,72,168,72,168,72,168,72,168,72,170,66,201,166,0,80,0,1,4,0,
+	80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,7,132,168,0,156,20,0,
+	5,74,10,0,252,4,0,7,138,68,0,100,0,72,0,39,105,74,161,73,210,187,74,252,
+	130,72,0,108,0,7,132,168,0,220,8,0,5,27,11,0,220,4,0,3,203,0,34,2,
+	1,1,0,156,5,0,3,187,0,188,2,0,1,10,0,92,0,1,11,0,252,7,0,21,
+	138,72,223,136,44,4,0,144,1,0,1,10,0,188,1,0,61,74,168,72,168,72,168,72,
+	168,72,168,72,168,68,168,201,6,0,72,0,80,0,1,10,0,80,0,1,4,0,80,0,
+	1,10,0,80,0,1,4,0,80,0,148,1,0,252,18,0,5,74,10,0,156,5,0,59,
+	74,98,177,27,38,242,139,102,66,22,150,217,29,41,136,0,168,1,0,5,136,10,0,252,
+	7,0,11,187,190,177,0,220,4,0,3,203,0,35,0,1,1,0,252,7,0,1,10,0,
+	92,0,1,11,0,156,8,0,19,138,72,25,27,79,0,176,1,0,1,10,0,188,1,0,
+	84,0,67,72,168,72,168,72,168,72,168,72,168,72,170,34,204,102,130,168,0,80,0,1,
+	4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,164,0,156,15,
+	0,148,3,0,7,136,164,0,188,5,0,45,170,134,36,66,218,187,34,184,198,168,42,10,
+	0,88,0,1,2,0,208,2,0,1,10,0,220,8,0,5,235,10,0,220,4,0,1,1,
+	0,41,1,3,188,0,156,5,0,3,170,0,252,1,0,1,10,0,92,0,1,11,0,188,
+	8,0,19,138,148,161,26,73,0,176,1,0,1,10,0,252,1,0,47,74,168,72,168,72,
+	168,72,168,72,168,72,168,0,72,0,13,152,28,134,10,0,80,0,1,4,0,80,0,1,
+	10,0,80,0,1,4,0,80,0,1,10,0,80,0,5,132,10,0,156,15,0,3,74,0,
+	176,2,0,7,36,169,0,156,6,0,7,153,204,0,66,0,1,12,0,76,0,27,202,130,
+	25,193,42,184,70,0,208,2,0,1,10,0,252,7,0,9,170,27,11,0,252,4,0,1,
+	1,0,36,0,3,188,0,188,7,0,1,10,0,92,0,1,11,0,220,8,0,7,138,244,
+	0,72,0,5,154,4,0,176,1,0,1,10,0,252,1,0,84,0,59,72,168,72,168,72,
+	168,72,168,72,168,72,170,66,201,166,0,80,0,1,4,0,80,0,1,10,0,80,0,1,
+	4,0,80,0,1,10,0,80,0,7,132,168,0,156,15,0,3,138,0,168,2,0,7,146,
+	168,0,156,6,0,49,41,29,104,202,187,200,73,136,159,170,43,38,4,0,208,2,0,1,
+	10,0,188,8,0,5,27,11,0,252,4,0,3,203,0,35,2,1,1,0,156,5,0,3,
+	187,0,188,1,0,1,10,0,92,0,1,11,0,252,8,0,17,138,100,77,136,12,0,208,
+	1,0,1,10,0,188,2,0,61,74,168,72,168,72,168,72,168,72,168,72,168,68,168,201,
+	6,0,72,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,
+	80,0,148,1,0,156,14,0,31,138,40,102,34,102,146,134,168,0,156,6,0,47,169,98,
+	74,104,244,200,73,72,156,241,106,66,0,240,2,0,1,10,0,252,7,0,86,0,3,174,
+	0,252,4,0,3,203,0,33,0,1,1,0,252,6,0,1,10,0,92,0,1,11,0,156,
+	9,0,21,138,36,129,177,76,4,0,144,1,0,1,10,0,188,2,0,84,0,67,72,168,
+	72,168,72,168,72,168,72,168,72,170,34,204,102,130,168,0,80,0,1,4,0,80,0,1,
+	10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,164,0,156,11,0,148,3,0,29,
+	136,242,204,105,17,155,136,10,0,252,5,0,49,74,175,202,76,218,150,250,36,220,31,76,
+	17,2,0,240,2,0,1,10,0,188,8,0,3,187,0,156,5,0,1,1,0,39,1,3,
+	188,0,156,5,0,3,170,0,124,0,1,10,0,92,0,1,11,0,188,9,0,21,138,168,
+	65,29,111,4,0,144,1,0,1,10,0,252,2,0,47,74,168,72,168,72,168,72,168,72,
+	168,72,168,0,72,0,13,152,28,134,10,0,80,0,1,4,0,80,0,1,10,0,80,0,
+	1,4,0,80,0,1,10,0,80,0,5,132,10,0,156,11,0,3,74,0,208,2,0,29,
+	138,146,172,203,152,33,136,10,0,252,5,0,17,74,31,139,65,11,0,68,0,25,253,36,
+	220,223,104,17,2,0,240,2,0,1,10,0,252,7,0,7,170,187,0,156,5,0,1,1,
+	0,33,0,3,188,0,156,5,0,15,170,68,72,136,0,84,0,188,9,0,21,138,168,44,
+	137,108,4,0,144,1,0,1,10,0,252,2,0,84,0,59,72,168,72,168,72,168,72,168,
+	72,168,72,170,66,201,166,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,
+	0,1,10,0,80,0,7,132,168,0,156,11,0,5,138,4,0,208,2,0,27,42,249,75,
+	242,249,132,168,0,252,5,0,49,74,246,129,220,217,29,111,68,31,130,170,207,2,0,240,
+	2,0,1,10,0,220,7,0,9,34,234,11,0,156,5,0,3,203,0,34,2,1,1,0,
+	188,5,0,1,6,0,88,0,11,153,255,164,0,188,9,0,21,138,72,223,136,44,4,0,
+	144,1,0,1,10,0,188,3,0,61,74,168,72,168,72,168,72,168,72,168,72,168,68,168,
+	201,6,0,72,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,
+	0,80,0,148,1,0,156,10,0,7,138,72,0,112,0,39,68,146,41,72,220,100,143,205,
+	66,168,0,252,5,0,49,74,182,138,185,217,251,38,68,175,255,34,253,2,0,240,2,0,
+	1,10,0,220,7,0,9,249,162,11,0,156,5,0,3,203,0,33,0,1,1,0,156,5,
+	0,19,196,36,68,66,155,0,220,9,0,19,138,72,25,27,79,0,176,1,0,1,10,0,
+	188,3,0,84,0,67,72,168,72,168,72,168,72,168,72,168,72,170,34,204,102,130,168,0,
+	80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,164,
+	0,220,9,0,84,0,80,0,104,0,39,98,141,251,207,33,43,246,28,70,168,0,252,5,
+	0,49,74,18,130,105,187,145,66,72,143,170,162,108,2,0,240,2,0,1,10,0,220,7,
+	0,9,201,159,10,0,156,5,0,1,1,0,37,1,3,188,0,156,5,0,23,244,20,72,
+	43,155,170,0,156,9,0,19,138,148,161,26,73,0,176,1,0,1,10,0,252,3,0,47,
+	74,168,72,168,72,168,72,168,72,168,72,168,0,72,0,13,152,28,134,10,0,80,0,1,
+	4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,5,132,10,0,220,
+	9,0,5,74,4,0,80,0,1,2,0,108,0,37,24,169,138,186,164,148,255,38,132,10,
+	0,252,5,0,15,74,166,153,164,0,66,0,27,73,136,244,27,172,130,33,0,240,2,0,
+	1,10,0,220,7,0,9,132,34,11,0,156,5,0,1,1,0,34,0,3,188,0,156,5,
+	0,23,154,178,168,216,155,164,0,156,9,0,7,138,244,0,72,0,5,154,4,0,176,1,
+	0,1,10,0,252,3,0,84,0,59,72,168,72,168,72,168,72,168,72,168,72,170,66,201,
+	166,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,
+	7,132,168,0,220,9,0,59,138,98,153,207,189,43,253,138,17,104,150,253,73,138,164,0,
+	252,5,0,25,42,161,72,34,107,111,4,0,80,0,17,196,169,186,98,4,0,240,2,0,
+	1,10,0,220,7,0,5,27,11,0,220,5,0,3,203,0,35,2,1,1,0,252,4,0,
+	25,234,168,129,198,171,33,10,0,156,9,0,17,138,100,77,136,12,0,208,1,0,1,10,
+	0,188,4,0,61,74,168,72,168,72,168,72,168,72,168,72,168,68,168,201,6,0,72,0,
+	80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,148,1,
+	0,220,8,0,53,138,242,209,189,100,246,162,148,136,38,187,109,66,8,0,84,0,252,5,
+	0,19,42,246,140,130,155,0,72,0,80,0,17,196,25,175,38,4,0,240,2,0,1,10,
+	0,220,7,0,3,235,0,84,0,156,5,0,3,203,0,39,0,1,1,0,252,4,0,25,
+	27,42,136,79,134,44,10,0,156,9,0,21,138,36,129,177,76,4,0,144,1,0,1,10,
+	0,188,4,0,84,0,67,72,168,72,168,72,168,72,168,72,168,72,170,34,204,102,130,168,
+	0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,
+	164,0,156,6,0,212,2,0,13,242,22,137,8,0,88,0,15,185,184,202,134,0,90,0,
+	11,107,136,164,0,188,6,0,11,138,146,209,0,88,0,3,70,0,112,0,19,194,253,193,
+	20,33,0,240,2,0,1,10,0,188,7,0,5,27,11,0,252,5,0,1,1,0,39,1,
+	3,188,0,252,4,0,25,27,78,70,148,28,66,10,0,156,9,0,21,138,168,65,29,111,
+	4,0,144,1,0,1,10,0,252,4,0,47,74,168,72,168,72,168,72,168,72,168,72,168,
+	0,72,0,13,152,28,134,10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,
+	80,0,1,10,0,80,0,5,132,10,0,156,6,0,3,74,0,112,0,72,0,51,42,28,
+	189,45,217,65,162,106,218,178,209,97,66,0,84,0,188,6,0,11,138,40,153,0,68,0,
+	3,68,0,112,0,19,194,253,141,22,33,0,240,2,0,1,10,0,188,7,0,11,27,235,
+	187,0,156,5,0,1,1,0,34,0,3,188,0,220,4,0,27,234,221,65,22,219,42,170,
+	0,156,9,0,21,138,168,44,137,108,4,0,144,1,0,1,10,0,252,4,0,84,0,59,
+	72,168,72,168,72,168,72,168,72,168,72,170,66,201,166,0,80,0,1,4,0,80,0,1,
+	10,0,80,0,1,4,0,80,0,1,10,0,80,0,7,132,168,0,156,6,0,3,74,0,
+	68,0,61,36,246,188,34,132,100,201,184,223,223,76,182,17,70,132,10,0,252,6,0,1,
+	10,0,176,3,0,19,244,33,168,250,44,0,240,2,0,1,10,0,188,7,0,5,235,10,
+	0,252,5,0,3,203,0,36,2,1,1,0,220,4,0,15,187,104,34,42,0,72,0,1,
+	15,0,220,9,0,21,138,72,223,136,44,4,0,144,1,0,1,10,0,188,5,0,61,74,
+	168,72,168,72,168,72,168,72,168,72,168,68,168,201,6,0,72,0,80,0,1,10,0,80,
+	0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,148,1,0,156,5,0,63,74,
+	182,97,182,42,204,250,79,159,194,248,210,150,244,210,97,0,80,0,1,10,0,252,6,0,
+	1,10,0,176,3,0,19,244,250,47,210,47,0,240,2,0,1,10,0,156,7,0,13,27,
+	235,174,10,0,156,5,0,3,203,0,35,0,1,1,0,188,4,0,84,0,19,249,220,253,
+	161,250,0,220,9,0,19,138,72,25,27,79,0,176,1,0,1,10,0,188,5,0,84,0,
+	67,72,168,72,168,72,168,72,168,72,168,72,170,34,204,102,130,168,0,80,0,1,4,0,
+	80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,164,0,188,5,0,61,
+	201,138,220,201,106,178,146,66,218,106,209,36,72,255,26,6,0,80,0,1,10,0,252,6,
+	0,1,10,0,176,3,0,19,244,168,42,202,38,0,240,2,0,1,10,0,156,7,0,5,
+	27,11,0,156,6,0,1,1,0,35,1,3,188,0,156,4,0,27,42,132,164,25,143,200,
+	33,0,220,9,0,19,138,148,161,26,73,0,176,1,0,1,10,0,252,5,0,47,74,168,
+	72,168,72,168,72,168,72,168,72,168,0,72,0,13,152,28,134,10,0,80,0,1,4,0,
+	80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,5,132,10,0,188,5,0,
+	61,178,34,244,177,182,219,29,221,138,139,220,42,184,164,203,6,0,80,0,1,10,0,252,
+	6,0,1,10,0,176,3,0,19,244,27,172,130,33,0,240,2,0,1,10,0,156,7,0,
+	13,235,234,190,11,0,156,5,0,1,1,0,34,0,3,188,0,156,4,0,27,170,219,173,
+	31,184,22,79,0,220,9,0,7,138,244,0,72,0,5,154,4,0,176,1,0,1,10,0,
+	252,5,0,84,0,59,72,168,72,168,72,168,72,168,72,168,72,170,66,201,166,0,80,0,
+	1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,7,132,168,0,
+	188,5,0,69,178,102,148,66,111,45,29,146,24,74,251,44,248,29,108,41,136,10,0,252,
+	6,0,1,10,0,208,3,0,17,196,169,186,98,4,0,240,2,0,1,10,0,252,6,0,
+	5,27,11,0,188,6,0,3,203,0,34,2,1,1,0,188,4,0,25,27,174,217,24,191,
+	241,4,0,220,9,0,17,138,100,77,136,12,0,208,1,0,1,10,0,188,6,0,61,74,
+	168,72,168,72,168,72,168,72,168,72,168,68,168,201,6,0,72,0,80,0,1,10,0,80,
+	0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,148,1,0,252,3,0,73,138,
+	140,130,220,189,20,214,139,161,28,218,107,77,193,153,155,47,136,10,0,252,6,0,1,10,
+	0,208,3,0,17,196,25,175,38,4,0,240,2,0,1,10,0,252,6,0,5,27,11,0,
+	92,0,3,170,0,156,5,0,3,203,0,36,0,1,1,0,156,4,0,27,234,187,24,36,
+	24,219,169,0,220,9,0,21,138,36,129,177,76,4,0,144,1,0,1,10,0,188,6,0,
+	84,0,67,72,168,72,168,72,168,72,168,72,168,72,170,34,204,102,130,168,0,80,0,1,
+	4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,3,164,0,252,3,
+	0,9,154,45,4,0,116,0,9,194,77,8,0,90,0,39,180,146,191,137,178,34,75,156,
+	130,168,0,252,6,0,1,10,0,176,3,0,19,194,253,193,20,33,0,240,2,0,1,10,
+	0,252,6,0,5,235,10,0,188,6,0,1,1,0,41,1,3,188,0,156,4,0,3,187,
+	0,84,0,15,102,27,205,42,0,252,9,0,21,138,168,65,29,111,4,0,144,1,0,1,
+	10,0,252,6,0,47,74,168,72,168,72,168,72,168,72,168,72,168,0,72,0,13,152,28,
+	134,10,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,
+	0,9,132,234,14,0,212,1,0,7,136,68,0,112,0,43,25,36,98,164,97,28,177,150,
+	66,29,40,0,76,0,21,168,42,68,73,132,10,0,252,6,0,1,10,0,176,3,0,19,
+	194,253,141,22,33,0,240,2,0,1,10,0,220,6,0,5,27,11,0,124,0,3,187,0,
+	156,5,0,1,1,0,31,0,3,188,0,156,4,0,25,187,136,250,137,248,26,9,0,252,
+	9,0,21,138,168,44,137,108,4,0,144,1,0,1,10,0,252,6,0,84,0,61,72,168,
+	72,168,72,168,72,168,72,168,72,170,66,201,70,2,0,72,0,80,0,1,10,0,80,0,
+	1,4,0,80,0,1,10,0,80,0,15,132,168,238,74,0,144,1,0,87,100,204,102,159,
+	242,24,209,248,75,168,76,140,175,129,33,107,219,159,138,223,136,164,0,252,6,0,1,10,
+	0,176,3,0,19,244,33,168,250,44,0,240,2,0,1,10,0,220,6,0,5,27,11,0,
+	220,6,0,3,203,0,36,2,1,1,0,252,3,0,3,234,0,86,0,19,244,251,136,68,
+	168,0,220,9,0,21,138,72,223,136,44,4,0,144,1,0,1,10,0,188,7,0,75,74,
+	168,72,168,72,168,72,168,72,168,72,168,68,168,201,27,255,130,168,0,80,0,1,4,0,
+	80,0,1,10,0,80,0,1,4,0,80,0,116,0,3,72,0,112,0,27,148,139,187,196,
+	182,97,105,0,80,0,53,209,248,130,241,212,191,253,201,111,73,200,41,168,10,0,252,6,
+	0,1,10,0,176,3,0,19,244,250,47,210,47,0,240,2,0,1,10,0,220,6,0,5,
+	235,10,0,124,0,3,170,0,156,5,0,3,203,0,34,0,1,1,0,252,3,0,3,27,
+	0,86,0,19,148,182,178,34,168,0,220,9,0,19,138,72,25,27,79,0,176,1,0,1,
+	10,0,188,7,0,84,0,67,72,168,72,168,72,168,72,168,72,168,72,170,34,140,26,44,
+	168,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,112,0,
+	5,138,4,0,80,0,83,148,43,40,29,98,244,223,156,246,111,242,143,97,47,187,26,31,
+	45,68,134,134,0,188,7,0,1,10,0,176,3,0,19,244,168,42,202,38,0,240,2,0,
+	1,10,0,188,6,0,5,27,11,0,252,6,0,1,1,0,35,1,3,188,0,252,3,0,
+	27,27,238,75,153,156,140,155,0,252,9,0,19,138,148,161,26,73,0,176,1,0,1,10,
+	0,252,7,0,49,74,168,72,168,72,168,72,168,72,168,72,168,4,0,68,0,11,173,241,
+	164,0,80,0,1,4,0,80,0,1,10,0,80,0,1,4,0,80,0,1,10,0,80,0,
+	59,164,138,72,136,100,172,65,173,173,72,156,154,28,202,76,0,66,0,33,223,132,134,137,
+	204,187,136,79,10,0,188,7,0,1,10,0,176,3,0,19,244,27,172,130,33,0,240,2,
+	0,1,10,0,188,6,0,5,27,11,0,156,1,0,3,187,0,156,5,0,1,1,0,35,
+	0,3,188,0,220,3,0,29,234,187,177,72,70,252,212,9,0,252,9,0,7,138,244,0,
+	72,0,5,154,4,0,176,1,0,1,10,0,252,7,0,84,0,61,72,168,72,168,72,168,
+	72,168,72,168,40,100,203,17,47,2,0,72,0,80,0,1,10,0,80,0,1,4,0,80,
+	0,1,10,0,80,0,7,132,170,0,80,0,67,68,98,172,141,198,241,74,138,170,105,130,
+	191,216,76,75,73,106,0,68,0,9,249,17,2,0,252,7,0,1,10,0,208,3,0,17,
+	196,169,186,98,4,0,240,2,0,1,10,0,188,6,0,5,235,10,0,252,6,0,3,203,
+	0,33,2,1,1,0,220,3,0,31,27,187,209,170,255,27,22,162,0,220,9,0,17,138,
+	100,77,136,12,0,208,1,0,1,10,0,188,8,0,75,74,168,72,168,72,168,72,168,72,
+	168,40,249,17,107,22,29,255,130,168,0,80,0,1,4,0,80,0,1,10,0,80,0,9,
+	132,168,10,0,112,0,31,98,191,40,204,27,169,164,139,0,94,0,25,209,26,25,161,97,
+	216,6,0,116,0,9,68,34,10,0,252,7,0,1,10,0,208,3,0,17,196,25,175,38,
+	4,0,240,2,0,1,10,0,156,6,0,5,27,11,0,188,1,0,3,170,0,156,5,0,
+	3,203,0,32,0,1,1,0,220,3,0,31,27,238,173,238,134,36,109,162,0,220,9,0,
+	21,138,36,129,177,76,4,0,144,1,0,1,10,0,188,8,0,84,0,43,72,168,72,168,
+	72,168,72,168,40,194,186,0,94,0,17,194,41,193,130,10,0,80,0,1,4,0,80,0,
+	1,10,0,80,0,1,4,0,80,0,3,170,0,112,0,63,196,17,28,182,138,169,204,26,
+	38,198,150,75,34,143,170,145,0,156,10,0,1,10,0,176,3,0,19,194,253,193,20,33,
+	0,240,2,0,1,10,0,156,6,0,5,27,11,0,156,7,0,1,1,0,36,1,3,188,
+	0,188,3,0,21,234,187,209,234,46,15,0,76,0,5,130,10,0,220,9,0,21,138,168,
+	65,29,111,4,0,144,1,0,1,10,0,252,8,0,47,74,168,72,168,72,168,72,168,72,
+	100,17,251,0,100,0,11,36,193,130,0,104,0,80,0,1,10,0,80,0,1,4,0,80,
+	0,7,138,168,0,80,0,33,196,250,246,220,162,42,102,191,12,0,76,0,23,74,109,145,
+	79,27,145,0,156,10,0,1,10,0,176,3,0,19,194,253,141,22,33,0,240,2,0,1,
+	10,0,156,6,0,5,235,10,0,188,1,0,3,187,0,156,5,0,1,1,0,27,0,3,
+	188,0,188,3,0,33,27,187,209,234,142,223,97,130,10,0,220,9,0,21,138,168,44,137,
+	108,4,0,144,1,0,1,10,0,252,8,0,84,0,35,72,168,72,168,72,168,72,72,255,
+	0,82,0,27,38,182,177,221,204,41,38,0,80,0,72,0,11,66,136,36,0,80,0,71,
+	138,40,187,28,189,171,187,145,210,36,189,249,70,219,153,196,246,164,0,252,9,0,1,10,
+	0,176,3,0,19,244,33,168,250,44,0,240,2,0,1,10,0,252,5,0,5,27,11,0,
+	188,7,0,3,203,0,29,0,3,188,0,188,3,0,11,27,238,173,0,92,0,15,248,221,
+	70,164,0,220,9,0,21,138,72,223,136,44,4,0,144,1,0,1,10,0,188,9,0,33,
+	74,168,72,168,72,168,72,168,2,0,82,0,55,98,207,17,251,129,153,205,97,136,249,207,
+	38,36,156,0,112,0,21,138,210,180,136,45,1,0,84,0,41,75,152,68,40,207,143,20,
+	33,72,76,10,0,252,9,0,1,10,0,176,3,0,19,244,250,47,210,47,0,240,2,0,
+	1,10,0,252,5,0,5,27,11,0,220,1,0,3,170,0,156,5,0,3,203,0,27,0,
+	3,188,0,156,3,0,13,234,187,209,10,0,92,0,9,74,98,9,0,84,0,220,9,0,
+	19,138,72,25,27,79,0,176,1,0,1,10,0,188,9,0,84,0,43,72,168,72,168,72,
+	168,72,132,242,191,186,0,94,0,39,25,191,20,108,40,28,27,41,22,156,0,112,0,67,
+	66,162,156,98,129,153,17,44,29,204,150,25,130,134,162,189,153,0,156,10,0,1,10,0,
+	176,3,0,19,244,168,42,202,38,0,240,2,0,1,10,0,252,5,0,5,235,10,0,188,
+	7,0,1,1,0,31,2,1,1,0,156,3,0,13,27,187,209,10,0,92,0,1,10,0,
+	80,0,1,10,0,188,10,0,19,138,148,161,26,73,0,176,1,0,1,10,0,252,9,0,
+	47,74,168,72,168,72,168,72,168,40,169,180,253,0,108,0,69,100,218,108,255,45,202,246,
+	136,159,66,36,207,198,36,201,25,97,13,0,94,0,25,241,107,188,219,143,130,6,0,94,
+	0,7,104,170,0,220,9,0,1,10,0,176,3,0,19,244,27,172,130,33,0,240,2,0,
+	1,10,0,220,5,0,5,27,11,0,252,1,0,3,187,0,156,5,0,1,1,0,24,0,
+	1,1,0,156,3,0,11,27,238,173,0,124,0,9,42,38,10,0,188,10,0,7,138,244,
+	0,72,0,5,154,4,0,176,1,0,1,10,0,252,9,0,84,0,165,1,72,168,72,168,
+	72,168,72,148,221,102,28,172,68,31,193,175,77,98,169,68,250,198,207,31,203,22,194,22,
+	198,150,177,159,106,31,107,108,155,143,185,178,70,10,0,220,9,0,1,10,0,208,3,0,
+	17,196,169,186,98,4,0,240,2,0,1,10,0,220,5,0,5,27,11,0,220,7,0,3,
+	203,0,27,1,3,188,0,252,2,0,13,234,187,209,10,0,124,0,9,42,207,2,0,188,
+	10,0,17,138,100,77,136,12,0,208,1,0,1,10,0,188,10,0,33,74,168,72,168,72,
+	168,72,72,15,0,76,0,85,185,139,38,22,152,107,76,132,198,153,162,105,177,209,217,171,
+	200,31,242,141,210,15,0,82,0,35,209,137,187,42,198,17,77,109,164,0,220,9,0,1,
+	10,0,208,3,0,17,196,25,175,38,4,0,240,2,0,1,10,0,220,5,0,5,235,10,
+	0,252,1,0,3,170,0,156,5,0,3,203,0,24,0,3,188,0,252,2,0,13,27,187,
+	209,10,0,124,0,9,138,100,2,0,188,10,0,21,138,36,129,177,76,4,0,144,1,0,
+	1,10,0,188,10,0,84,0,25,72,168,72,168,72,168,2,0,82,0,129,1,191,139,246,
+	153,204,106,185,162,22,27,108,109,18,187,178,156,145,68,150,185,170,200,220,164,186,201,77,
+	152,77,26,140,156,8,0,220,9,0,1,10,0,176,3,0,19,194,253,193,20,33,0,240,
+	2,0,1,10,0,188,5,0,5,27,11,0,252,7,0,1,1,0,25,2,1,1,0,252,
+	2,0,11,27,238,173,0,156,1,0,1,10,0,80,0,1,10,0,188,10,0,21,138,168,
+	65,29,111,4,0,144,1,0,1,10,0,252,10,0,163,1,74,168,72,168,72,168,72,36,
+	207,241,79,26,209,193,40,27,102,106,44,212,159,189,43,75,105,244,130,201,20,244,154,139,
+	18,66,104,255,66,141,200,136,140,0,220,9,0,1,10,0,176,3,0,19,194,253,141,22,
+	33,0,240,2,0,1,10,0,188,5,0,5,27,11,0,156,2,0,3,187,0,156,5,0,
+	1,1,0,22,0,1,1,0,220,2,0,13,234,187,209,10,0,156,1,0,9,42,38,10,
+	0,188,10,0,21,138,168,44,137,108,4,0,144,1,0,1,10,0,252,10,0,84,0,157,
+	1,72,168,72,168,72,40,129,218,43,138,27,209,212,42,196,173,166,168,220,141,196,20,248,
+	162,146,70,102,191,205,66,196,153,220,173,77,130,36,205,17,2,0,220,9,0,1,10,0,
+	176,3,0,19,244,33,168,250,44,0,240,2,0,1,10,0,188,5,0,5,235,10,0,252,
+	7,0,3,203,0,23,1,3,188,0,220,2,0,13,27,187,209,10,0,156,1,0,9,42,
+	207,2,0,188,10,0,21,138,72,223,136,44,4,0,144,1,0,1,10,0,188,11,0,159,
+	1,74,168,72,168,72,136,79,34,191,223,198,169,26,109,129,162,196,178,109,210,70,170,193,
+	161,210,45,74,100,194,106,196,252,137,34,155,168,29,47,146,159,0,220,9,0,1,10,0,
+	176,3,0,19,244,250,47,210,47,0,240,2,0,1,10,0,156,5,0,5,27,11,0,188,
+	2,0,3,170,0,156,5,0,3,203,0,22,0,3,188,0,220,2,0,11,27,238,173,0,
+	188,1,0,9,138,100,2,0,188,10,0,19,138,72,25,27,79,0,176,1,0,1,10,0,
+	188,11,0,84,0,155,1,72,168,72,168,244,42,194,106,189,221,191,153,26,79,24,45,24,
+	41,68,153,214,186,104,202,214,218,200,43,196,138,145,70,145,104,77,145,136,34,168,0,188,
+	9,0,1,10,0,176,3,0,19,244,168,42,202,38,0,240,2,0,1,10,0,156,5,0,
+	5,27,11,0,156,8,0,1,1,0,29,2,1,1,0,188,2,0,13,234,187,209,10,0,
+	188,1,0,1,10,0,80,0,1,10,0,188,10,0,19,138,148,161,26,73,0,176,1,0,
+	1,10,0,252,11,0,73,74,168,72,168,72,214,72,153,145,161,97,201,26,250,173,187,132,
+	205,1,0,72,0,65,33,186,253,43,201,198,252,106,153,150,209,70,73,130,73,26,9,0,
+	144,1,0,1,10,0,188,9,0,1,10,0,176,3,0,19,244,27,172,130,33,0,240,2,
+	0,1,10,0,156,5,0,5,235,10,0,188,2,0,3,187,0,156,5,0,1,1,0,30,
+	0,1,1,0,188,2,0,13,27,187,209,10,0,188,1,0,9,42,38,10,0,188,10,0,
+	7,138,244,0,72,0,5,154,4,0,176,1,0,1,10,0,252,11,0,84,0,103,72,168,
+	72,104,145,220,161,102,24,246,100,194,242,41,150,205,109,34,79,191,106,156,18,70,162,169,
+	0,82,0,21,134,205,210,148,193,1,0,94,0,1,2,0,144,1,0,1,10,0,188,9,
+	0,1,10,0,208,3,0,17,196,169,186,98,4,0,240,2,0,1,10,0,252,4,0,5,
+	27,11,0,188,8,0,3,203,0,25,1,3,188,0,188,2,0,11,27,238,173,0,220,1,
+	0,9,42,207,2,0,188,10,0,17,138,100,77,136,12,0,208,1,0,1,10,0,188,12,
+	0,141,1,74,168,72,136,66,40,22,100,139,68,173,219,102,255,18,244,194,248,146,205,17,
+	102,44,202,43,253,186,168,241,45,220,164,200,180,66,4,0,144,1,0,1,10,0,188,9,
+	0,1,10,0,208,3,0,17,196,25,175,38,4,0,240,2,0,1,10,0,252,4,0,5,
+	27,11,0,220,2,0,3,170,0,156,5,0,3,203,0,26,0,3,188,0,156,2,0,13,
+	234,187,209,10,0,220,1,0,9,138,100,2,0,188,10,0,21,138,36,129,177,76,4,0,
+	144,1,0,1,10,0,188,12,0,84,0,3,72,0,80,0,127,138,40,198,141,98,40,172,
+	252,251,136,244,100,171,29,38,40,111,17,27,193,185,45,203,148,25,210,246,74,210,201,169,
+	72,0,112,0,1,10,0,188,9,0,1,10,0,176,3,0,19,194,253,193,20,33,0,240,
+	2,0,1,10,0,252,4,0,5,235,10,0,188,8,0,1,1,0,31,2,1,1,0,156,
+	2,0,13,27,187,209,10,0,220,1,0,1,10,0,80,0,1,10,0,188,10,0,21,138,
+	168,65,29,111,4,0,144,1,0,1,10,0,252,12,0,3,74,0,80,0,1,10,0,80,
+	0,123,98,191,146,155,252,104,65,205,44,66,143,143,36,242,204,166,75,220,66,100,172,47,
+	43,210,109,66,138,145,156,168,72,0,80,0,1,10,0,188,9,0,1,10,0,176,3,0,
+	19,194,253,141,22,33,0,240,2,0,1,10,0,220,4,0,5,27,11,0,252,2,0,3,
+	187,0,156,5,0,1,1,0,23,0,1,1,0,156,2,0,11,27,238,173,0,252,1,0,
+	9,42,38,10,0,188,10,0,21,138,168,44,137,108,4,0,144,1,0,1,10,0,252,12,
+	0,148,1,0,80,0,133,1,68,242,155,104,25,146,138,153,139,178,108,130,194,77,214,207,
+	154,248,73,218,162,132,152,205,34,248,153,252,100,130,168,72,136,10,0,188,9,0,1,10,
+	0,176,3,0,19,244,33,168,250,44,0,240,2,0,1,10,0,220,4,0,5,27,11,0,
+	220,8,0,3,203,0,27,1,3,188,0,252,1,0,13,234,187,209,10,0,252,1,0,9,
+	42,207,2,0,188,10,0,21,138,72,223,136,44,4,0,144,1,0,1,10,0,252,13,0,
+	13,138,72,168,2,0,114,0,103,38,31,106,130,26,150,186,41,65,139,186,219,134,209,242,
+	107,180,170,246,201,207,146,38,250,140,38,0,80,0,9,138,132,10,0,188,9,0,1,10,
+	0,176,3,0,19,244,250,47,210,47,0,240,2,0,1,10,0,220,4,0,5,235,10,0,
+	252,2,0,3,170,0,156,5,0,3,203,0,25,0,3,188,0,252,1,0,13,27,187,209,
+	10,0,252,1,0,9,138,100,2,0,188,10,0,19,138,72,25,27,79,0,176,1,0,1,
+	10,0,252,13,0,19,138,132,138,68,136,0,104,0,97,249,28,203,66,31,248,253,188,75,
+	38,25,210,156,184,210,250,138,111,75,244,146,109,148,20,6,0,112,0,7,138,164,0,188,
+	9,0,1,10,0,176,3,0,19,244,168,42,202,38,0,240,2,0,1,10,0,188,4,0,
+	5,27,11,0,252,8,0,1,1,0,31,2,1,1,0,252,1,0,11,27,238,173,0,156,
+	2,0,1,10,0,80,0,1,10,0,188,10,0,19,138,148,161,26,73,0,176,1,0,1,
+	10,0,252,13,0,19,74,168,72,168,72,0,112,0,47,36,28,150,164,168,219,194,255,219,
+	171,202,38,0,86,0,43,76,204,169,204,246,212,185,154,189,216,108,0,144,1,0,84,0,
+	188,9,0,1,10,0,176,3,0,19,244,27,172,130,33,0,240,2,0,1,10,0,188,4,
+	0,5,27,11,0,156,3,0,3,187,0,156,5,0,1,1,0,28,0,1,1,0,220,1,
+	0,13,234,187,209,10,0,156,2,0,9,42,38,10,0,188,10,0,7,138,244,0,72,0,
+	5,154,4,0,176,1,0,1,10,0,252,13,0,84,0,11,72,168,72,0,144,1,0,99,
+	42,255,249,202,22,186,177,109,97,105,217,111,218,97,143,201,136,140,200,216,180,214,29,159,
+	68,0,112,0,1,10,0,252,9,0,1,10,0,208,3,0,17,196,169,186,98,4,0,240,
+	2,0,1,10,0,188,4,0,5,235,10,0,252,8,0,3,203,0,27,1,3,188,0,220,
+	1,0,13,27,187,209,10,0,156,2,0,9,42,207,2,0,188,10,0,17,138,100,77,136,
+	12,0,208,1,0,1,10,0,188,14,0,11,74,168,72,0,144,1,0,103,138,68,40,177,
+	177,26,44,171,66,177,44,162,108,191,65,76,33,100,255,200,246,205,164,79,132,72,0,80,
+	0,1,10,0,252,9,0,1,10,0,208,3,0,17,196,25,175,38,4,0,240,2,0,1,
+	10,0,156,4,0,5,27,11,0,188,3,0,3,170,0,156,5,0,3,203,0,26,0,3,
+	188,0,220,1,0,11,27,238,173,0,188,2,0,9,138,100,2,0,188,10,0,21,138,36,
+	129,177,76,4,0,144,1,0,1,10,0,188,14,0,84,0,3,72,0,144,1,0,99,138,
+	132,138,100,45,223,218,75,223,161,137,185,136,17,175,28,205,45,153,150,141,156,34,250,164,
+	0,80,0,7,132,168,0,252,9,0,1,10,0,176,3,0,19,194,253,193,20,33,0,240,
+	2,0,1,10,0,156,4,0,5,27,11,0,156,9,0,1,1,0,29,2,1,1,0,188,
+	1,0,13,234,187,209,10,0,188,2,0,1,10,0,80,0,1,10,0,188,10,0,21,138,
+	168,65,29,111,4,0,144,1,0,1,10,0,252,14,0,3,74,0,144,1,0,103,138,132,
+	138,66,22,204,107,216,188,173,251,109,185,45,108,74,65,173,159,249,214,162,137,186,70,168,
+	0,80,0,5,132,10,0,252,9,0,1,10,0,176,3,0,19,194,253,141,22,33,0,240,
+	2,0,1,10,0,156,4,0,5,235,10,0,188,3,0,3,187,0,156,5,0,1,1,0,
+	26,0,1,1,0,188,1,0,13,27,187,209,10,0,188,2,0,9,42,38,10,0,188,10,
+	0,21,138,168,44,137,108,4,0,144,1,0,1,10,0,252,14,0,212,1,0,7,72,168,
+	0,80,0,91,214,205,31,20,191,108,148,200,34,75,214,97,212,220,189,43,134,166,156,250,
+	34,132,168,0,80,0,3,164,0,252,9,0,1,10,0,176,3,0,19,244,33,168,250,44,
+	0,240,2,0,1,10,0,252,3,0,5,27,11,0,188,9,0,3,203,0,25,1,3,188,
+	0,188,1,0,11,27,238,173,0,220,2,0,9,42,207,2,0,188,10,0,21,138,72,223,
+	136,44,4,0,144,1,0,1,10,0,188,16,0,101,74,168,40,130,155,191,161,77,193,104,
+	241,137,212,17,143,72,104,178,210,33,130,246,130,156,136,4,0,80,0,148,1,0,252,9,
+	0,1,10,0,176,3,0,19,244,250,47,210,47,0,240,2,0,1,10,0,252,3,0,5,
+	27,11,0,220,3,0,3,170,0,156,5,0,3,203,0,22,0,3,188,0,156,1,0,13,
+	234,187,209,10,0,220,2,0,9,138,100,2,0,188,10,0,19,138,72,25,27,79,0,176,
+	1,0,1,10,0,188,16,0,84,0,103,40,207,145,210,164,253,136,134,29,194,129,26,209,
+	161,146,168,154,129,108,168,193,196,73,138,132,168,0,252,10,0,1,10,0,176,3,0,19,
+	244,168,42,202,38,0,240,2,0,1,10,0,252,3,0,5,235,10,0,188,9,0,1,1,
+	0,25,2,1,1,0,156,1,0,13,27,187,209,10,0,220,2,0,1,10,0,80,0,1,
+	10,0,188,10,0,19,138,148,161,26,73,0,176,1,0,1,10,0,252,16,0,105,42,25,
+	248,212,175,141,157,132,70,28,31,38,198,132,24,253,221,47,188,204,150,137,107,132,138,132,
+	10,0,252,10,0,1,10,0,176,3,0,19,244,27,172,130,33,0,240,2,0,1,10,0,
+	220,3,0,5,27,11,0,252,3,0,3,187,0,156,5,0,1,1,0,25,0,1,1,0,
+	156,1,0,11,27,238,173,0,252,2,0,9,42,38,10,0,188,10,0,7,138,244,0,72,
+	0,5,154,4,0,144,1,0,1,10,0,156,17,0,35,42,223,146,68,79,186,189,33,244,
+	0,90,0,63,104,187,209,194,216,41,249,184,20,29,196,186,66,136,138,164,0,252,10,0,
+	1,10,0,208,3,0,17,196,169,186,98,4,0,240,2,0,1,10,0,220,3,0,5,27,
+	11,0,220,9,0,3,203,0,25,1,3,188,0,124,0,13,234,187,209,10,0,252,2,0,
+	9,42,207,2,0,188,10,0,17,138,100,77,136,12,0,176,1,0,1,10,0,156,17,0,
+	91,42,75,24,22,242,102,36,196,191,209,65,244,24,186,148,220,218,68,193,221,68,204,70,
+	0,112,0,84,0,252,10,0,1,10,0,208,3,0,17,196,25,175,38,4,0,240,2,0,
+	1,10,0,220,3,0,5,235,10,0,252,3,0,3,170,0,156,5,0,3,203,0,25,0,
+	3,188,0,124,0,13,27,187,209,10,0,252,2,0,9,138,100,2,0,188,10,0,21,138,
+	36,129,177,76,4,0,112,0,1,10,0,156,17,0,27,42,145,73,169,74,76,207,0,94,
+	0,55,153,155,249,108,186,170,168,42,191,40,155,223,252,73,0,144,1,0,148,1,0,188,
+	10,0,1,10,0,176,3,0,19,194,253,193,20,33,0,240,2,0,1,10,0,188,3,0,
+	5,27,11,0,252,9,0,1,1,0,29,2,1,1,0,124,0,11,27,238,173,0,156,3,
+	0,1,10,0,80,0,1,10,0,188,10,0,21,138,168,65,29,111,4,0,112,0,1,10,
+	0,156,17,0,89,74,111,79,137,137,152,129,172,156,184,75,20,214,251,139,17,38,152,219,
+	172,24,102,4,0,112,0,1,10,0,80,0,3,164,0,188,10,0,1,10,0,176,3,0,
+	19,194,253,141,22,33,0,240,2,0,1,10,0,188,3,0,5,27,11,0,156,4,0,3,
+	187,0,156,5,0,1,1,0,25,0,1,1,0,92,0,13,234,187,209,10,0,156,3,0,
+	9,42,38,10,0,188,10,0,21,138,168,44,137,108,4,0,112,0,1,10,0,156,17,0,
+	89,170,204,100,26,136,68,189,185,157,137,108,221,162,202,47,150,161,74,252,130,186,38,4,
+	0,80,0,1,10,0,80,0,5,132,10,0,188,10,0,1,10,0,176,3,0,19,244,33,
+	168,250,44,0,240,2,0,1,10,0,188,3,0,5,235,10,0,252,9,0,3,203,0,27,
+	1,3,188,0,92,0,13,27,187,209,10,0,156,3,0,9,42,207,2,0,188,10,0,21,
+	138,72,223,136,44,4,0,112,0,1,10,0,156,17,0,87,170,156,104,156,148,177,159,198,
+	184,251,157,20,178,210,107,200,242,22,212,33,106,66,0,80,0,1,10,0,80,0,7,132,
+	168,0,188,10,0,1,10,0,176,3,0,19,244,250,47,210,47,0,240,2,0,1,10,0,
+	156,3,0,5,27,11,0,188,4,0,3,170,0,156,5,0,3,203,0,27,0,3,188,0,
+	92,0,11,27,238,173,0,188,3,0,9,138,100,2,0,188,10,0,19,138,72,25,27,79,
+	0,144,1,0,1,10,0,156,17,0,53,74,201,205,140,201,108,172,22,209,220,253,47,202,
+	1,0,76,0,25,177,249,24,134,244,97,4,0,80,0,1,10,0,80,0,9,132,68,10,
+	0,188,10,0,1,10,0,176,3,0,19,244,168,42,202,38,0,240,2,0,1,10,0,156,
+	3,0,5,27,11,0,156,10,0,1,1,0,27,2,19,225,174,190,27,173,0,188,3,0,
+	1,10,0,80,0,1,10,0,188,10,0,19,138,148,161,26,73,0,144,1,0,1,10,0,
+	156,17,0,83,138,36,182,139,34,73,201,104,169,196,212,209,137,168,148,218,129,203,150,154,
+	97,0,104,0,1,2,0,72,0,9,72,98,2,0,188,10,0,1,10,0,176,3,0,19,
+	244,27,172,130,33,0,240,2,0,1,10,0,156,3,0,5,235,10,0,188,4,0,3,187,
+	0,156,5,0,1,1,0,29,0,19,225,190,177,27,173,0,188,3,0,9,42,38,10,0,
+	188,10,0,7,138,244,0,72,0,5,154,4,0,144,1,0,1,10,0,156,17,0,33,138,
+	148,17,28,205,157,36,17,8,0,88,0,1,8,0,94,0,82,0,27,108,241,219,130,205,
+	42,221,0,94,0,21,153,207,47,148,28,2,0,188,10,0,1,10,0,208,3,0,17,196,
+	169,186,98,4,0,240,1,0,104,0,1,10,0,252,2,0,5,27,11,0,188,10,0,3,
+	203,0,27,1,19,188,238,27,238,173,0,220,3,0,9,42,207,2,0,188,10,0,17,138,
+	100,77,136,12,0,176,1,0,1,10,0,220,16,0,84,0,41,100,203,34,153,102,189,75,
+	244,193,108,4,0,90,0,59,17,45,100,148,105,136,75,209,184,17,102,27,252,157,154,0,
+	84,0,220,9,0,1,10,0,208,3,0,19,196,25,175,38,66,0,176,1,0,3,148,0,
+	94,0,1,2,0,252,2,0,5,27,11,0,220,4,0,3,170,0,156,5,0,3,203,0,
+	26,0,19,188,174,190,27,173,0,220,3,0,9,138,100,2,0,188,10,0,21,138,36,129,
+	177,76,4,0,112,0,1,10,0,220,16,0,15,74,98,184,132,0,136,1,0,21,201,193,
+	188,205,220,11,0,94,0,82,0,7,132,203,0,66,0,45,45,194,68,210,187,97,18,170,
+	66,107,68,10,0,220,9,0,1,10,0,176,3,0,23,194,253,193,20,251,73,0,112,0,
+	13,148,161,218,9,0,252,2,0,5,235,10,0,188,10,0,1,1,0,29,2,17,225,27,
+	187,209,10,0,220,3,0,1,10,0,80,0,1,10,0,188,10,0,21,138,168,65,29,111,
+	4,0,112,0,1,10,0,156,16,0,84,0,13,18,26,70,4,0,144,1,0,17,201,38,
+	36,164,10,0,72,0,68,0,63,136,164,108,219,170,214,104,134,36,136,97,65,202,79,36,
+	168,0,220,9,0,1,10,0,176,3,0,23,242,251,141,182,218,76,0,80,0,17,148,75,
+	137,70,10,0,188,2,0,5,27,11,0,252,4,0,3,187,0,156,5,0,1,1,0,21,
+	0,15,225,27,238,173,0,252,3,0,9,42,38,10,0,188,10,0,21,138,168,44,137,108,
+	4,0,112,0,1,10,0,156,16,0,17,74,100,184,132,2,0,176,1,0,23,34,68,136,
+	164,138,72,0,144,1,0,59,170,156,42,172,129,221,134,186,43,27,173,47,132,132,168,0,
+	220,9,0,1,10,0,208,3,0,45,198,132,170,65,180,130,72,185,191,177,72,10,0,188,
+	2,0,5,27,11,0,220,10,0,3,203,0,26,1,17,188,234,187,209,10,0,252,3,0,
+	9,42,207,2,0,188,10,0,21,138,72,223,136,44,4,0,112,0,1,10,0,220,15,0,
+	84,0,11,242,17,166,0,240,3,0,5,138,4,0,144,1,0,53,138,26,33,129,41,138,
+	97,250,218,20,161,145,132,4,0,80,0,1,10,0,220,9,0,1,10,0,208,3,0,45,
+	166,198,102,136,18,130,36,172,65,31,132,10,0,188,2,0,5,235,10,0,252,4,0,3,
+	170,0,156,5,0,3,203,0,23,0,17,188,27,187,209,10,0,252,3,0,9,138,100,2,
+	0,188,10,0,19,138,72,25,27,79,0,144,1,0,1,10,0,220,15,0,17,74,100,203,
+	70,8,0,244,3,0,3,72,0,144,1,0,53,138,72,193,25,248,169,18,156,75,251,150,
+	202,132,4,0,112,0,1,10,0,220,9,0,1,10,0,208,3,0,45,134,186,34,17,26,
+	130,100,157,111,250,130,10,0,156,2,0,5,27,11,0,252,10,0,1,1,0,31,2,13,
+	177,225,222,10,0,156,4,0,1,10,0,80,0,1,10,0,188,10,0,19,138,148,161,26,
+	73,0,144,1,0,1,10,0,220,15,0,5,42,15,0,66,0,7,70,168,0,188,3,0,
+	3,74,0,144,1,0,1,10,0,80,0,45,196,210,198,76,108,221,111,201,77,109,76,4,
+	0,144,1,0,1,10,0,220,9,0,1,10,0,208,3,0,45,182,145,107,137,17,134,194,
+	210,178,145,130,10,0,156,2,0,5,27,11,0,156,5,0,3,187,0,156,5,0,1,1,
+	0,28,0,1,1,0,86,0,5,209,10,0,156,4,0,9,42,38,10,0,188,10,0,7,
+	138,244,0,72,0,5,154,4,0,144,1,0,1,10,0,220,15,0,19,42,203,102,66,168,
+	0,188,3,0,212,1,0,112,0,43,148,205,242,27,170,203,107,175,253,159,106,0,176,1,
+	0,1,10,0,220,9,0,1,10,0,240,2,0,104,0,43,97,77,242,168,108,242,75,162,
+	241,130,168,0,156,2,0,5,235,10,0,252,10,0,3,203,0,29,0,13,204,177,209,10,
+	0,156,4,0,9,42,207,2,0,188,10,0,17,138,100,77,136,12,0,176,1,0,1,10,
+	0,220,15,0,9,154,102,4,0,80,0,3,164,0,252,4,0,1,10,0,144,1,0,41,
+	244,216,212,219,172,155,214,22,130,73,6,0,176,1,0,1,10,0,220,9,0,1,10,0,
+	240,2,0,43,100,207,109,204,201,42,251,191,184,177,47,0,80,0,1,10,0,252,1,0,
+	5,27,11,0,188,5,0,3,170,0,156,5,0,3,203,0,27,0,11,204,177,173,0,188,
+	4,0,9,138,100,2,0,188,10,0,21,138,36,129,177,76,4,0,112,0,1,10,0,188,
+	15,0,3,74,0,112,0,148,1,0,252,4,0,1,10,0,144,1,0,41,36,253,20,157,
+	220,146,207,24,136,169,6,0,176,1,0,1,10,0,220,9,0,1,10,0,240,2,0,41,
+	244,75,201,27,34,33,29,161,205,252,2,0,112,0,1,10,0,252,1,0,5,27,11,0,
+	156,11,0,1,1,0,36,1,1,12,0,86,0,5,177,10,0,188,4,0,1,10,0,80,
+	0,1,10,0,188,10,0,21,138,168,65,29,111,4,0,112,0,1,10,0,156,15,0,5,
+	74,10,0,156,7,0,1,10,0,112,0,11,132,210,109,0,82,0,25,109,241,198,200,72,
+	218,6,0,176,1,0,148,1,0,220,8,0,1,10,0,240,2,0,23,148,31,184,100,202,
+	248,0,84,0,3,205,0,68,0,144,1,0,1,10,0,252,1,0,5,235,10,0,188,5,
+	0,3,187,0,156,5,0,1,1,0,29,0,15,188,168,27,171,0,156,4,0,9,42,38,
+	10,0,188,10,0,21,138,168,44,137,108,4,0,112,0,1,10,0,252,14,0,5,74,10,
+	0,188,7,0,1,10,0,80,0,5,132,8,0,100,0,31,168,244,74,41,244,252,65,97,
+	0,144,1,0,1,10,0,80,0,3,164,0,220,8,0,1,10,0,144,3,0,33,36,161,
+	252,220,76,145,166,108,4,0,208,1,0,1,10,0,220,1,0,5,27,11,0,188,11,0,
+	3,203,0,29,2,15,161,164,27,171,0,252,3,0,9,42,207,2,0,188,10,0,21,138,
+	72,223,136,44,4,0,112,0,1,10,0,220,14,0,5,74,10,0,220,7,0,7,138,72,
+	0,208,1,0,31,138,244,74,255,25,148,65,109,0,112,0,1,10,0,80,0,5,132,10,
+	0,220,8,0,1,10,0,176,3,0,31,212,33,180,72,42,244,45,68,0,208,1,0,1,
+	10,0,220,1,0,5,27,11,0,220,5,0,3,170,0,156,5,0,3,203,0,27,0,17,
+	225,74,186,177,10,0,220,3,0,9,138,100,2,0,188,10,0,19,138,72,25,27,79,0,
+	144,1,0,1,10,0,188,14,0,5,74,10,0,252,7,0,5,138,4,0,208,1,0,33,
+	138,72,188,217,102,136,186,111,15,0,80,0,1,10,0,80,0,7,132,168,0,220,8,0,
+	1,10,0,176,3,0,27,178,171,249,251,217,157,75,0,144,2,0,1,10,0,220,1,0,
+	5,235,10,0,188,11,0,1,1,0,33,1,21,188,238,74,186,177,10,0,188,3,0,1,
+	10,0,80,0,1,10,0,188,10,0,19,138,148,161,26,73,0,144,1,0,1,10,0,156,
+	14,0,5,74,10,0,156,8,0,3,74,0,208,1,0,1,10,0,80,0,33,98,47,216,
+	102,132,102,196,136,10,0,80,0,1,4,0,80,0,1,10,0,220,8,0,1,10,0,208,
+	2,0,35,68,242,20,223,143,38,74,182,66,0,240,1,0,1,10,0,188,1,0,5,27,
+	11,0,252,5,0,3,187,0,156,5,0,1,1,0,35,0,3,188,0,92,0,13,74,186,
+	177,10,0,156,3,0,7,42,38,0,84,0,3,238,0,116,0,188,8,0,7,138,244,0,
+	72,0,5,154,4,0,144,1,0,1,10,0,252,13,0,5,74,10,0,188,8,0,148,2,
+	0,80,0,72,0,27,76,250,188,17,108,193,162,0,80,0,1,4,0,112,0,1,10,0,
+	220,8,0,1,10,0,208,2,0,35,100,188,26,146,193,77,72,137,70,0,240,1,0,1,
+	10,0,188,1,0,5,27,11,0,220,11,0,3,203,0,28,2,1,1,0,124,0,13,74,
+	186,177,10,0,252,2,0,25,42,207,38,146,41,66,10,0,188,8,0,17,138,100,77,136,
+	12,0,176,1,0,1,10,0,220,13,0,5,74,10,0,220,10,0,41,138,72,168,202,252,
+	189,156,41,148,27,6,0,72,0,144,1,0,1,10,0,220,8,0,1,10,0,208,2,0,
+	35,244,189,26,130,26,137,42,41,33,0,240,1,0,1,10,0,188,1,0,5,235,10,0,
+	252,5,0,3,170,0,156,5,0,3,203,0,25,0,1,1,0,156,1,0,13,74,186,177,
+	10,0,220,2,0,25,72,194,111,209,205,73,10,0,188,8,0,21,138,36,33,189,44,2,
+	0,112,0,1,10,0,188,13,0,5,74,10,0,252,10,0,47,138,132,138,184,203,73,203,
+	137,72,214,108,38,0,144,1,0,1,10,0,220,8,0,1,10,0,208,2,0,35,244,17,
+	24,249,178,171,134,210,38,0,240,1,0,1,10,0,156,1,0,5,27,11,0,252,11,0,
+	1,1,0,35,1,3,188,0,188,1,0,13,74,186,177,10,0,188,1,0,84,0,13,100,
+	17,47,15,0,72,0,9,157,164,14,0,244,1,0,156,6,0,21,138,132,155,212,207,9,
+	0,112,0,1,10,0,156,13,0,5,74,10,0,156,11,0,29,74,168,136,143,137,65,169,
+	9,0,80,0,3,148,0,86,0,1,6,0,144,1,0,1,10,0,220,8,0,1,10,0,
+	208,2,0,31,100,28,106,185,104,24,161,106,0,176,2,0,1,10,0,156,1,0,5,27,
+	11,0,156,6,0,3,187,0,156,5,0,1,1,0,31,0,3,188,0,220,1,0,13,74,
+	186,177,10,0,156,1,0,35,74,196,186,203,246,202,65,189,17,0,158,1,0,5,73,10,
+	0,156,6,0,21,74,98,152,97,17,9,0,112,0,1,10,0,252,12,0,5,74,10,0,
+	188,11,0,84,0,80,0,17,28,184,251,217,2,0,80,0,15,42,161,107,68,0,80,0,
+	1,10,0,220,8,0,1,10,0,208,2,0,31,100,28,68,221,74,76,45,155,0,176,2,
+	0,1,10,0,156,1,0,5,235,10,0,252,11,0,3,203,0,30,2,1,1,0,252,1,
+	0,11,74,186,177,0,84,0,53,238,138,223,141,216,246,154,219,204,193,255,153,242,4,0,
+	84,0,220,5,0,21,74,182,74,108,251,2,0,112,0,1,10,0,220,12,0,5,74,10,
+	0,156,12,0,17,138,72,194,104,2,0,66,0,23,130,168,72,98,193,70,0,80,0,1,
+	10,0,220,8,0,1,10,0,208,2,0,31,100,191,152,40,170,209,42,155,0,176,2,0,
+	1,10,0,124,0,5,27,11,0,188,6,0,3,170,0,156,5,0,3,203,0,23,0,1,
+	1,0,156,2,0,75,74,186,171,164,238,138,79,250,171,74,33,244,20,27,40,184,242,153,
+	164,0,220,5,0,21,74,207,79,212,145,2,0,112,0,1,10,0,188,12,0,5,74,10,
+	0,188,12,0,47,138,132,18,77,250,41,130,138,132,74,191,70,0,80,0,1,10,0,220,
+	8,0,1,10,0,208,2,0,33,36,198,45,98,27,79,74,253,2,0,144,2,0,1,10,
+	0,124,0,5,27,11,0,156,12,0,3,203,0,25,1,3,188,0,188,2,0,13,74,34,
+	221,9,0,68,0,53,28,105,188,134,249,36,189,210,220,251,143,218,70,10,0,220,5,0,
+	21,170,175,242,169,252,2,0,112,0,1,10,0,156,12,0,5,74,10,0,220,12,0,55,
+	74,136,34,198,252,73,170,72,168,72,34,41,132,168,0,220,8,0,1,10,0,240,2,0,
+	33,100,188,42,214,210,130,184,108,2,0,240,1,0,1,10,0,124,0,5,235,10,0,188,
+	6,0,3,187,0,156,5,0,3,203,0,24,0,3,188,0,220,2,0,71,210,45,194,161,
+	146,148,33,29,166,29,253,34,137,33,191,189,106,164,0,156,6,0,15,105,202,29,202,0,
+	72,0,5,136,10,0,252,11,0,5,74,10,0,252,12,0,212,1,0,23,72,34,164,74,
+	168,72,0,112,0,9,41,132,10,0,220,8,0,1,10,0,240,2,0,33,194,27,36,72,
+	42,193,178,207,9,0,240,1,0,1,10,0,92,0,5,27,11,0,188,12,0,1,1,0,
+	27,2,1,1,0,156,1,0,84,0,75,136,148,75,36,38,138,214,28,223,186,38,209,143,
+	196,175,166,27,72,70,0,84,0,220,5,0,27,137,255,139,105,105,132,168,0,220,11,0,
+	5,74,10,0,220,14,0,3,74,0,208,1,0,5,138,4,0,176,1,0,7,41,164,0,
+	220,8,0,1,10,0,208,2,0,35,242,27,43,178,255,157,145,28,145,0,240,1,0,1,
+	10,0,92,0,5,27,11,0,220,6,0,3,170,0,156,5,0,1,1,0,26,0,1,1,
+	0,156,1,0,51,74,148,31,204,45,152,219,205,24,171,153,168,47,0,94,0,29,194,173,
+	168,253,74,150,73,10,0,156,5,0,31,170,178,22,188,194,108,132,168,0,188,11,0,5,
+	74,10,0,252,14,0,148,2,0,3,72,0,240,1,0,5,41,8,0,220,8,0,1,10,
+	0,208,2,0,1,9,0,66,0,27,152,207,98,216,251,186,47,0,240,1,0,1,10,0,
+	92,0,5,235,10,0,188,12,0,3,203,0,23,1,3,188,0,156,1,0,15,138,242,171,
+	164,0,88,0,65,169,143,252,108,26,166,250,145,130,184,209,24,223,153,68,44,10,0,156,
+	5,0,31,74,178,209,26,148,75,132,168,0,156,11,0,5,74,10,0,156,17,0,3,74,
+	0,176,2,0,3,137,0,220,8,0,1,10,0,208,2,0,33,201,28,196,201,107,36,220,
+	188,9,0,144,2,0,11,234,190,177,0,252,6,0,3,187,0,156,5,0,3,203,0,20,
+	0,3,188,0,156,1,0,13,138,178,138,4,0,66,0,67,168,134,214,22,173,24,221,154,
+	216,171,198,221,186,205,79,182,169,0,156,5,0,31,74,175,70,252,24,77,132,168,0,252,
+	10,0,5,74,10,0,188,17,0,148,3,0,3,164,0,188,8,0,1,10,0,208,2,0,
+	33,201,28,97,76,152,132,220,188,9,0,144,2,0,11,234,190,177,0,220,12,0,1,1,
+	0,20,2,1,1,0,156,1,0,85,138,169,159,108,72,178,246,73,79,162,218,79,154,146,
+	172,41,79,241,212,201,182,9,0,212,1,0,220,3,0,31,74,156,250,97,25,107,132,168,
+	0,220,10,0,5,74,10,0,252,20,0,5,74,10,0,156,8,0,1,10,0,208,2,0,
+	33,201,28,157,146,196,108,184,201,2,0,144,2,0,11,234,190,174,0,252,6,0,3,170,
+	0,156,5,0,1,1,0,24,0,1,1,0,156,1,0,89,138,217,161,108,22,246,36,205,
+	76,137,180,140,140,196,72,178,241,252,223,31,191,73,2,0,114,0,1,8,0,220,3,0,
+	23,42,187,161,242,102,244,0,72,0,1,10,0,188,10,0,5,74,10,0,188,21,0,5,
+	74,10,0,252,7,0,1,10,0,208,2,0,5,98,15,0,90,0,23,148,75,105,214,20,
+	102,0,68,0,104,0,11,168,190,177,0,252,12,0,3,203,0,19,1,3,188,0,156,1,
+	0,103,138,242,146,17,74,20,152,251,150,109,172,38,26,98,141,252,20,251,24,171,185,105,
+	28,189,79,168,0,156,3,0,31,42,107,194,250,102,100,105,164,0,156,10,0,5,74,10,
+	0,252,21,0,5,74,10,0,220,7,0,1,10,0,208,2,0,29,146,210,173,44,79,255,
+	25,10,0,90,0,25,187,145,105,132,234,27,11,0,156,7,0,3,187,0,156,5,0,3,
+	203,0,23,0,3,188,0,156,1,0,13,138,68,107,2,0,94,0,21,152,246,177,111,244,
+	8,0,68,0,55,102,24,161,198,166,68,169,168,172,202,155,132,241,44,0,156,3,0,5,
+	42,6,0,116,0,15,105,108,249,145,0,156,10,0,5,74,10,0,188,22,0,5,74,10,
+	0,188,7,0,1,10,0,208,2,0,11,242,22,164,0,90,0,43,108,178,178,218,45,166,
+	193,132,168,190,174,0,252,12,0,1,1,0,19,2,1,1,0,156,1,0,103,74,72,246,
+	201,219,198,17,196,186,104,138,203,74,106,146,170,25,156,189,182,150,191,170,201,175,155,0,
+	156,3,0,29,42,166,204,31,244,150,188,9,0,252,9,0,5,74,10,0,252,22,0,5,
+	74,10,0,156,7,0,1,10,0,208,2,0,45,242,219,68,29,191,242,251,138,221,136,218,
+	15,0,80,0,7,186,177,0,188,7,0,3,170,0,156,5,0,1,1,0,18,0,1,1,
+	0,156,1,0,84,0,97,136,66,139,77,203,175,202,155,218,22,111,201,250,34,28,217,253,
+	154,248,166,221,26,18,184,9,0,156,3,0,31,42,191,40,180,18,253,26,164,0,188,9,
+	0,5,74,10,0,188,23,0,5,74,10,0,252,6,0,1,10,0,208,2,0,11,146,155,
+	139,0,94,0,41,157,221,162,169,36,168,203,130,168,27,11,0,156,13,0,3,203,0,21,
+	1,3,188,0,252,1,0,97,68,169,212,193,175,157,36,209,130,98,137,186,156,22,26,139,
+	24,252,185,74,146,111,75,218,9,0,156,3,0,31,154,187,244,111,207,210,29,130,0,156,
+	9,0,5,74,10,0,252,23,0,5,74,10,0,220,6,0,1,10,0,240,2,0,5,194,
+	12,0,86,0,33,136,218,198,150,157,255,139,193,2,0,80,0,5,237,10,0,188,7,0,
+	3,187,0,156,5,0,3,203,0,16,0,3,188,0,252,1,0,97,180,42,210,145,70,41,
+	189,248,43,43,150,105,136,109,188,253,187,218,77,156,168,45,130,203,2,0,84,0,220,2,
+	0,29,38,42,77,184,253,202,108,8,0,252,8,0,5,74,10,0,188,24,0,5,74,10,
+	0,188,6,0,1,10,0,240,2,0,55,100,36,68,134,152,75,150,72,111,47,150,130,132,
+	187,0,188,13,0,1,1,0,17,2,1,1,0,252,1,0,103,180,223,143,161,153,210,129,
+	244,182,109,111,214,156,34,191,217,255,42,182,156,145,253,170,253,66,164,0,220,2,0,29,
+	162,102,202,214,171,242,73,10,0,220,8,0,5,74,10,0,252,24,0,5,74,10,0,156,
+	6,0,1,10,0,208,2,0,57,100,171,198,169,65,134,72,146,31,153,20,137,72,26,11,
+	0,220,7,0,3,170,0,156,5,0,1,1,0,17,0,1,1,0,252,1,0,49,180,25,
+	130,170,191,31,166,17,223,130,204,154,10,0,76,0,47,36,42,170,134,140,40,175,47,221,
+	212,156,168,0,220,2,0,25,180,185,134,129,36,102,8,0,252,8,0,5,74,10,0,188,
+	25,0,5,74,10,0,252,5,0,1,10,0,176,2,0,59,100,209,180,219,109,209,40,250,
+	242,27,70,157,136,130,174,0,188,13,0,3,203,0,19,1,3,188,0,252,1,0,29,162,
+	100,26,33,153,186,168,6,0,94,0,67,45,43,132,220,40,154,180,40,250,221,194,145,155,
+	218,152,154,168,0,220,2,0,25,180,130,141,166,153,66,10,0,220,8,0,5,74,10,0,
+	252,25,0,5,74,10,0,220,5,0,1,10,0,176,2,0,57,20,187,201,157,41,156,129,
+	77,141,40,129,47,72,130,13,0,252,7,0,3,187,0,156,5,0,3,203,0,15,0,3,
+	188,0,252,1,0,103,130,66,43,216,250,170,185,22,77,28,137,139,29,169,77,249,161,97,
+	33,182,216,253,36,33,33,168,0,220,2,0,25,18,246,141,31,152,66,10,0,188,8,0,
+	5,74,10,0,188,26,0,5,74,10,0,188,5,0,1,10,0,176,2,0,57,242,40,166,
+	162,77,73,169,28,148,136,18,130,72,218,10,0,220,13,0,1,1,0,17,2,1,1,0,
+	252,1,0,103,212,207,104,216,100,38,17,171,98,40,166,47,253,132,66,171,138,76,20,210,
+	253,186,244,171,70,168,0,220,2,0,25,214,146,186,198,171,106,8,0,156,8,0,5,74,
+	10,0,252,26,0,5,74,10,0,156,5,0,1,10,0,176,2,0,59,198,253,200,146,201,
+	171,134,79,220,17,205,130,40,232,168,0,220,7,0,3,170,0,156,5,0,1,1,0,20,
+	0,1,1,0,252,1,0,29,212,47,186,36,185,31,242,6,0,72,0,27,194,145,138,182,
+	148,191,143,0,94,0,31,241,26,170,177,201,143,109,132,0,84,0,156,2,0,25,166,205,
+	203,169,97,70,8,0,188,6,0,17,74,132,40,66,10,0,188,27,0,5,74,10,0,252,
+	4,0,1,10,0,176,2,0,59,22,156,22,191,246,220,178,189,76,255,242,130,36,132,168,
+	0,188,13,0,3,203,0,15,1,3,188,0,252,1,0,107,212,137,205,146,75,104,100,191,
+	129,162,201,34,156,106,98,249,219,177,150,108,203,43,252,132,79,138,164,0,156,2,0,25,
+	242,73,156,72,220,132,10,0,188,6,0,15,248,252,191,42,0,252,27,0,5,74,10,0,
+	220,4,0,7,138,34,0,208,1,0,59,201,156,168,34,182,193,18,155,106,132,43,72,162,
+	104,162,0,188,13,0,3,203,0,17,0,3,188,0,252,1,0,51,180,20,248,65,255,150,
+	139,191,178,42,241,104,166,0,80,0,39,217,172,22,44,77,250,156,141,244,249,0,72,0,
+	3,168,0,156,2,0,25,74,132,203,189,196,73,10,0,188,6,0,19,248,209,138,244,170,
+	0,220,27,0,5,74,10,0,220,4,0,79,249,41,68,136,146,198,44,241,40,182,17,27,
+	105,25,216,76,72,70,194,162,0,188,13,0,1,1,0,17,2,1,1,0,252,1,0,107,
+	180,104,157,155,193,193,207,255,28,68,109,223,242,200,168,168,107,209,157,45,252,209,253,155,
+	252,47,168,0,156,2,0,25,42,159,143,214,166,175,10,0,156,3,0,180,2,0,92,0,
+	19,152,65,18,252,164,0,252,27,0,5,74,10,0,188,4,0,79,18,193,38,132,194,193,
+	172,191,98,175,102,45,28,29,210,205,34,249,97,164,0,220,7,0,3,187,0,156,5,0,
+	1,1,0,15,0,1,1,0,252,1,0,107,180,40,173,169,255,97,169,193,252,107,250,251,
+	29,184,79,255,189,152,164,97,202,155,207,209,214,44,168,0,156,2,0,21,106,202,249,18,
+	241,6,0,220,3,0,3,74,0,176,1,0,29,68,41,72,175,66,143,66,10,0,156,28,
+	0,5,74,10,0,156,4,0,79,200,184,111,132,244,221,43,204,191,221,31,216,184,218,108,
+	164,193,182,100,170,0,188,13,0,3,203,0,20,1,3,188,0,252,1,0,27,180,152,154,
+	169,72,36,79,0,114,0,71,77,33,107,223,244,129,27,223,153,34,189,184,214,27,20,140,
+	33,168,0,188,2,0,19,79,202,44,17,249,0,148,3,0,9,238,138,4,0,112,0,25,
+	148,207,193,223,18,252,4,0,84,0,188,28,0,5,74,10,0,252,3,0,75,152,188,203,
+	66,146,106,156,36,172,210,187,17,249,218,65,166,218,207,154,0,156,8,0,3,170,0,156,
+	5,0,3,203,0,15,0,3,188,0,252,1,0,107,20,244,68,34,212,177,47,100,98,41,
+	178,173,109,210,74,107,173,180,70,40,41,143,159,191,137,156,168,0,188,2,0,21,41,40,
+	153,45,253,4,0,176,2,0,15,164,238,138,72,0,80,0,27,244,219,161,40,148,40,164,
+	0,156,29,0,5,74,10,0,220,3,0,77,74,194,216,108,242,210,194,141,187,175,193,248,
+	242,146,193,27,70,177,79,10,0,220,13,0,1,1,0,21,2,1,1,0,252,1,0,107,
+	20,65,98,218,242,44,169,105,216,100,107,22,173,70,169,182,139,249,188,191,221,70,209,249,
+	164,156,168,0,188,2,0,21,153,38,28,166,241,4,0,144,2,0,3,132,0,116,0,80,
+	0,27,36,153,220,168,154,24,73,0,84,0,188,29,0,5,74,10,0,188,3,0,33,138,
+	148,220,218,45,79,223,186,9,0,94,0,37,251,29,177,79,175,251,148,201,172,10,0,252,
+	7,0,3,187,0,156,5,0,1,1,0,20,0,1,1,0,252,1,0,104,0,63,178,223,
+	26,27,193,217,72,191,38,107,28,255,249,189,22,153,0,66,0,29,31,251,29,203,175,212,
+	130,10,0,188,2,0,21,166,202,152,29,108,4,0,240,1,0,5,132,10,0,112,0,11,
+	138,72,31,0,88,0,17,157,180,97,73,10,0,156,30,0,5,74,10,0,156,3,0,77,
+	138,72,242,185,27,106,168,109,65,70,253,155,216,106,157,28,138,248,134,10,0,220,13,0,
+	3,203,0,20,1,3,188,0,156,3,0,97,185,162,141,27,156,45,210,168,79,26,248,246,
+	216,244,44,66,24,22,194,143,241,145,182,132,10,0,156,2,0,23,250,204,18,146,41,68,
+	0,208,1,0,5,132,10,0,176,1,0,33,74,242,218,17,196,200,255,73,10,0,188,30,
+	0,9,74,234,14,0,212,2,0,80,0,31,148,66,36,130,79,196,207,137,0,76,0,31,
+	40,161,198,100,145,130,104,162,0,252,7,0,3,170,0,156,5,0,3,203,0,20,0,3,
+	188,0,156,3,0,95,42,146,68,66,108,201,73,132,221,68,203,146,200,153,29,185,178,72,
+	29,31,108,18,185,132,0,212,1,0,92,0,15,18,173,175,40,0,176,2,0,5,132,10,
+	0,208,1,0,23,34,246,40,74,173,217,0,76,0,3,164,0,220,30,0,11,74,234,74,
+	0,144,2,0,1,10,0,80,0,67,20,79,168,241,180,159,164,109,137,34,253,172,252,241,
+	200,42,168,0,220,13,0,1,1,0,22,2,1,1,0,188,3,0,84,0,89,190,238,34,
+	198,47,73,72,201,72,156,251,249,209,182,202,72,168,66,191,24,200,130,4,0,112,0,3,
+	164,0,92,0,17,169,218,159,108,2,0,240,1,0,13,132,138,146,9,0,100,0,33,201,
+	193,36,196,106,188,156,66,10,0,252,30,0,11,74,170,72,0,144,2,0,1,10,0,80,
+	0,65,18,201,248,244,68,154,162,73,97,246,132,214,105,177,31,136,10,0,252,7,0,3,
+	187,0,156,5,0,1,1,0,11,0,1,1,0,252,3,0,91,27,235,46,168,143,44,219,
+	145,164,185,74,203,205,136,201,75,202,105,242,43,173,150,70,0,80,0,101,132,170,136,180,
+	77,107,189,134,146,41,136,132,138,98,28,159,28,207,173,244,155,70,188,156,132,10,0,156,
+	31,0,11,152,168,72,0,144,2,0,71,138,72,24,79,253,170,108,97,255,24,130,246,17,
+	31,184,209,38,168,0,220,13,0,3,203,0,16,1,3,188,0,252,3,0,31,27,235,158,
+	155,134,107,252,72,0,82,0,51,150,140,104,136,166,22,216,29,196,43,214,180,203,0,68,
+	0,103,132,168,18,97,241,105,218,98,242,17,47,132,138,152,252,219,177,148,187,242,20,104,
+	47,250,73,168,0,156,26,0,244,4,0,13,40,137,138,4,0,144,2,0,69,138,138,140,
+	145,138,146,17,137,73,152,27,250,73,246,107,38,136,10,0,252,7,0,3,170,0,156,5,
+	0,3,203,0,17,0,3,188,0,220,3,0,5,234,11,0,92,0,85,250,152,220,162,36,
+	129,173,251,138,77,180,207,38,77,41,173,139,31,198,79,251,9,0,72,0,41,42,77,18,
+	107,141,106,246,189,219,79,10,0,80,0,49,201,172,17,18,104,152,24,100,150,250,159,132,
+	10,0,156,26,0,3,74,0,240,4,0,11,146,168,72,0,144,2,0,67,170,248,205,155,
+	68,189,107,251,188,246,148,42,138,159,145,130,168,0,220,13,0,1,1,0,18,2,1,1,
+	0,220,3,0,5,27,11,0,92,0,163,1,154,152,252,77,100,141,104,74,166,246,249,107,
+	70,24,162,252,107,221,198,184,140,246,70,36,77,175,25,159,100,75,153,38,44,153,102,207,
+	145,72,104,17,180,0,76,0,19,146,214,68,66,168,0,220,22,0,212,3,0,3,72,0,
+	240,4,0,11,146,168,72,0,176,2,0,63,20,182,40,41,169,182,159,22,159,175,109,170,
+	76,253,130,168,0,252,7,0,3,187,0,156,5,0,1,1,0,19,0,1,1,0,220,3,
+	0,5,27,11,0,92,0,49,42,246,154,132,129,154,111,41,196,161,105,104,11,0,66,0,
+	37,34,241,77,134,252,38,241,146,24,1,0,80,0,89,217,36,187,109,207,77,104,252,161,
+	105,73,175,148,248,172,200,150,159,38,130,168,72,10,0,220,22,0,3,74,0,144,3,0,
+	5,138,4,0,240,4,0,11,34,201,73,0,144,2,0,63,180,145,203,76,74,136,74,25,
+	203,157,198,72,44,251,130,168,0,220,13,0,3,203,0,21,0,1,1,0,188,3,0,5,
+	234,11,0,156,1,0,105,74,223,73,166,44,172,172,210,24,104,77,201,159,187,218,251,253,
+	214,137,156,178,76,244,109,150,172,8,0,72,0,61,161,220,156,44,132,108,220,140,65,43,
+	106,210,217,220,65,12,0,72,0,1,8,0,84,0,156,22,0,84,0,3,72,0,144,3,
+	0,5,138,4,0,176,4,0,95,146,155,250,66,146,41,68,136,180,27,200,150,146,178,161,
+	216,169,250,162,100,248,251,130,168,0,252,7,0,3,170,0,156,5,0,3,203,0,13,0,
+	1,1,0,188,3,0,5,27,11,0,156,1,0,183,1,42,220,216,191,41,177,182,219,244,
+	201,150,36,180,138,242,130,201,33,154,170,17,153,139,18,145,104,45,223,173,218,132,173,136,
+	209,136,18,111,205,255,18,152,41,107,184,38,164,0,220,22,0,11,74,168,72,0,144,3,
+	0,5,138,4,0,144,4,0,95,25,77,47,153,188,184,97,132,212,17,43,65,36,248,186,
+	177,157,191,242,100,168,193,132,168,0,220,13,0,1,1,0,16,1,3,188,0,188,3,0,
+	5,27,11,0,156,1,0,183,1,138,40,153,172,219,111,98,68,129,36,248,105,242,178,178,
+	74,26,210,44,134,164,129,17,111,180,185,182,25,36,130,249,173,155,184,146,175,150,170,130,
+	24,161,196,184,65,111,164,0,156,22,0,84,0,11,72,168,72,0,144,3,0,5,138,4,
+	0,240,3,0,95,217,41,161,130,42,111,200,73,20,150,74,218,73,98,194,109,70,28,134,
+	250,217,153,132,168,0,252,7,0,3,187,0,156,5,0,1,1,0,15,0,3,188,0,156,
+	3,0,5,234,11,0,252,1,0,17,187,174,40,188,13,0,80,0,155,1,155,141,137,189,
+	153,177,218,145,170,166,201,25,214,66,201,42,47,18,186,193,175,161,132,17,246,132,187,166,
+	209,25,27,185,38,169,221,41,45,108,164,0,156,22,0,19,74,168,72,168,72,0,144,3,
+	0,5,138,4,0,208,3,0,95,38,173,214,98,209,28,196,47,18,143,108,24,251,65,162,
+	249,185,139,204,198,171,248,132,168,0,220,13,0,3,203,0,20,2,1,1,0,156,3,0,
+	5,27,11,0,156,3,0,97,244,252,177,29,194,155,178,168,201,207,191,249,171,143,220,33,
+	100,31,184,159,28,132,216,38,11,0,76,0,21,255,43,249,36,139,4,0,86,0,37,202,
+	185,255,214,137,105,178,202,70,10,0,220,21,0,84,0,19,72,168,72,168,72,0,144,3,
+	0,5,138,4,0,176,3,0,95,134,182,66,170,204,218,196,28,198,40,207,244,193,205,219,
+	146,191,152,241,241,169,134,33,168,0,252,7,0,3,170,0,156,5,0,3,203,0,19,0,
+	1,1,0,156,3,0,5,27,11,0,252,1,0,3,170,0,92,0,133,1,138,72,242,216,
+	191,182,210,255,134,217,164,134,220,148,185,111,248,154,43,102,251,196,104,104,105,178,217,27,
+	75,27,77,79,255,12,0,98,0,27,220,223,28,252,200,108,164,0,220,21,0,27,74,168,
+	72,168,72,168,72,0,144,3,0,5,138,4,0,144,3,0,15,194,42,178,102,0,94,0,
+	73,136,220,148,154,185,29,177,20,45,223,173,221,162,75,153,24,70,47,10,0,220,13,0,
+	1,1,0,17,1,3,188,0,252,2,0,5,234,11,0,252,3,0,165,1,170,200,223,217,
+	168,44,164,33,255,72,154,26,148,244,212,180,29,141,143,138,168,140,45,188,143,182,47,33,
+	106,136,218,198,187,137,249,169,47,203,137,204,70,10,0,156,21,0,84,0,27,72,168,72,
+	168,72,168,72,0,144,3,0,5,138,4,0,240,2,0,95,194,188,107,205,28,47,168,191,
+	106,159,241,41,45,164,178,159,221,186,171,28,76,203,25,156,0,84,0,156,7,0,3,187,
+	0,156,5,0,1,1,0,15,0,3,188,0,252,2,0,5,27,11,0,156,2,0,3,187,
+	0,156,1,0,165,1,74,18,217,205,214,187,134,185,253,109,187,146,42,145,73,244,146,214,
+	28,205,34,212,152,218,129,104,70,105,132,28,154,107,146,134,20,201,193,198,249,193,70,10,
+	0,156,21,0,35,74,168,72,168,72,168,72,168,72,0,144,3,0,5,138,4,0,176,2,
+	0,103,242,221,26,100,209,186,182,100,198,74,42,139,219,166,104,168,200,202,200,143,111,203,
+	66,130,79,164,0,252,12,0,3,203,0,18,2,1,1,0,252,2,0,5,27,11,0,252,
+	3,0,165,1,74,246,141,202,207,134,24,36,109,137,109,73,97,134,137,97,157,172,250,246,
+	98,137,246,75,43,170,164,177,97,79,25,205,17,218,73,155,41,76,182,218,166,10,0,220,
+	15,0,212,5,0,35,72,168,72,168,72,168,72,168,72,0,144,3,0,5,138,4,0,240,
+	1,0,67,242,141,68,246,106,242,191,129,152,205,40,242,98,70,223,28,214,0,76,0,31,
+	196,24,145,184,68,107,47,168,0,156,7,0,3,170,0,156,5,0,3,203,0,21,0,1,
+	1,0,220,2,0,5,234,11,0,188,2,0,3,170,0,156,1,0,3,74,0,68,0,95,
+	36,38,154,200,164,187,200,210,145,246,77,154,253,203,42,40,189,107,168,145,198,44,130,172,
+	0,68,0,53,38,214,45,241,193,134,207,74,209,255,105,218,166,10,0,220,15,0,3,74,
+	0,144,5,0,37,138,132,138,132,138,132,138,132,138,4,0,144,3,0,5,138,4,0,176,
+	1,0,107,242,171,27,75,189,191,255,180,136,203,241,218,40,105,44,107,70,180,65,143,152,
+	253,218,193,137,76,168,0,252,12,0,1,1,0,22,1,3,188,0,220,2,0,5,27,11,
+	0,156,4,0,3,74,0,112,0,72,0,147,1,42,152,154,73,170,17,159,24,202,198,107,
+	143,146,170,145,241,29,204,248,24,172,17,41,242,223,76,196,138,129,248,65,143,216,28,189,
+	44,164,0,220,5,0,244,2,0,252,6,0,5,138,4,0,144,5,0,37,138,132,138,132,
+	138,132,138,132,138,4,0,144,3,0,47,74,66,36,153,166,180,97,33,191,194,106,220,0,
+	72,0,69,38,217,18,150,175,139,221,242,168,249,191,252,162,173,214,156,132,10,0,156,7,
+	0,3,187,0,156,5,0,1,1,0,24,0,3,188,0,220,2,0,5,27,11,0,188,2,
+	0,3,187,0,156,1,0,180,2,0,81,196,28,244,25,100,246,24,25,148,209,155,77,129,
+	162,26,76,153,203,178,196,8,0,68,0,43,40,154,134,140,132,166,29,24,210,29,218,0,
+	88,0,7,79,168,0,220,5,0,3,74,0,240,1,0,3,164,0,252,6,0,7,138,72,
+	0,144,5,0,37,138,132,138,132,138,132,138,132,138,4,0,240,2,0,123,34,198,31,26,
+	44,18,141,148,209,79,141,47,146,169,191,73,27,255,148,20,170,187,250,205,194,185,221,252,
+	104,132,168,0,252,12,0,3,203,0,30,2,1,1,0,188,2,0,5,234,11,0,252,6,
+	0,9,148,207,13,0,84,0,117,18,29,191,138,44,24,171,157,161,136,159,204,219,140,98,
+	203,139,79,97,185,159,204,18,132,187,189,180,207,253,8,0,68,0,5,132,10,0,220,5,
+	0,3,74,0,68,0,3,136,0,68,0,3,164,0,252,4,0,148,2,0,80,0,1,4,
+	0,176,1,0,168,1,0,3,136,0,164,1,0,39,168,72,168,72,168,72,168,72,168,72,
+	0,176,2,0,125,98,193,141,249,170,134,161,31,188,203,212,220,164,76,33,76,156,201,200,
+	201,20,162,36,140,159,180,157,218,150,79,136,10,0,156,7,0,3,170,0,156,5,0,3,
+	203,0,22,0,1,1,0,188,2,0,5,27,11,0,220,2,0,3,170,0,220,3,0,143,
+	1,42,198,193,102,171,34,65,27,97,136,33,27,244,189,20,191,171,196,148,97,216,76,150,
+	168,109,108,249,134,184,141,25,201,33,111,164,138,0,244,5,0,23,105,246,41,146,111,164,
+	0,252,4,0,3,74,0,208,1,0,7,138,72,0,68,0,72,0,1,9,0,126,0,59,
+	73,146,111,246,41,168,72,168,72,66,36,66,36,168,72,0,240,1,0,127,98,219,40,111,
+	22,132,24,200,105,251,246,178,28,155,17,79,77,153,70,44,28,25,130,153,187,194,70,166,
+	253,134,70,168,0,252,12,0,1,1,0,24,1,3,188,0,188,2,0,5,27,11,0,252,
+	6,0,11,138,242,73,0,68,0,119,207,223,148,44,100,100,198,198,40,191,136,18,139,132,
+	172,66,205,253,33,65,108,98,66,47,219,130,148,185,242,33,0,84,0,208,5,0,23,194,
+	251,102,249,193,70,0,180,5,0,3,72,0,208,1,0,67,74,98,27,159,191,219,17,205,
+	198,220,180,111,34,68,34,68,249,0,108,0,11,159,102,68,0,228,1,0,97,201,177,26,
+	42,216,109,210,162,155,155,139,24,246,172,194,171,218,18,44,248,17,143,132,216,4,0,82,
+	0,23,109,241,152,162,65,168,0,156,7,0,3,187,0,156,5,0,1,1,0,23,0,3,
+	188,0,156,2,0,5,234,11,0,252,2,0,3,187,0,220,3,0,3,138,0,72,0,112,
+	0,103,66,194,45,218,204,109,169,251,180,20,210,188,196,202,187,214,76,210,152,70,25,175,
+	155,104,66,43,0,88,0,9,134,31,4,0,176,6,0,19,194,171,138,168,178,0,136,1,
+	0,240,3,0,15,164,138,72,34,0,168,1,0,85,246,138,209,137,100,34,184,140,246,162,
+	29,209,107,246,41,185,26,193,161,221,155,9,0,222,1,0,127,198,171,185,210,100,207,66,
+	168,242,155,105,18,209,209,214,188,28,188,33,184,154,132,140,250,191,137,108,18,28,252,38,
+	168,0,252,12,0,3,203,0,30,2,1,1,0,156,2,0,5,27,11,0,156,7,0,3,
+	74,0,208,1,0,117,138,244,171,156,136,28,40,162,216,68,161,25,150,141,28,210,72,148,
+	152,22,246,173,175,209,109,20,40,148,173,12,0,72,0,176,1,0,100,0,176,3,0,31,
+	194,171,33,22,164,255,204,73,0,176,1,0,11,164,74,34,0,72,0,15,168,138,72,207,
+	0,126,0,45,153,188,36,180,145,177,40,214,184,201,36,2,0,72,0,33,136,251,31,154,
+	193,20,129,72,8,0,246,1,0,51,209,138,140,17,98,40,171,175,106,20,153,248,170,0,
+	72,0,61,249,75,31,188,33,137,193,137,172,68,218,77,79,26,44,8,0,104,0,1,10,
+	0,156,7,0,3,170,0,156,5,0,3,203,0,26,0,1,1,0,156,2,0,5,27,11,
+	0,252,2,0,3,170,0,220,3,0,148,2,0,13,136,244,139,8,0,84,0,103,159,68,
+	155,184,177,140,106,34,184,246,241,40,27,66,252,107,164,97,145,75,210,166,162,47,105,70,
+	0,144,1,0,9,146,255,9,0,68,0,3,68,0,100,0,112,0,33,98,252,134,74,251,
+	108,168,250,4,0,164,1,0,31,164,74,249,252,130,132,138,244,0,84,0,93,164,104,180,
+	148,223,97,25,242,210,143,129,75,250,28,20,40,148,198,77,161,72,100,38,6,0,114,0,
+	123,38,42,66,104,252,106,249,31,79,100,20,102,217,153,66,161,218,18,162,43,141,246,43,
+	214,161,189,168,26,73,26,130,0,148,1,0,252,12,0,1,1,0,23,1,3,188,0,252,
+	1,0,5,234,11,0,188,9,0,111,74,36,188,22,104,204,24,132,201,141,104,18,74,97,
+	152,20,34,177,143,209,25,34,25,42,148,212,203,79,0,86,0,9,191,145,9,0,100,0,
+	9,191,27,1,0,88,0,3,207,0,94,0,1,9,0,100,0,31,249,252,246,180,141,106,
+	130,168,0,94,0,3,153,0,94,0,135,2,153,191,168,216,29,207,175,182,255,27,168,137,
+	148,111,27,29,41,223,171,47,111,75,191,102,186,108,41,31,29,155,72,154,194,157,79,161,
+	22,223,164,168,66,196,41,177,253,162,29,24,241,20,154,255,132,196,205,242,249,104,177,159,
+	200,70,218,217,252,162,0,156,8,0,3,187,0,156,5,0,1,1,0,11,0,3,188,0,
+	252,1,0,5,27,11,0,156,3,0,3,187,0,220,5,0,15,74,198,219,162,0,80,0,
+	205,3,156,77,185,146,106,153,74,212,42,252,207,24,98,42,107,209,251,20,134,44,168,102,
+	129,134,139,212,173,97,31,221,219,204,189,17,204,193,252,31,138,26,186,74,166,159,38,74,
+	29,252,219,17,140,223,200,187,216,98,26,172,173,139,202,140,132,27,22,145,166,34,108,166,
+	205,184,182,191,244,42,185,177,24,20,242,212,34,164,175,140,205,198,180,209,104,43,166,182,
+	193,214,68,34,76,173,200,193,34,166,145,107,184,203,220,253,212,219,140,205,47,10,0,252,
+	13,0,3,203,0,11,2,1,1,0,252,1,0,5,27,11,0,188,9,0,117,74,223,187,
+	173,145,184,138,161,20,28,196,252,38,248,17,130,129,156,196,244,136,111,65,134,223,217,111,
+	214,214,13,0,94,0,231,2,102,79,75,34,70,152,111,202,173,202,109,189,244,252,223,73,
+	108,97,175,204,253,248,205,130,216,34,45,140,134,161,97,40,146,73,177,136,29,70,246,161,
+	194,182,162,217,41,150,75,154,210,216,185,134,154,148,105,105,41,136,255,156,20,205,214,143,
+	182,150,143,141,242,25,72,177,191,175,196,159,242,73,25,175,77,73,134,27,171,173,111,28,
+	252,162,0,156,8,0,3,170,0,156,5,0,3,203,0,11,0,1,1,0,220,1,0,5,
+	234,11,0,188,3,0,3,170,0,220,5,0,5,74,15,0,98,0,213,3,106,223,79,218,
+	138,161,201,184,198,253,248,70,162,203,132,27,38,41,138,253,45,173,219,42,188,42,244,242,
+	155,77,201,189,170,100,75,141,27,29,136,109,68,40,180,77,40,77,223,161,182,27,100,182,
+	212,44,29,111,136,251,220,100,134,186,154,251,75,171,212,76,70,204,216,246,187,175,216,43,
+	20,223,154,40,189,173,172,28,97,194,212,18,156,246,97,216,148,31,180,68,145,42,154,97,
+	166,194,36,191,217,169,36,153,74,130,44,36,157,107,246,198,47,10,0,252,13,0,1,1,
+	0,17,1,3,188,0,220,1,0,5,27,11,0,220,9,0,5,74,15,0,98,0,161,1,
+	148,220,182,156,104,244,182,44,36,223,210,207,201,132,196,43,25,79,198,251,171,249,129,75,
+	207,106,177,255,205,153,194,189,26,33,253,198,250,47,248,100,2,0,82,0,1,15,0,84,
+	0,109,185,76,200,209,191,70,162,76,74,36,17,107,47,155,77,216,161,73,216,196,201,156,
+	76,191,219,136,241,6,0,80,0,177,1,27,75,202,184,177,198,139,168,20,102,184,27,97,
+	161,194,25,150,145,216,42,210,141,172,219,141,27,223,166,210,154,76,203,42,223,241,137,73,
+	20,201,168,74,204,97,38,10,0,156,8,0,3,187,0,156,5,0,1,1,0,13,0,3,
+	188,0,220,1,0,5,27,11,0,188,3,0,3,187,0,220,5,0,135,1,74,223,29,173,
+	141,175,223,189,171,207,202,218,47,97,72,18,108,200,70,241,161,162,104,186,189,207,159,22,
+	242,109,130,216,108,161,0,90,0,179,1,18,164,73,218,196,180,66,159,75,157,168,221,102,
+	209,70,156,220,164,159,136,178,72,22,246,41,169,25,171,145,26,73,154,26,77,191,157,111,
+	138,244,214,20,29,34,251,186,0,88,0,155,1,241,251,28,253,152,104,191,27,168,198,203,
+	244,153,40,182,20,18,166,134,155,162,188,207,74,175,210,28,155,29,45,185,244,187,25,43,
+	20,102,130,168,0,252,13,0,3,203,0,13,2,1,1,0,188,1,0,5,234,11,0,252,
+	9,0,133,1,74,198,252,111,79,27,148,187,77,130,170,220,17,107,173,25,249,196,249,200,
+	241,138,187,168,146,77,34,26,102,18,68,185,41,6,0,90,0,177,2,136,250,44,164,168,
+	157,169,136,170,246,191,173,203,252,209,102,79,109,172,250,29,109,38,220,47,152,178,180,191,
+	241,196,219,161,138,77,154,75,45,200,251,168,145,188,153,193,70,102,178,193,34,141,104,204,
+	221,70,102,137,76,196,132,150,203,136,157,33,36,18,177,223,189,111,220,166,201,104,184,1,
+	0,76,0,27,73,217,196,216,251,132,168,0,220,8,0,3,170,0,156,5,0,3,203,0,
+	13,0,1,1,0,188,1,0,5,27,11,0,220,3,0,3,170,0,220,5,0,169,1,74,
+	66,36,130,41,100,140,66,104,198,180,201,178,193,182,45,28,187,40,45,175,44,26,198,98,
+	220,251,105,182,186,193,17,204,207,153,107,198,188,38,189,188,177,11,0,80,0,35,134,202,
+	105,106,140,76,255,253,22,0,88,0,133,2,134,130,138,223,241,43,152,31,182,73,104,191,
+	17,29,41,134,156,20,66,79,45,76,219,153,219,241,42,38,187,72,241,172,196,26,65,175,
+	220,65,100,157,129,146,171,186,25,146,171,185,207,40,38,152,250,189,251,187,22,154,43,105,
+	150,242,17,76,136,10,0,188,14,0,1,1,0,15,1,3,188,0,188,1,0,5,27,11,
+	0,252,9,0,5,74,8,0,84,0,101,148,193,201,77,129,223,75,202,138,203,218,136,203,
+	143,137,34,36,24,77,28,223,143,249,26,219,10,0,72,0,163,1,184,244,130,198,248,250,
+	216,72,202,202,47,246,169,162,173,108,20,42,156,201,194,253,162,246,214,207,250,169,242,251,
+	152,97,26,155,221,168,29,217,100,173,244,0,112,0,187,1,162,139,24,138,24,221,244,209,
+	129,31,203,242,66,28,146,111,29,47,253,105,25,201,66,74,169,246,108,136,177,139,193,29,
+	186,249,173,34,212,28,154,154,111,138,134,223,205,132,168,0,220,8,0,3,187,0,156,5,
+	0,1,1,0,10,0,3,188,0,156,1,0,5,234,11,0,252,3,0,3,187,0,220,5,
+	0,84,0,217,3,72,164,105,152,252,171,132,219,230,102,194,210,148,27,109,65,198,166,154,
+	22,191,175,246,223,205,252,28,97,182,139,218,189,218,172,184,145,140,27,106,194,177,145,26,
+	129,74,42,100,244,173,246,141,29,141,173,143,28,98,146,70,42,250,178,70,212,70,100,156,
+	29,204,251,136,194,136,98,212,152,241,143,172,196,153,65,171,65,185,246,217,241,104,75,203,
+	141,193,175,246,97,26,31,200,203,182,29,218,150,100,154,194,106,40,111,141,178,204,219,111,
+	170,44,132,10,0,188,14,0,3,203,0,16,2,1,1,0,156,1,0,5,27,11,0,220,
+	10,0,57,154,209,42,106,182,162,148,202,187,141,252,22,200,98,15,0,82,0,31,159,70,
+	31,220,73,182,246,252,0,120,0,94,0,27,252,249,204,255,252,102,255,0,82,0,203,2,
+	100,193,191,164,111,172,22,156,132,98,212,216,150,41,146,188,255,253,102,75,77,132,200,162,
+	111,204,218,72,138,65,200,200,170,29,221,140,76,140,34,155,185,196,17,172,252,146,111,145,
+	47,249,25,162,184,251,154,17,248,200,24,45,154,191,253,180,154,70,28,29,141,209,255,44,
+	47,140,169,143,204,178,223,185,27,70,168,0,220,8,0,3,170,0,156,5,0,3,203,0,
+	27,0,1,1,0,156,1,0,5,27,11,0,252,3,0,3,170,0,156,6,0,97,106,72,
+	108,178,98,168,110,173,41,107,155,172,129,169,40,185,43,193,188,170,29,191,40,169,9,0,
+	126,0,5,38,4,0,68,0,9,68,66,8,0,104,0,1,10,0,92,0,1,10,0,112,
+	0,3,105,0,68,0,13,191,157,198,8,0,104,0,7,234,40,0,144,1,0,19,42,153,
+	75,242,24,0,84,0,245,1,72,207,217,156,214,76,214,102,207,40,180,111,107,139,252,184,
+	212,106,182,146,191,201,29,18,145,104,157,152,219,137,17,252,43,132,152,159,97,193,200,136,
+	25,246,188,108,109,18,76,104,137,40,209,129,249,188,244,107,137,185,102,109,132,10,0,188,
+	14,0,1,1,0,21,1,3,188,0,124,0,5,234,11,0,156,11,0,93,143,105,22,203,
+	226,249,171,188,248,221,111,250,36,100,45,22,216,209,205,154,188,107,77,10,0,146,1,0,
+	7,38,168,0,144,1,0,3,132,0,148,1,0,252,1,0,21,74,130,40,31,173,9,0,
+	220,1,0,212,1,0,233,1,72,36,198,111,150,159,175,41,36,173,182,173,204,130,75,38,
+	219,146,249,18,188,241,223,180,106,217,145,219,185,75,134,212,45,145,150,193,100,210,187,152,
+	252,22,204,38,249,138,79,152,171,200,18,200,185,200,42,22,138,70,11,0,80,0,31,155,
+	77,97,253,44,22,70,168,0,220,8,0,3,187,0,156,5,0,1,1,0,24,0,3,188,
+	0,124,0,5,27,11,0,156,4,0,3,187,0,188,6,0,97,150,220,180,24,203,242,24,
+	44,68,162,214,177,28,184,255,189,173,248,129,138,216,255,180,159,2,0,168,1,0,3,168,
+	0,144,1,0,3,164,0,252,2,0,3,74,0,112,0,11,146,41,164,0,252,2,0,11,
+	74,136,68,0,144,1,0,17,74,198,155,73,9,0,68,0,72,0,221,1,186,155,68,193,
+	171,138,41,193,107,180,138,244,220,168,191,205,106,164,109,178,141,20,161,20,153,36,168,65,
+	79,40,200,20,140,154,205,218,249,220,203,159,41,148,141,97,70,43,33,152,246,244,177,104,
+	169,102,132,10,0,188,14,0,3,203,0,17,2,1,1,0,124,0,5,27,11,0,156,11,
+	0,99,134,129,138,73,250,68,102,221,104,33,105,24,241,38,129,242,168,249,244,24,25,138,
+	244,246,162,0,144,1,0,3,132,0,212,1,0,252,2,0,244,2,0,252,2,0,212,2,
+	0,251,1,72,150,76,173,73,221,162,44,77,20,77,186,17,139,155,43,166,105,74,102,139,
+	129,104,104,29,186,204,17,201,68,42,210,141,44,193,65,255,105,108,139,97,109,143,251,251,
+	25,153,159,207,18,29,173,79,33,221,134,34,33,218,251,111,66,168,0,220,8,0,3,170,
+	0,156,5,0,3,203,0,17,0,1,1,0,92,0,5,234,11,0,188,4,0,3,170,0,
+	188,6,0,101,194,137,129,41,31,44,158,79,169,182,221,104,164,41,166,140,201,132,184,218,
+	100,173,159,111,130,10,0,144,1,0,3,164,0,252,12,0,3,138,0,72,0,61,102,153,
+	177,255,219,157,204,111,43,175,136,34,205,205,22,12,0,84,0,175,1,150,159,42,102,47,
+	161,207,29,47,253,218,33,97,100,79,65,249,65,161,154,20,188,189,152,40,104,200,150,28,
+	253,173,189,251,18,70,173,26,170,73,111,100,66,132,168,0,188,14,0,1,1,0,21,1,
+	3,188,0,92,0,5,27,11,0,188,11,0,101,106,111,130,104,194,189,203,186,168,68,17,
+	40,153,77,79,65,77,76,251,201,109,244,108,111,130,8,0,212,1,0,252,12,0,1,10,
+	0,80,0,1,4,0,112,0,72,0,45,98,173,36,188,246,130,203,28,145,98,75,11,0,
+	94,0,169,1,252,209,171,248,41,22,145,185,169,148,24,153,129,66,202,134,154,73,143,172,
+	189,111,252,202,218,204,249,44,201,34,38,36,28,47,156,155,34,41,252,70,79,36,4,0,
+	80,0,1,10,0,220,8,0,3,187,0,156,5,0,1,1,0,15,0,3,188,0,92,0,
+	5,27,11,0,188,4,0,3,187,0,188,6,0,103,138,70,155,200,175,178,223,175,186,253,
+	43,28,136,106,77,143,219,41,187,44,242,47,109,105,130,168,0,188,14,0,7,138,72,0,
+	240,1,0,17,100,28,221,139,8,0,66,0,205,1,108,246,73,36,246,108,66,168,72,166,
+	200,180,201,148,152,214,186,41,221,146,255,38,97,188,251,145,193,109,73,72,246,31,177,132,
+	218,74,31,111,136,218,214,249,137,43,171,242,210,79,138,66,136,10,0,188,14,0,3,203,
+	0,23,2,11,225,174,190,0,252,11,0,91,152,26,150,109,193,26,204,207,25,146,145,218,
+	173,189,100,97,26,148,130,156,102,24,150,0,68,0,3,168,0,188,14,0,5,138,4,0,
+	144,2,0,3,100,0,82,0,15,175,202,102,41,0,104,0,3,136,0,104,0,71,66,136,
+	170,104,140,205,214,104,44,223,210,79,20,33,200,220,205,73,0,68,0,53,201,77,154,66,
+	72,170,132,100,207,249,155,98,31,1,0,88,0,45,201,111,65,29,203,184,252,70,168,40,
+	132,10,0,220,8,0,3,170,0,156,5,0,3,203,0,27,0,11,225,190,177,0,220,4,
+	0,3,170,0,220,6,0,101,74,155,212,26,157,27,241,203,152,172,31,100,161,24,140,219,
+	168,74,184,17,185,200,47,111,68,10,0,188,14,0,3,74,0,176,2,0,72,0,5,170,
+	4,0,76,0,5,159,2,0,240,2,0,59,132,168,138,242,173,28,150,143,132,154,205,134,
+	255,202,34,0,108,0,1,4,0,80,0,17,66,196,189,159,4,0,144,1,0,72,0,19,
+	72,34,42,233,104,0,94,0,25,204,31,43,25,75,203,6,0,72,0,15,136,138,162,174,
+	0,156,14,0,1,1,0,25,1,13,188,238,27,11,0,156,12,0,79,169,17,27,200,242,
+	44,248,107,250,241,152,204,218,198,171,205,242,178,217,200,0,68,0,13,44,203,168,10,0,
+	188,14,0,148,4,0,1,4,0,132,1,0,176,3,0,53,132,170,40,191,25,145,25,209,
+	134,172,212,244,249,9,0,200,1,0,112,0,15,132,242,188,79,0,208,1,0,19,138,216,
+	146,72,138,0,100,0,25,164,138,152,97,194,177,12,0,176,1,0,84,0,5,235,10,0,
+	156,8,0,3,187,0,156,5,0,1,1,0,27,0,11,188,174,190,0,252,4,0,3,187,
+	0,220,6,0,81,100,110,146,109,248,203,107,172,246,189,175,180,209,223,185,150,168,65,36,
+	66,15,0,68,0,9,200,252,8,0,252,18,0,3,74,0,240,4,0,45,164,138,146,249,
+	209,136,74,173,156,175,65,6,0,72,0,240,2,0,11,132,72,41,0,244,1,0,13,136,
+	187,102,10,0,208,1,0,3,164,0,92,0,1,10,0,68,0,9,255,252,4,0,180,1,
+	0,92,0,5,235,10,0,220,13,0,3,203,0,25,2,9,225,27,11,0,156,12,0,97,
+	20,136,194,248,18,25,223,252,45,143,138,219,130,207,162,171,20,29,248,168,217,36,242,66,
+	10,0,252,18,0,148,6,0,1,8,0,104,0,29,249,68,102,255,177,177,202,4,0,240,
+	3,0,5,132,10,0,156,2,0,15,138,187,138,132,0,148,2,0,156,1,0,1,10,0,
+	72,0,7,34,164,0,156,1,0,1,10,0,92,0,5,235,10,0,220,7,0,3,170,0,
+	156,5,0,3,203,0,27,0,9,225,27,11,0,252,4,0,3,170,0,220,6,0,1,4,
+	0,66,0,89,139,111,223,175,153,40,136,20,252,204,187,76,130,104,218,148,187,217,28,72,
+	248,168,10,0,252,24,0,3,74,0,112,0,7,68,136,0,104,0,11,34,68,34,0,176,
+	4,0,3,164,0,156,2,0,5,186,13,0,112,0,3,164,0,156,3,0,244,1,0,188,
+	1,0,1,10,0,92,0,5,235,10,0,156,13,0,1,1,0,17,1,9,188,234,11,0,
+	188,12,0,104,0,89,146,107,38,152,202,106,246,66,157,18,216,191,68,161,159,244,180,196,
+	31,136,250,66,10,0,252,24,0,244,9,0,156,2,0,7,17,138,0,148,1,0,252,6,
+	0,1,10,0,92,0,5,235,10,0,156,7,0,3,187,0,156,5,0,1,1,0,15,0,
+	9,188,27,11,0,156,5,0,3,187,0,188,7,0,45,234,200,166,137,193,100,193,75,248,
+	191,221,8,0,82,0,39,43,170,105,24,210,38,139,198,150,164,0,252,36,0,5,193,11,
+	0,252,8,0,1,10,0,92,0,5,235,10,0,220,12,0,3,203,0,13,2,7,177,177,
+	0,252,12,0,93,234,78,251,205,156,250,193,75,33,138,134,218,188,220,223,251,45,184,148,
+	73,100,241,73,10,0,220,36,0,5,193,11,0,188,9,0,1,10,0,92,0,5,235,10,
+	0,220,6,0,3,170,0,156,5,0,3,203,0,15,0,5,177,11,0,188,5,0,3,170,
+	0,252,6,0,1,10,0,92,0,87,180,250,188,137,185,209,218,105,28,136,111,98,169,22,
+	25,41,28,198,75,169,159,164,0,188,36,0,5,193,11,0,252,9,0,1,10,0,92,0,
+	5,235,10,0,156,12,0,1,1,0,15,0,5,204,1,0,220,12,0,1,10,0,124,0,
+	87,18,164,68,129,248,219,45,182,20,43,44,220,214,171,255,97,217,198,210,216,150,164,0,
+	156,36,0,5,193,11,0,188,10,0,1,10,0,92,0,5,235,10,0,156,6,0,3,187,
+	0,156,5,0,1,1,0,17,4,1,1,0,188,5,0,3,187,0,188,6,0,1,10,0,
+	156,1,0,25,18,172,252,102,152,66,15,0,100,0,53,187,209,42,241,43,40,220,203,79,
+	171,189,156,66,10,0,252,35,0,5,193,11,0,252,10,0,1,10,0,92,0,5,235,10,
+	0,220,11,0,3,203,0,16,5,7,28,177,0,156,12,0,1,10,0,188,1,0,81,42,
+	220,42,186,33,223,22,170,214,193,24,33,28,141,189,29,18,217,220,33,4,0,84,0,220,
+	35,0,5,193,11,0,188,11,0,1,10,0,92,0,5,235,10,0,220,5,0,3,170,0,
+	156,5,0,3,203,0,15,0,9,188,234,11,0,156,5,0,3,170,0,252,5,0,1,10,
+	0,156,2,0,75,242,207,152,17,204,72,136,210,209,130,218,216,73,216,249,218,248,105,134,
+	0,188,36,0,5,193,11,0,252,11,0,1,10,0,92,0,5,235,10,0,156,11,0,1,
+	1,0,15,2,9,225,234,11,0,156,11,0,1,10,0,188,2,0,75,74,148,164,43,153,
+	156,75,27,249,205,196,198,180,193,161,187,146,41,170,0,156,36,0,5,193,11,0,188,12,
+	0,1,10,0,92,0,5,235,10,0,156,5,0,3,187,0,156,5,0,1,1,0,15,0,
+	11,225,174,190,0,220,4,0,3,187,0,188,5,0,1,10,0,220,2,0,71,138,152,170,
+	152,185,29,26,43,76,203,218,139,198,217,148,170,164,145,0,188,36,0,5,193,11,0,252,
+	12,0,1,10,0,92,0,5,235,10,0,220,10,0,1,1,0,19,1,3,188,0,92,0,
+	5,234,11,0,156,10,0,1,10,0,252,2,0,15,138,40,221,220,0,84,0,51,77,252,
+	34,24,159,201,177,74,246,20,209,205,162,0,252,35,0,5,193,11,0,188,13,0,1,10,
+	0,92,0,5,235,10,0,220,4,0,3,170,0,156,5,0,1,1,0,19,0,3,188,0,
+	124,0,5,234,11,0,156,4,0,3,170,0,252,4,0,1,10,0,156,3,0,49,138,40,
+	65,42,194,188,75,47,136,253,66,242,13,0,116,0,15,173,212,150,162,0,220,35,0,5,
+	193,11,0,252,13,0,1,10,0,92,0,5,235,10,0,156,10,0,1,1,0,19,2,1,
+	1,0,156,1,0,5,234,11,0,156,9,0,1,10,0,188,3,0,49,138,68,246,73,18,
+	27,157,248,28,156,132,40,12,0,90,0,17,193,77,145,130,10,0,188,35,0,5,193,11,
+	0,188,14,0,1,10,0,92,0,5,235,10,0,156,4,0,3,187,0,156,5,0,1,1,
+	0,21,0,1,1,0,188,1,0,5,234,11,0,220,3,0,3,187,0,188,4,0,1,10,
+	0,220,3,0,39,74,136,244,98,186,29,74,29,111,66,0,112,0,3,148,0,94,0,15,
+	102,255,130,168,0,156,35,0,5,193,11,0,252,14,0,1,10,0,92,0,5,235,10,0,
+	220,9,0,3,203,0,21,1,3,188,0,220,1,0,5,234,11,0,156,8,0,1,10,0,
+	252,3,0,148,1,0,27,214,29,27,28,173,108,66,0,176,1,0,136,2,0,5,136,10,
+	0,252,34,0,5,193,11,0,188,15,0,1,10,0,92,0,5,235,10,0,220,3,0,3,
+	170,0,156,5,0,3,203,0,21,0,3,188,0,252,1,0,5,234,11,0,156,3,0,3,
+	170,0,252,3,0,1,10,0,156,5,0,3,74,0,82,0,17,252,34,102,66,4,0,240,
+	3,0,5,132,10,0,220,34,0,5,193,11,0,252,15,0,1,10,0,92,0,5,235,10,
+	0,156,9,0,3,203,0,20,2,1,1,0,156,2,0,5,234,11,0,156,7,0,1,10,
+	0,188,5,0,13,170,174,36,2,0,240,5,0,3,164,0,188,34,0,5,193,11,0,188,
+	16,0,1,10,0,92,0,5,235,10,0,156,1,0,232,1,0,7,136,68,0,220,4,0,
+	3,203,0,21,0,1,1,0,188,2,0,5,234,11,0,220,2,0,3,187,0,188,3,0,
+	1,10,0,188,6,0,180,7,0,156,34,0,5,193,11,0,252,16,0,1,10,0,92,0,
+	5,235,10,0,124,0,1,4,0,162,2,0,1,4,0,220,4,0,1,1,0,18,1,3,
+	188,0,220,2,0,5,234,11,0,156,6,0,1,10,0,156,48,0,5,193,11,0,188,17,
+	0,1,10,0,92,0,5,235,10,0,92,0,7,20,170,0,112,0,5,68,1,0,136,2,
+	0,220,2,0,1,1,0,20,0,3,188,0,252,2,0,5,234,11,0,156,2,0,3,170,
+	0,252,2,0,1,10,0,156,48,0,5,193,11,0,252,17,0,1,10,0,92,0,19,235,
+	234,78,161,138,0,108,0,3,226,0,118,0,98,0,1,4,0,220,2,0,3,203,0,13,
+	2,1,1,0,156,3,0,5,234,11,0,156,5,0,1,10,0,156,48,0,5,193,11,0,
+	188,18,0,37,234,68,72,66,20,170,40,68,232,4,0,80,0,11,138,170,65,0,220,2,
+	0,3,203,0,18,0,1,1,0,188,3,0,5,234,11,0,220,1,0,3,187,0,188,2,
+	0,1,10,0,156,48,0,5,193,11,0,252,18,0,3,74,0,66,0,15,187,161,34,68,
+	0,112,0,68,0,13,234,72,26,4,0,220,2,0,1,1,0,13,1,3,188,0,220,3,
+	0,5,234,11,0,156,4,0,1,10,0,156,48,0,5,193,11,0,188,19,0,21,18,138,
+	102,74,130,14,0,80,0,23,129,134,162,102,136,65,0,220,2,0,1,1,0,15,0,3,
+	188,0,252,3,0,5,234,11,0,156,1,0,3,170,0,252,1,0,1,10,0,156,48,0,
+	5,193,11,0,220,19,0,11,180,170,66,0,162,1,0,27,46,187,226,46,97,136,65,0,
+	220,2,0,3,203,0,13,2,1,1,0,156,4,0,5,234,11,0,156,3,0,1,10,0,
+	156,48,0,5,193,11,0,252,19,0,9,20,26,6,0,68,0,35,43,200,44,18,68,166,
+	168,164,65,0,220,2,0,3,203,0,13,0,1,1,0,188,4,0,5,234,11,0,92,0,
+	3,139,0,168,1,0,1,2,0,156,48,0,5,193,11,0,156,20,0,51,36,166,38,36,
+	42,155,25,164,42,225,234,162,65,0,220,2,0,1,1,0,13,1,3,188,0,220,4,0,
+	5,234,11,0,72,0,15,22,161,26,75,0,252,47,0,5,193,11,0,220,20,0,31,42,
+	65,142,72,182,17,171,26,0,86,0,11,78,166,65,0,220,2,0,1,1,0,13,0,3,
+	188,0,252,4,0,25,42,182,17,72,226,30,4,0,220,47,0,5,193,11,0,156,21,0,
+	19,20,72,134,18,238,0,86,0,1,2,0,72,0,13,138,42,26,4,0,220,2,0,3,
+	203,0,9,2,1,1,0,252,4,0,25,18,74,17,132,70,177,4,0,188,47,0,5,193,
+	11,0,188,21,0,47,20,38,174,38,129,234,72,110,43,190,132,43,0,220,2,0,3,203,
+	0,9,0,1,1,0,252,4,0,25,226,68,24,171,207,180,4,0,156,47,0,5,193,11,
+	0,220,21,0,47,20,70,17,168,65,129,159,225,136,130,18,38,0,220,2,0,1,1,0,
+	12,1,3,188,0,188,4,0,7,68,226,0,136,1,0,11,185,250,78,0,220,45,0,116,
+	0,7,30,188,0,252,21,0,45,20,66,75,110,238,107,76,239,72,226,106,8,0,252,2,
+	0,1,1,0,11,0,3,188,0,188,4,0,29,180,110,168,182,191,142,236,4,0,252,1,
+	0,104,0,220,42,0,13,106,134,203,11,0,156,22,0,43,20,178,178,18,18,150,252,79,
+	74,166,46,0,156,3,0,3,203,0,10,2,1,1,0,188,4,0,47,180,33,228,248,110,
+	66,172,164,190,174,190,46,0,80,0,220,42,0,11,154,47,41,0,188,22,0,43,228,46,
+	20,72,107,248,140,139,226,129,75,0,156,3,0,3,203,0,11,0,1,1,0,188,4,0,
+	189,1,20,178,142,74,107,134,137,162,190,174,190,142,193,234,235,234,235,234,235,234,235,234,
+	235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,
+	235,10,0,92,0,17,235,234,235,234,11,0,92,0,189,1,234,235,234,235,234,235,234,235,
+	234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,
+	234,235,234,235,234,235,234,235,234,235,234,235,152,36,110,10,0,252,21,0,45,42,74,161,
+	38,190,68,233,255,156,25,177,4,0,156,3,0,1,1,0,11,1,3,188,0,188,4,0,
+	29,178,26,187,33,132,36,185,2,0,252,1,0,143,1,186,139,190,174,190,174,190,174,190,
+	174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,
+	174,190,174,0,92,0,17,235,234,235,234,11,0,92,0,155,3,234,235,234,235,234,235,234,
+	235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,
+	235,234,235,234,235,234,235,234,235,234,235,234,235,75,191,140,170,190,174,190,174,190,174,190,
+	174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,174,190,
+	174,190,174,190,174,190,174,190,174,190,174,190,142,134,24,20,232,107,154,72,36,251,38,33,
+	0,156,3,0,1,1,0,7,0,3,188,0,188,4,0,29,178,161,100,177,26,36,25,4,
+	0,188,45,0,237,1,193,252,201,234,234,235,234,235,234,235,234,235,234,235,234,235,234,235,
+	234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,234,235,
+	234,235,234,235,234,235,104,238,235,42,196,233,194,73,202,107,22,2,0,156,3,0,3,203,
+	0,10,2,1,1,0,188,4,0,29,228,27,24,228,132,202,24,4,0,156,45,0,13,193,
+	225,104,2,0,86,0,220,21,0,45,42,171,234,110,191,236,244,244,185,30,30,2,0,156,
+	3,0,3,203,0,10,0,1,1,0,188,4,0,29,36,139,171,249,204,169,17,4,0,252,
+	44,0,21,193,225,170,187,30,1,0,86,0,156,21,0,43,100,171,238,150,191,171,47,190,
+	164,235,33,0,156,3,0,1,1,0,13,1,3,188,0,188,4,0,23,162,198,153,162,226,
+	168,0,72,0,220,44,0,9,193,225,10,0,124,0,11,186,235,17,0,86,0,220,20,0,
+	41,20,66,180,104,42,105,134,36,226,187,4,0,156,3,0,1,1,0,12,0,3,188,0,
+	156,4,0,23,74,154,166,187,106,129,0,188,45,0,9,193,225,10,0,252,1,0,11,186,
+	235,17,0,86,0,252,19,0,41,20,78,228,190,148,98,38,27,170,38,4,0,156,3,0,
+	3,203,0,13,2,1,1,0,252,3,0,27,234,193,171,187,30,161,186,0,252,44,0,9,
+	193,225,10,0,252,2,0,11,186,235,17,0,86,0,156,19,0,72,0,33,171,38,254,17,
+	180,75,226,107,10,0,188,3,0,3,203,0,15,0,1,1,0,220,3,0,9,234,193,11,
+	0,124,0,11,186,235,17,0,86,0,252,43,0,9,193,225,10,0,252,3,0,11,186,235,
+	17,0,86,0,252,18,0,35,106,30,42,172,161,187,65,184,162,0,188,3,0,1,1,0,
+	15,1,3,188,0,188,3,0,9,234,193,11,0,252,1,0,11,186,235,17,0,150,1,0,
+	188,42,0,9,193,225,10,0,252,4,0,11,186,235,17,0,86,0,156,18,0,37,170,134,
+	65,146,186,235,139,27,228,10,0,156,3,0,1,1,0,17,0,3,188,0,156,3,0,9,
+	234,193,11,0,252,2,0,1,10,0,118,0,5,30,1,0,86,0,188,41,0,9,193,225,
+	10,0,252,5,0,11,186,235,17,0,86,0,252,17,0,35,164,194,249,136,228,100,66,228,
+	174,0,252,2,0,1,1,0,17,2,1,1,0,252,2,0,9,234,193,11,0,188,4,0,
+	11,186,235,17,0,86,0,188,40,0,9,193,225,10,0,252,6,0,11,186,235,17,0,86,
+	0,156,17,0,23,164,105,68,171,177,130,0,188,1,0,1,10,0,220,2,0,1,1,0,
+	17,0,1,1,0,220,2,0,9,234,193,11,0,188,5,0,11,186,235,17,0,86,0,188,
+	39,0,9,193,225,10,0,252,7,0,11,186,235,17,0,86,0,188,16,0,21,193,171,30,
+	225,177,8,0,252,1,0,1,10,0,188,2,0,3,203,0,18,1,3,188,0,188,2,0,
+	9,234,193,11,0,188,6,0,11,186,235,17,0,86,0,188,38,0,9,193,225,10,0,252,
+	8,0,11,186,235,17,0,86,0,188,15,0,21,193,235,174,187,30,1,0,86,0,220,1,
+	0,1,10,0,156,2,0,3,203,0,20,0,3,188,0,156,2,0,9,234,193,11,0,188,
+	7,0,11,186,235,17,0,86,0,188,37,0,9,193,225,10,0,252,9,0,11,186,235,17,
+	0,86,0,188,14,0,5,193,11,0,188,1,0,11,186,235,17,0,86,0,156,1,0,1,
+	10,0,252,1,0,1,1,0,20,2,1,1,0,252,1,0,9,234,193,11,0,188,8,0,
+	11,186,235,17,0,86,0,188,36,0,9,193,225,10,0,252,10,0,11,186,235,17,0,86,
+	0,188,13,0,5,193,11,0,188,2,0,11,186,235,17,0,86,0,92,0,1,10,0,220,
+	1,0,1,1,0,18,0,1,1,0,220,1,0,9,234,193,11,0,188,9,0,11,186,235,
+	17,0,214,1,0,188,34,0,9,193,225,10,0,252,11,0,11,186,235,17,0,86,0,188,
+	12,0,5,193,11,0,188,3,0,11,186,235,17,0,118,0,220,1,0,3,203,0,20,1,
+	3,188,0,188,1,0,9,234,193,11,0,188,10,0,1,10,0,182,1,0,5,30,1,0,
+	86,0,188,33,0,9,193,225,10,0,252,12,0,11,186,235,17,0,86,0,188,11,0,5,
+	193,11,0,188,4,0,1,10,0,182,1,0,220,1,0,3,203,0,17,0,3,188,0,156,
+	1,0,9,234,193,11,0,188,12,0,11,186,235,17,0,86,0,188,32,0,9,193,225,10,
+	0,252,13,0,11,186,235,17,0,86,0,188,10,0,5,193,11,0,188,6,0,1,10,0,
+	188,1,0,1,1,0,17,0,3,188,0,124,0,9,234,193,11,0,188,13,0,11,186,235,
+	17,0,86,0,188,31,0,9,193,225,10,0,252,14,0,11,186,235,17,0,86,0,188,9,
+	0,5,193,11,0,252,6,0,1,10,0,156,1,0,1,1,0,17,0,3,188,0,92,0,
+	9,234,193,11,0,188,14,0,11,186,235,17,0,86,0,188,30,0,9,193,225,10,0,252,
+	15,0,11,186,235,17,0,86,0,188,8,0,5,193,11,0,188,7,0,1,10,0,124,0,
+	3,203,0,15,2,15,225,174,30,188,0,188,15,0,11,186,235,17,0,86,0,188,29,0,
+	9,193,225,10,0,252,16,0,11,186,235,17,0,86,0,188,7,0,5,193,11,0,252,7,
+	0,1,10,0,92,0,3,203,0,13,0,13,225,234,193,11,0,188,16,0,11,186,235,17,
+	0,86,0,188,28,0,9,193,225,10,0,252,17,0,11,186,235,17,0,86,0,188,6,0,
+	5,193,11,0,188,8,0,7,234,30,0,14,0,11,161,30,188,0,188,17,0,117,186,235,
+	17,27,177,27,177,27,177,27,177,27,177,27,177,27,177,27,177,27,177,27,177,27,177,27,
+	177,27,177,11,0,98,0,15,187,17,187,17,0,118,0,97,17,187,17,187,17,187,17,187,
+	17,187,17,187,17,187,17,187,17,187,17,187,17,187,193,225,10,0,252,18,0,11,186,235,
+	17,0,86,0,188,5,0,5,193,11,0,252,8,0,5,234,1,0,37,0,9,177,193,11,
+	0,188,18,0,1,10,0,86,0,1,12,1,3,204,2,3,204,2,3,204,2,3,204,2,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,
+	3,204,4,3,204,2,3,204,2,120,2,3,204,2,3,204,2,3,204,2,3,204,2,3,
+	204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,1,5,225,10,0,
+	252,19,0,59,186,235,17,27,177,27,177,27,177,27,177,27,177,27,188,0,188,9,0,5,
+	186,12,0,21,0,3,204,1,71,177,17,187,17,187,17,187,17,187,17,187,17,187,17,187,
+	17,187,17,0,118,0,7,17,187,0,98,0,23,187,17,187,17,187,17,0,182,1,0,29,
+	17,187,17,187,17,187,17,12,112,3,161,0,252,20,0,1,10,0,86,0,1,12,1,3,
+	204,2,3,204,2,3,204,2,3,204,2,3,204,1,71,177,17,187,17,187,17,187,17,187,
+	17,187,17,187,17,187,17,187,17,0,182,1,0,1,12,0,31,6,3,204,2,3,204,2,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,120,2,3,
+	204,4,3,204,2,3,204,2,3,204,2,184,1,2,3,204,2,3,204,2,3,204,115,87,
+	177,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,0,118,
+	0,85,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,187,17,12,
+	20,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,
+	2,3,204,2,184,1,0,22,130,3,3,204,2,3,204,2,3,204,2,3,204,2,3,204,
+	2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,120,2,3,204,2,
+	3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,3,204,2,
+	3,204,
+};
+
+static const byte triangle_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,7,11,14,6,7,8,13,9,15,10,2,3,
+	7,5,1,9,0,1,255,255,0,1,255,1,1,1,255,255,0,1,255,1,15,8,7,1,
+	12,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,3,7,0,0,
+	4,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,
+	2,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static const byte zigzag_lant[] = {
+	76,65,78,84,2,0,120,0,4,3,2,1,7,14,6,1,11,2,15,3,7,5,4,9,
+	3,7,10,12,0,1,255,255,255,1,255,255,0,255,1,1,255,0,1,1,12,15,7,1,
+	12,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,0,0,0,0,3,7,0,0,
+	4,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,2,0,0,0,
+	2,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const EmbeddedFile embedded_examples[] = {
+	{ "examples/cauliflower.lant", cauliflower_lant, sizeof cauliflower_lant },
+	{ "examples/highway.lant", highway_lant, sizeof highway_lant },
+	{ "examples/spiral.lant", spiral_lant, sizeof spiral_lant },
+	{ "examples/square.lant", square_lant, sizeof square_lant },
+	{ "examples/square2.lant", square2_lant, sizeof square2_lant },
+	{ "examples/square3.lant", square3_lant, sizeof square3_lant },
+	{ "examples/sword.lant", sword_lant, sizeof sword_lant },
+	{ "examples/test.lant", test_lant, sizeof test_lant },
+	{ "examples/triangle.lant", triangle_lant, sizeof triangle_lant },
+	{ "examples/zigzag.lant", zigzag_lant, sizeof zigzag_lant },
+};
+
+const size_t embedded_example_count = LEN(embedded_examples);
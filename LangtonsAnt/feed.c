@@ -0,0 +1,189 @@
+#include "logic.h"
+#include "thread.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+struct cell_feed {
+	CellChange    *ring;
+	unsigned long  mask;      /**< Capacity - 1, capacity being a power of 2 */
+	FeedPolicy     policy;
+	atomic_word_t  head;      /**< Next change to read, advanced by the consumer */
+	atomic_word_t  tail;      /**< Next change to write, advanced by the producer */
+	atomic_word_t  resync;    /**< Were changes dropped since the consumer last checked? None are published until it does */
+	atomic_word_t  closed;    /**< Producer skips the feed, and stops waiting on it */
+	atomic_word_t  blocked;   /**< Producer is waiting for room (FEED_BLOCK) */
+	mutex_t        lock;
+	cond_t         room;
+	CellFeed      *next;      /**< Next subscriber of the same simulation */
+};
+
+CellFeed *feed_new(unsigned capacity, FeedPolicy policy)
+{
+	CellFeed *feed;
+	unsigned long n = 1;
+
+	assert(capacity > 0);
+	while (n < capacity) {
+		n <<= 1;
+	}
+	if (!(feed = calloc(1, sizeof(CellFeed)))) {
+		return NULL;
+	}
+	if (!(feed->ring = malloc(n * sizeof(CellChange)))) {
+		free(feed);
+		return NULL;
+	}
+	feed->mask = n - 1;
+	feed->policy = policy;
+	mutex_init(&feed->lock);
+	cond_init(&feed->room);
+	return feed;
+}
+
+void feed_delete(CellFeed *feed)
+{
+	assert(feed);
+	mutex_destroy(&feed->lock);
+	cond_destroy(&feed->room);
+	free(feed->ring);
+	free(feed);
+}
+
+void feed_subscribe(Simulation *sim, CellFeed *feed)
+{
+	assert(sim), assert(feed);
+	atomic_word_store(&feed->closed, false);
+	atomic_word_store(&feed->resync, true);  // Changes from before now were never seen
+	feed->next = sim->feeds;
+	sim->feeds = feed;
+}
+
+void feed_unsubscribe(Simulation *sim, CellFeed *feed)
+{
+	CellFeed **f;
+
+	assert(sim), assert(feed);
+	feed_close(feed);
+	for (f = &sim->feeds; *f; f = &(*f)->next) {
+		if (*f == feed) {
+			*f = feed->next;
+			break;
+		}
+	}
+	feed->next = NULL;
+}
+
+void feed_transfer(Simulation *from, Simulation *to)
+{
+	CellFeed *f, *last = NULL;
+
+	assert(from), assert(to);
+	for (f = from->feeds; f; last = f, f = f->next) {
+		atomic_word_store(&f->resync, true);  // Nothing carries over from the old grid
+	}
+	if (last) {
+		last->next = to->feeds;
+		to->feeds = from->feeds;
+		from->feeds = NULL;
+	}
+}
+
+void feed_close(CellFeed *feed)
+{
+	assert(feed);
+	atomic_word_store(&feed->closed, true);
+	mutex_lock(&feed->lock);
+	cond_signal(&feed->room);
+	mutex_unlock(&feed->lock);
+}
+
+/* Waits until the consumer reads past the given position, false if the feed got closed */
+static bool wait_for_room(CellFeed *feed, unsigned long tail)
+{
+	bool ok;
+
+	mutex_lock(&feed->lock);
+	atomic_word_store(&feed->blocked, true);
+	while ((ok = !atomic_word_load(&feed->closed))
+	    && tail - (unsigned long)atomic_word_load(&feed->head) > feed->mask) {
+		cond_wait(&feed->room, &feed->lock);
+	}
+	atomic_word_store(&feed->blocked, false);
+	mutex_unlock(&feed->lock);
+	return ok;
+}
+
+/* Will the subscriber rebuild its state from the grid anyway, or not read at all? */
+static bool is_feed_idle(CellFeed *feed)
+{
+	return atomic_word_load(&feed->closed) || atomic_word_load(&feed->resync);
+}
+
+bool feed_is_wanted(Simulation *sim)
+{
+	CellFeed *f;
+
+	for (f = sim->feeds; f; f = f->next) {
+		if (!is_feed_idle(f)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void feed_publish(Simulation *sim, const CellChange *change)
+{
+	CellFeed *f;
+
+	for (f = sim->feeds; f; f = f->next) {
+		unsigned long tail = (unsigned long)atomic_word_load(&f->tail);
+
+		if (is_feed_idle(f)) {
+			continue;
+		}
+		if (tail - (unsigned long)atomic_word_load(&f->head) > f->mask) {
+			if (f->policy == FEED_DROP) {
+				atomic_word_store(&f->resync, true);
+				continue;
+			} else if (!wait_for_room(f, tail)) {
+				continue;
+			}
+		}
+		f->ring[tail & f->mask] = *change;
+		atomic_word_store(&f->tail, tail + 1);  // Publishes the change to the consumer
+	}
+}
+
+size_t feed_read(CellFeed *feed, CellChange *out, size_t max)
+{
+	unsigned long head, tail;
+	size_t n = 0;
+
+	assert(feed), assert(out);
+	head = (unsigned long)atomic_word_load(&feed->head);
+	tail = (unsigned long)atomic_word_load(&feed->tail);
+	while (head != tail && n < max) {
+		out[n++] = feed->ring[head++ & feed->mask];
+	}
+	if (n) {
+		atomic_word_store(&feed->head, head);
+		if (atomic_word_load(&feed->blocked)) {
+			mutex_lock(&feed->lock);
+			cond_signal(&feed->room);
+			mutex_unlock(&feed->lock);
+		}
+	}
+	return n;
+}
+
+bool feed_take_resync(CellFeed *feed)
+{
+	assert(feed);
+	if (!atomic_word_load(&feed->resync)) {
+		return false;
+	}
+	/* A drop racing with this is covered too, the consumer rebuilds its state after clearing */
+	atomic_word_store(&feed->resync, false);
+	return true;
+}
@@ -86,6 +86,7 @@ void init_graphics(color_t fg_color, color_t bg_color)
 
 	start_color();
 	init_def_pairs(fg_color, bg_color);
+	init_sprites();
 
 	init_grid_window();
 	init_menu_window();
@@ -187,14 +188,10 @@ void draw_frame(WINDOW *w, Vector2i top_left, unsigned width, unsigned height)
 
 void draw_sprite(WINDOW *w, SpriteInfo sprite, Vector2i top_left)
 {
-	unsigned read, y, x;
-	byte pixel;
-	for (read = 0; read < sprite.width * sprite.height; read++) {
-		pixel = (sprite.data[read/8] >> (7-read%8)) & 1;
-		y = read / sprite.width, x = read % sprite.width;
-		if (pixel) {
-			mvwaddch(w, top_left.y+y, top_left.x+x, CHAR_FULL);
-		}
+	SpriteSpans ss = sprite_spans(sprite);
+	const SpriteSpan *s;
+	for (s = ss.spans; s < ss.spans + ss.count; s++) {
+		mvwhline(w, top_left.y+s->y, top_left.x+s->x, CHAR_FULL, s->len);
 	}
 }
 
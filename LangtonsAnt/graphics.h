@@ -174,6 +174,7 @@ typedef struct scroll_info {
 #define MENU_GRID_SIZE_Y     (MENU_STATE_FUNC_Y + MENU_V_PAD + 4)
 #define MENU_STATUS_Y        (MENU_WINDOW_HEIGHT - MENU_V_MARGIN - 7)
 #define MENU_STEPS_LEN       8
+#define MENU_RATE_LEN        8
 #define MENU_BORDER_COLOR    COLOR_NAVY
 #define MENU_BORDER_COLOR_S  COLOR_PURPLE
 #define MENU_ACTIVE_COLOR    COLOR_BLUE
@@ -197,6 +198,7 @@ typedef struct scroll_info {
 #define MENU_PAUSE_COLOR     COLOR_YELLOW
 #define MENU_STOP_COLOR      COLOR_RED
 #define MENU_CLEAR_COLOR     COLOR_TEAL
+#define MENU_PROGRESS_COLOR  COLOR_YELLOW
 
 #define MENU_UDARROW_WIDTH   SPRITE_UDARROW_WIDTH
 #define MENU_UDARROW_HEIGHT  SPRITE_UDARROW_HEIGHT
@@ -219,11 +221,32 @@ typedef struct scroll_info {
 #define MENU_TILES_HEIGHT    (MENU_TILES_PER_COL*MENU_TILE_PHEIGHT + MENU_TILE_V_PAD + 3)
 ///@}
 
+/** Independently redrawn menu widgets, in drawing order */
+typedef enum {
+	MW_LOGO,
+	MW_BORDER,
+	MW_RULES,
+	MW_INIT_SIZE,
+	MW_DIRECTION,
+	MW_STEPUP,
+	MW_SPEED,
+	MW_RATE,
+	MW_STATE_FUNC,
+	MW_CONTROLS,
+	MW_IO_BUTTONS,
+	MW_SIZE,
+	MW_STEPS,
+	MW_LABELS,
+	_MW_COUNT
+} MenuWidgetType;
+
 /** Currently active menu settings */
 typedef struct settings {
 	Colors     *colors;      /**< Color rules */
 	unsigned    init_size;   /**< Initial grid size */
 	unsigned    speed;       /**< Speed multiplier */
+	unsigned    step_limit;  /**< Stop the main loop after this many steps (0 for no limit) */
+	bool        text_saves;  /**< Save from the menu in the (v1) text format */
 	Simulation *simulation;  /**< Active simulation */
 } Settings;
 
@@ -310,10 +333,15 @@ typedef struct pending_action {
 ///@{
 #define LOOP_DEF_SPEED           2     /**< Default speed multiplier */
 #define LOOP_MIN_SPEED           1     /**< Minimum allowed speed multiplier */
-#define LOOP_MAX_SPEED           9     /**< Maximum allowed speed multiplier */
+#define LOOP_MAX_SPEED           9     /**< Maximum speed multiplier with a fixed time per step */
+#define LOOP_TURBO_TIERS         3     /**< Speeds above LOOP_MAX_SPEED, stepping for a share of each frame */
+#define LOOP_TOP_SPEED           (LOOP_MAX_SPEED + LOOP_TURBO_TIERS)  /**< Maximum allowed speed */
+#define LOOP_TURBO_BUDGET        0.8   /**< Share of a frame spent stepping and drawing at top speed */
 #define LOOP_MIN_STEP_TIME_S     1e-5  /**< Min time per step (max speed), > 0 */
 #define LOOP_MAX_STEP_TIME_S     0.75  /**< Max time per step (min speed) */
 #define LOOP_FRAMES_PER_S        30    /**< Target framerate for drawing */
+#define LOOP_POLL_MS             5U    /**< Longest the UI sleeps where input can't be waited on */
+#define LOOP_FEED_CAPACITY       8192U /**< Cell changes buffered for drawing between frames */
 ///@}
 
 /** @name Timestep calculation macros */
@@ -330,6 +358,8 @@ typedef struct pending_action {
 #define LOOP_STEP_TIME_US(s)     (1e6 * LOOP_STEP_TIME_S(s))
 #define LOOP_STEP_TIME_S(s)      LOOP_EASE(LOOP_MAX_STEP_TIME_S, LOOP_MIN_STEP_TIME_S, LOOP_SPEED_COEF(s))
 #define LOOP_SPEED_COEF(s)       (((double)(s) - LOOP_MIN_SPEED) / (LOOP_MAX_SPEED - LOOP_MIN_SPEED))
+#define LOOP_TURBO_BUDGET_US(s)  (LOOP_FRAME_TIME_US * LOOP_TURBO_BUDGET * ((s) - LOOP_MAX_SPEED) / LOOP_TURBO_TIERS)
+#define IS_TURBO_SPEED(s)        ((s) > LOOP_MAX_SPEED)
 ///@}
 
 /** @name Interpolation/easing macros */
@@ -347,6 +377,116 @@ typedef struct pending_action {
 typedef long long  ttime_t;
 
 
+/*------------------------- Engine macros and types --------------------------*/
+
+/** @name Simulation thread settings */
+///@{
+#define ENGINE_BATCH_MAX         4096U   /**< Max steps taken in one go while holding the simulation */
+#define ENGINE_MAX_LAG_US        100000  /**< Due steps further behind than this are dropped */
+#define ENGINE_SLICE_US          2000    /**< Longest turbo batch, bounding how long input waits for it */
+#define ENGINE_MIN_STEP_COST_US  0.005   /**< Floor (and starting point) for the measured time per step */
+#define ENGINE_RATE_PERIOD_US    500000  /**< Period over which the achieved steps/s is measured */
+///@}
+
+/** Command sent from the UI to the simulation thread */
+typedef enum {
+	ENGINE_PLAY,   /**< Start running at the current speed */
+	ENGINE_PAUSE,  /**< Stop running */
+	ENGINE_STEP,   /**< Pause and take a single step */
+	ENGINE_SPEED   /**< Speed setting changed, reschedule */
+} EngineCommand;
+
+/** Simulation state published by the simulation thread after every batch of steps */
+typedef struct engine_view {
+	unsigned   steps;
+	Vector2i   ant_pos;
+	Direction  ant_dir;
+	unsigned   grid_size;
+	unsigned   epoch;      /**< Changes when the grid is expanded, made sparse or replaced */
+	unsigned   rate;       /**< Steps per second lately, 0 while paused */
+} EngineView;
+
+
+/*---------------------- Control socket macros and types ---------------------*/
+
+/** @name Control socket settings */
+///@{
+#define CONTROL_TELEMETRY_HZ  10U           /**< Most telemetry lines sent per second */
+#define CONTROL_MAX_CLIENTS   8U
+#define CONTROL_LINE_MAX      512U          /**< Longest command taken, newline included */
+#define CONTROL_OUT_BUF_SZ    (64U << 10)   /**< Output held back per client, telemetry beyond it is skipped */
+#define CONTROL_QUEUE_LEN     16U           /**< Commands waiting for the main loop or their replies */
+#define CONTROL_ARG_SZ        256U          /**< Longest file name taken, NUL included */
+///@}
+
+/** Command received through the control socket */
+typedef enum {
+	CONTROL_PAUSE,
+	CONTROL_RUN,
+	CONTROL_SPEED,
+	CONTROL_LOAD,
+	CONTROL_SAVE
+} ControlCommandType;
+
+/** Command along with its argument and where to send the reply */
+typedef struct control_command {
+	ControlCommandType  type;
+	unsigned            value;                /**< New speed */
+	char                arg[CONTROL_ARG_SZ];  /**< File to load or save */
+	unsigned long       client;               /**< Connection it came from */
+	long                id;                   /**< Echoed back in the reply if has_id */
+	bool                has_id;
+} ControlCommand;
+
+/** Snapshot of the simulation sent out as telemetry, published by the main loop */
+typedef struct telemetry {
+	unsigned   steps;
+	unsigned   rate;                          /**< Steps per second lately */
+	unsigned   speed;
+	bool       running;
+	unsigned   grid_size, colored;
+	bool       sparse;
+	Vector2i   top_left, bottom_right;        /**< Bounding box of the colored cells */
+	double     frame_ms;                      /**< Time between the last two frames */
+	double     draw_ms;                       /**< Time spent on the last one */
+	IOStatus   load_status, save_status;
+	unsigned   load_progress, save_progress;  /**< Thousandths, while a load or save runs */
+} Telemetry;
+
+/** Server for the control socket (opaque) */
+typedef struct control  Control;
+
+
+/*---------------------- Render backend macros and types ---------------------*/
+
+/** @name Pixel backend settings */
+///@{
+#define PIXEL_TILE_CHARS     8       /**< Tile side in terminal characters */
+#define PIXEL_FRAME_TIME_US  33333   /**< Minimum time between image uploads */
+#define PIXEL_KITTY_CHUNK    4096    /**< Max base64 payload per kitty escape */
+#define PIXEL_DEF_CELL_W     8       /**< Character size if the terminal won't say */
+#define PIXEL_DEF_CELL_H     16
+///@}
+
+/** Interface for everything the main loop draws and reads, selected at startup */
+typedef struct render_backend {
+	const char *name;                                            /**< Backend name */
+	void      (*init)(color_t fg_color, color_t bg_color);       /**< Sets up output */
+	void      (*end)(void);                                      /**< Tears down output */
+	void      (*draw_region)(Grid *grid, Ant *ant);              /**< Draws visible grid */
+	void      (*draw_cell)(Grid *grid, Ant *ant, Vector2i pos);  /**< Draws changed cell */
+	void      (*draw_menu)(bool full);                           /**< Draws menu */
+	bool      (*present)(void);                                  /**< Outputs a frame, false if some held back */
+	int       (*poll_input)(MEVENT *mouse);                      /**< Key or ERR if none */
+	void      (*flush_input)(void);                              /**< Discards typeahead */
+} RenderBackend;
+
+/** Number of calls made to the active render backend */
+typedef struct render_stats {
+	unsigned long long  regions, cells, menus, presents, polls;
+} RenderStats;
+
+
 /*------------------------ Global variables/constants ------------------------*/
 
 /** @name Globals */
@@ -361,6 +501,7 @@ extern const Vector2i  grid_pos;
 extern WINDOW         *menuw;
 extern Settings        stgs;
 extern IOStatus        load_status, save_status;
+extern unsigned        load_progress, save_progress;
 extern PendingAction   pending_action;
 extern const Vector2i  menu_pos;
 extern const Vector2i  menu_logo_pos;
@@ -377,6 +518,14 @@ extern const Vector2i  menu_save_pos;
 extern WINDOW         *dialogw;
 extern Vector2i        dialog_pos;
 extern const char     *dialog_cdef_msg;
+
+extern WINDOW         *inputw;
+
+extern const RenderBackend  curses_backend, null_backend, pixel_backend;
+extern const RenderBackend *render;
+extern RenderStats          render_stats;
+
+extern Control        *active_control;  /**< Fed by the main loop (NULL if not serving) */
 ///@}
 
 
@@ -503,6 +652,172 @@ void main_loop(void);
  */
 void stop_main_loop(void);
 
+/**
+ * Wakes the main loop if it's waiting for input; safe to call from any thread
+ * or from a signal handler
+ * @see main_loop(void)
+ */
+void wake_main_loop(void);
+
+
+/*----------------------------------------------------------------------------*
+ *                                  engine.c                                  *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Starts the simulation thread, which steps stgs.simulation while it's running
+ * @see engine_stop(void)
+ */
+void engine_start(void);
+
+/**
+ * Stops the simulation thread and waits for it to finish its batch
+ * @see engine_start(void)
+ */
+void engine_stop(void);
+
+/**
+ * Takes exclusive access to stgs.simulation (and the settings it's stepped with)
+ * The simulation thread yields at the end of its current batch
+ * @see engine_unlock(void)
+ */
+void engine_lock(void);
+
+/**
+ * Gives access to the simulation back to the simulation thread
+ * @see engine_lock(void)
+ */
+void engine_unlock(void);
+
+/**
+ * Sends a command to the simulation thread; call with the engine locked
+ * @param cmd Command to be carried out
+ * @see engine_lock(void)
+ */
+void engine_command(EngineCommand cmd);
+
+/**
+ * Reads the latest published state without locking (seqlock over two buffers)
+ * @param view Filled in with a consistent copy
+ */
+void engine_view(EngineView *view);
+
+/**
+ * Has the simulation thread wake the main loop the next time it publishes
+ * progress; check engine_view afterwards, progress made meanwhile doesn't wake
+ * @see wake_main_loop(void)
+ */
+void engine_watch(void);
+
+
+/*----------------------------------------------------------------------------*
+ *                                 control.c                                  *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Starts serving telemetry as newline-delimited JSON on a UNIX domain socket,
+ * and taking commands from its clients, on a thread of its own
+ * @param path Path of the socket; a stale one left there is replaced
+ * @return Pointer to a Control if successful; NULL otherwise (or on Windows)
+ * @see control_stop(Control *)
+ */
+Control *control_start(const char *path);
+
+/**
+ * Disconnects all clients, stops the server thread and removes the socket
+ * @param ctl Control to be stopped
+ * @see control_start(const char *)
+ */
+void control_stop(Control *ctl);
+
+/**
+ * Replaces the snapshot sent out next; only copies it, so slow clients never
+ * hold up the caller
+ * @param ctl Control to publish to
+ * @param tel Latest state of the simulation
+ */
+void control_publish(Control *ctl, const Telemetry *tel);
+
+/**
+ * Takes the oldest command received and not yet carried out
+ * @param ctl Control to take it from
+ * @param cmd Filled in with the command
+ * @return true if there was one; false otherwise
+ * @see control_reply(Control *, const ControlCommand *, const char *)
+ */
+bool control_take(Control *ctl, ControlCommand *cmd);
+
+/**
+ * Sends the outcome of a command to the client that gave it
+ * @param ctl Control it was taken from
+ * @param cmd Command that was carried out
+ * @param error What went wrong; NULL if it succeeded
+ * @see control_take(Control *, ControlCommand *)
+ */
+void control_reply(Control *ctl, const ControlCommand *cmd, const char *error);
+
+
+/*----------------------------------------------------------------------------*
+ *                                  render.c                                  *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Initializes the active render backend and resets render_stats
+ * @param fg_color Foreground color
+ * @param bg_color Background color
+ * @see render_end(void)
+ */
+void render_init(color_t fg_color, color_t bg_color);
+
+/**
+ * Ends drawing with the active render backend
+ * @see render_init(color_t, color_t)
+ */
+void render_end(void);
+
+/**
+ * Draws the entire visible grid region
+ * @param grid Grid from which to draw (NULL for empty region)
+ * @param ant Ant to be drawn in the grid (NULL for no ant)
+ * @see draw_grid_full(Grid *, Ant *)
+ */
+void render_region(Grid *grid, Ant *ant);
+
+/**
+ * Draws a changed cell and the ant
+ * @param grid Grid from which to draw
+ * @param ant Ant to be drawn in the grid (NULL for no ant)
+ * @param prev_pos Position of cell that has changed
+ * @see draw_grid_iter(Grid *, Ant *, Vector2i)
+ */
+void render_cell(Grid *grid, Ant *ant, Vector2i prev_pos);
+
+/**
+ * Draws the menu
+ * @param full Should all widgets be drawn, or only the changed ones?
+ * @see draw_menu_full(void)
+ * @see draw_menu_iter(void)
+ */
+void render_menu(bool full);
+
+/**
+ * Outputs everything drawn since the previous frame
+ * @return False if the backend held some back, to go out with a later frame
+ */
+bool render_present(void);
+
+/**
+ * Reads a single input event without blocking
+ * @param mouse Filled in if a mouse event happened (bstate is 0 if invalid)
+ * @return Key that was pressed; or ERR if there was no input
+ */
+int render_poll_input(MEVENT *mouse);
+
+/**
+ * Discards any pending input
+ */
+void render_flush_input(void);
+
 
 /*----------------------------------------------------------------------------*
  *                                  timer.c                                   *
@@ -625,12 +940,34 @@ void end_menu_window(void);
 void draw_menu_full(void);
 
 /**
- * Draws only the parts of the menu that can dynamically change
+ * Draws only the menu widgets whose state has changed or that were invalidated
  * Suitable for calling in loops as it does less work than draw_menu_full
  * @see draw_menu_full(void)
+ * @see menu_invalidate(MenuWidgetType)
  */
 void draw_menu_iter(void);
 
+/**
+ * Forces a menu widget to be redrawn on the next draw_menu_iter
+ * @param type Widget to be redrawn
+ * @see menu_invalidate_all(void)
+ */
+void menu_invalidate(MenuWidgetType type);
+
+/**
+ * Forces all menu widgets to be redrawn on the next draw_menu_iter
+ * @see menu_invalidate(MenuWidgetType)
+ */
+void menu_invalidate_all(void);
+
+/**
+ * Marks a part of the menu as uncovered (e.g. by a closed window) so that it is
+ * copied to the screen again on the next draw, without redrawing any widgets
+ * @param top_left Origin of the uncovered area relative to menu
+ * @param height Height of the uncovered area
+ */
+void menu_invalidate_area(Vector2i top_left, unsigned height);
+
 /**
  * Finds the relative position of a color tile in the menu
  * @param index Index in the color list
@@ -679,6 +1016,16 @@ state_t reset_simulation(void);
  */
 state_t clear_simulation(void);
 
+/**
+ * Updates the progress and status of background loads and saves started from the menu
+ * A finished load replaces the active simulation, holding the engine lock meanwhile.
+ * In gallery mode, also starts prefetching the example that cycling loads next
+ * @return STATE_MENU_CHANGED if either changed (along with what a load changes); STATE_NO_CHANGE otherwise
+ * @see save_job_poll(SaveJob *)
+ * @see load_job_poll(LoadJob *, Simulation **)
+ */
+state_t poll_io_jobs(void);
+
 /**
  * Handles key commands passed to the menu window
  * @param key Key that was pressed
@@ -689,6 +1036,34 @@ state_t clear_simulation(void);
  */
 state_t menu_key_command(int key, MEVENT *mouse);
 
+/**
+ * Handles keys typed into the filename prompt, which takes all input while open (inputw)
+ * Enter or Esc closes it, and the load or save that opened it goes on or fails
+ * @param key Key that was pressed
+ * @param mouse Pointer to mouse event if one happened; NULL otherwise
+ * @return STATE_MENU_CHANGED if the prompt changed (along with what closing it changes);
+ *         STATE_NO_CHANGE otherwise
+ * @see update_input(bool)
+ */
+state_t input_key_command(int key, MEVENT *mouse);
+
+/**
+ * Redraws the filename prompt if it was typed into; otherwise only puts it back on screen
+ * @param overlapped Was the menu beneath the prompt refreshed?
+ * @see input_key_command(int, MEVENT *)
+ */
+void update_input(bool overlapped);
+
+/**
+ * Carries out a command received through the control socket, as the menu would;
+ * call with the engine locked
+ * @param cmd Command to be carried out
+ * @param error Set to what went wrong; NULL if nothing did
+ * @return Same as for the matching menu control
+ * @see control_take(Control *, ControlCommand *)
+ */
+state_t menu_remote_command(const ControlCommand *cmd, const char **error);
+
 /**
  * Handles mouse commands passed to the menu window
  * @param mouse Pointer to mouse event if one happened; NULL otherwise
@@ -720,9 +1095,17 @@ void close_dialog(void);
 
 /**
  * Draws the dialog window
+ * @see update_dialog(bool)
  */
 void draw_dialog(void);
 
+/**
+ * Redraws the dialog if its state changed; otherwise only puts it back on screen
+ * @param overlapped Was the menu beneath the dialog refreshed?
+ * @see draw_dialog(void)
+ */
+void update_dialog(bool overlapped);
+
 /**
  * Finds the relative position of a color tile in the dialog
  * @param color Color of tile
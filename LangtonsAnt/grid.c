@@ -5,6 +5,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _WIN32
+#	include <sys/mman.h>
+#endif
+
 Grid *grid_new(Colors *colors, unsigned init_size)
 {
 	assert(colors);
@@ -17,6 +21,9 @@ Grid *grid_new(Colors *colors, unsigned init_size)
 		memset(grid->c[i], (byte)colors->def, init_size);
 	}
 	grid->csr = NULL;
+	grid->block = NULL;
+	grid->block_size = 0;
+	grid->is_mapped = false;
 	grid->size = grid->init_size = init_size;
 	grid->tmp = NULL;
 	grid->tmp_size = 0;
@@ -42,13 +49,38 @@ static void grid_delete_tmp(Grid *grid)
 	grid->tmp_size = 0;
 }
 
+static void grid_free_row(Grid *grid, unsigned i)
+{
+	if (!grid->block) {
+		free(grid->c[i]);  // Rows in a block are released all at once
+	}
+}
+
+void grid_free_block(Grid *grid)
+{
+	assert(grid);
+	if (!grid->block) {
+		return;
+	}
+#ifndef _WIN32
+	if (grid->is_mapped) {
+		munmap(grid->block, grid->block_size);
+	} else
+#endif
+	free(grid->block);
+	grid->block = NULL;
+	grid->block_size = 0;
+	grid->is_mapped = false;
+}
+
 static void grid_delete_n(Grid *grid)
 {
 	unsigned i;
 	grid_delete_tmp(grid);
 	for (i = 0; i < grid->size; i++) {
-		free(grid->c[i]);
+		grid_free_row(grid, i);
 	}
+	grid_free_block(grid);
 	free(grid->c);
 }
 
@@ -73,6 +105,53 @@ void grid_delete(Grid *grid)
 	free(grid);
 }
 
+Grid *grid_copy(Grid *grid)
+{
+	assert(grid);
+	Grid *copy = malloc(sizeof(Grid));
+	size_t size = grid->size, i;
+
+	if (!copy) {
+		return NULL;
+	}
+	*copy = *grid;
+	copy->tmp = NULL;
+	copy->tmp_size = 0;
+	copy->is_mapped = false;
+
+	if (is_grid_sparse(grid)) {
+		copy->block = NULL;
+		copy->block_size = 0;
+		copy->csr = calloc(size, sizeof(SparseCell *));
+		for (i = 0; copy->csr && i < size; i++) {
+			SparseCell *t, *p = NULL;
+			for (t = grid->csr[i]; t; t = t->next) {
+				p = sparse_append(p, CSR_GET_COLUMN(t), (byte)CSR_GET_COLOR(t));
+				if (!copy->csr[i]) {
+					copy->csr[i] = p;
+				}
+			}
+		}
+		if (!copy->csr) {
+			free(copy);
+			return NULL;
+		}
+	} else {
+		copy->block_size = size * size;  // All rows in one allocation
+		copy->block = malloc(copy->block_size);
+		copy->c = malloc(size * sizeof(byte *));
+		if (!copy->block || !copy->c) {
+			free(copy->block), free(copy->c), free(copy);
+			return NULL;
+		}
+		for (i = 0; i < size; i++) {
+			copy->c[i] = copy->block + i*size;
+			memcpy(copy->c[i], grid->c[i], size);
+		}
+	}
+	return copy;
+}
+
 static inline void transfer_vector(Vector2i *v, unsigned old_size)
 {
 	v->y += old_size;
@@ -123,9 +202,10 @@ static void grid_expand_n(Grid *grid)
 		memset(grid->tmp[i], grid->def_color, size);
 		if (i >= pre && i < post) {
 			memcpy(&grid->tmp[i][pre], grid->c[i-pre], old);
-			free(grid->c[i-pre]);
+			grid_free_row(grid, i-pre);
 		}
 	}
+	grid_free_block(grid);
 	free(grid->c);
 	
 	grid->c = grid->tmp;
@@ -197,8 +277,9 @@ void grid_make_sparse(Grid *grid)
 			}
 		}
 
-		free(grid->c[i]);
+		grid_free_row(grid, i);
 	}
+	grid_free_block(grid);
 	free(grid->c);
 	grid->c = NULL;
 }
@@ -217,6 +298,17 @@ bool is_grid_usage_low(Grid *grid)
 	return (double)grid->colored / b < GRID_USAGE_THRESHOLD;
 }
 
+size_t grid_memory_usage(Grid *grid)
+{
+	assert(grid);
+	size_t size = grid->size;
+	if (is_grid_sparse(grid)) {
+		return size*sizeof(SparseCell *) + (size_t)grid->colored*sizeof(SparseCell);
+	}
+	/* Rows, and those already set aside for the next expansion */
+	return size*(size + sizeof(byte *)) + (size_t)grid->tmp_size*(size*GRID_MULT + sizeof(byte *));
+}
+
 void sparse_prepend(SparseCell **phead, unsigned column, byte color)
 {
 	assert(phead);
@@ -241,6 +333,27 @@ SparseCell *sparse_append(SparseCell *head, unsigned column, byte color)
 	return new;
 }
 
+void grid_read_row(Grid *grid, int y, int x, unsigned n, byte *out)
+{
+	assert(grid), assert(out);
+	int begin = MAX(x, 0), end = (int)MIN((long long)x + n, (long long)grid->size);
+	SparseCell *t;
+
+	memset(out, grid->def_color, n);
+	if (y < 0 || (unsigned)y >= grid->size || begin >= end) {
+		return;
+	}
+
+	if (!is_grid_sparse(grid)) {
+		memcpy(out + (begin-x), grid->c[y] + begin, end - begin);
+		return;
+	}
+	for (t = grid->csr[y]; t && CSR_GET_COLUMN(t) < (unsigned)begin; t = t->next);
+	for (; t && CSR_GET_COLUMN(t) < (unsigned)end; t = t->next) {
+		out[CSR_GET_COLUMN(t) - x] = (byte)CSR_GET_COLOR(t);
+	}
+}
+
 byte sparse_color_at(Grid *grid, Vector2i pos)
 {
 	assert(grid);
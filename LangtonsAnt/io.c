@@ -1,288 +1,556 @@
 #include "io.h"
+#include "thread.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-Colors *load_colors(const char *filename)
+#ifdef _WIN32
+#	include <Windows.h>
+#endif
+
+/*--------------------------------- Progress ---------------------------------*/
+
+static THREAD_LOCAL io_progress_func_t  progress_func;
+static THREAD_LOCAL void               *progress_arg;
+
+void io_set_progress(io_progress_func_t func, void *arg)
+{
+	progress_func = func;
+	progress_arg = arg;
+}
+
+bool io_progress(uint64_t done, uint64_t total)
+{
+	return !progress_func || (*progress_func)(progress_arg, done, total);
+}
+
+/*--------------------------------- Reading ----------------------------------*/
+
+typedef struct text_reader {
+	const char  *p, *end;
+	bool         ok;  /**< Cleared by the first malformed token */
+} TextReader;
+
+/* Reads up to limit bytes of a file in one go, NUL-terminated */
+static char *read_text_file(const char *filename, size_t limit, size_t *size)
 {
-	Colors *colors;
 	FILE *input;
-	int e;
-	color_t def, i, c;
-	turn_t t;
+	char *data = NULL;
+	long long length;
 
-	if (!(input = fopen(filename, "r"))) {
+	if (!(input = fopen(filename, "rb"))) {
 		return NULL;
 	}
+	if ((length = file_size(input)) < 0 || file_seek(input, 0) == EOF) {
+		goto end;
+	}
+	*size = (size_t)MIN((unsigned long long)length, limit);
+	if ((data = malloc(*size + 1))) {
+		*size = fread(data, 1, *size, input);
+		data[*size] = '\0';
+	}
 
-	e = fscanf(input, "%hd\n", &def);
-	if (def < 0 || def >= COLOR_COUNT) {
-		return NULL;
+end:
+	fclose(input);
+	return data;
+}
+
+static void skip_space(TextReader *r)
+{
+	while (r->p < r->end && (*r->p == ' ' || *r->p == '\t' || *r->p == '\r' || *r->p == '\n')) {
+		r->p++;
 	}
-	def = BGR(def);
-	colors = colors_new(def);
-	colors->def = def;
+}
 
-	for (i = 0; i < COLOR_COUNT; i++) {
-		e += fscanf(input, (i < COLOR_COUNT-1) ? "%hd " : "%hd\n", &c);
-		colors->next[BGR(i)] = BGR(c);
+/* Same whitespace rules as fscanf's "%d" */
+static long long read_int(TextReader *r)
+{
+	long long value = 0;
+	bool negative = false;
+	const char *start;
+
+	skip_space(r);
+	if (r->p < r->end && (*r->p == '-' || *r->p == '+')) {
+		negative = (*r->p++ == '-');
 	}
-	for (i = 0; i < COLOR_COUNT; i++) {
-		e += fscanf(input, (i < COLOR_COUNT-1) ? "%hhd " : "%hhd\n", &t);
-		colors->turn[BGR(i)] = t;
+	for (start = r->p; r->p < r->end && *r->p >= '0' && *r->p <= '9'; r->p++) {
+		value = value*10 + (*r->p - '0');
 	}
-	e += fscanf(input, "%hd %hd\n", &i, &c);
-	colors->first = BGR(i), colors->last = BGR(c);
-	e += fscanf(input, "%u\n", &colors->n);
+	r->ok &= (r->p > start);
+	return negative ? -value : value;
+}
 
-	if (fclose(input) == EOF || e < COLORS_FIELD_COUNT) {
-		colors_delete(colors);
-		return NULL;
+static unsigned read_hex(TextReader *r)
+{
+	unsigned value = 0;
+	const char *start;
+
+	skip_space(r);
+	for (start = r->p; r->p < r->end; r->p++) {
+		char c = *r->p;
+		if (c >= '0' && c <= '9') {
+			value = value<<4 | (unsigned)(c - '0');
+		} else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+			value = value<<4 | (unsigned)((c | 0x20) - 'a' + 10);
+		} else {
+			break;
+		}
 	}
-	return colors;
+	r->ok &= (r->p > start);
+	return value;
 }
 
-int save_colors(const char *filename, Colors *colors)
+static color_t read_color(TextReader *r)
 {
-	FILE *output;
-	int e;
-	color_t i;
+	long long c = read_int(r);
+	r->ok &= (c >= 0 && c < COLOR_COUNT);
+	return r->ok ? BGR((color_t)c) : 0;
+}
 
-	if (!(output = fopen(filename, "w"))) {
-		return EOF;
+static Colors *parse_colors(TextReader *r)
+{
+	Colors *colors;
+	color_t def, i;
+
+	def = read_color(r);
+	if (!r->ok) {
+		return NULL;
 	}
+	colors = colors_new(def);
+	colors->def = def;
 
-	e = fprintf(output, "%hd\n", BGR(colors->def));
 	for (i = 0; i < COLOR_COUNT; i++) {
-		e += fprintf(output, (i < COLOR_COUNT-1) ? "%hd " : "%hd\n",
-		             BGR(colors->next[BGR(i)]));
+		colors->next[BGR(i)] = read_color(r);
 	}
 	for (i = 0; i < COLOR_COUNT; i++) {
-		e += fprintf(output, (i < COLOR_COUNT-1) ? "%hhd " : "%hhd\n",
-		             colors->turn[BGR(i)]);
+		colors->turn[BGR(i)] = (turn_t)read_int(r);
 	}
-	e += fprintf(output, "%hd %hd\n", BGR(colors->first), BGR(colors->last));
-	e += fprintf(output, "%u\n", colors->n);
+	colors->first = read_color(r);
+	colors->last = read_color(r);
+	colors->n = (unsigned)read_int(r);
 
-	if (fclose(output) == EOF || e < COLORS_FIELD_COUNT) {
-		return EOF;
+	if (!r->ok) {
+		colors_delete(colors);
+		return NULL;
 	}
-	return e;
+	return colors;
 }
 
-typedef int (*io_func_t)(Simulation *, FILE *);
-
-static int load_cells_n(Simulation *sim, FILE *input) {
-	unsigned i, j;
-	sim->grid->c = malloc(sim->grid->size * sizeof(byte *));
+Colors *load_colors(const char *filename)
+{
+	Colors *colors;
+	TextReader r;
+	size_t size;
+	char *data;
 
-	for (i = 0; i < sim->grid->size; i++) {
-		if (feof(input)) {
-			return EOF;
-		}
-		sim->grid->c[i] = malloc(sim->grid->size);
+	if (!(data = read_text_file(filename, TEXT_COLORS_MAX, &size))) {
+		return NULL;
+	}
+	r.p = data, r.end = data + size, r.ok = true;
+	colors = parse_colors(&r);
+	free(data);
+	return colors;
+}
 
-		for (j = 0; j < sim->grid->size; j++) {
-			byte c;
-			if (fscanf(input, (j < sim->grid->size-1) ? "%hhu " : "%hhu\n", &c) < 1) {
-				return EOF;
-			}
-			sim->grid->c[i][j] = BGR(c);
-		}
+typedef struct row_parser {
+	Grid           *grid;
+	const char    **rows;  /**< Start of each row, rows[size] is the end of the section */
+	unsigned        begin, end;
+	bool            ok;
+	atomic_word_t  *done;  /**< Rows parsed by all parsers */
+	atomic_word_t  *stop;  /**< Set once the load is cancelled */
+} RowParser;
+
+/* Counts a parsed row, reporting it if the loading thread takes reports */
+static bool row_parsed(RowParser *rp)
+{
+	long done = atomic_word_add(rp->done, 1) + 1;
+	if (!io_progress((uint64_t)done, rp->grid->size)) {
+		atomic_word_store(rp->stop, true);
 	}
-	return 0;
+	return !atomic_word_load(rp->stop);
 }
 
-static int save_cells_n(Simulation *sim, FILE *output)
+static void *parse_rows_n(void *arg)
 {
-	unsigned i, j;
-	for (i = 0; i < sim->grid->size; i++) {
-		for (j = 0; j < sim->grid->size; j++) {
-			byte c = BGR(sim->grid->c[i][j]);
-			if (fprintf(output, (j < sim->grid->size-1) ? "%hhu " : "%hhu\n", c) < 0) {
-				return EOF;
-			}
+	RowParser *rp = arg;
+	unsigned i, j, size = rp->grid->size;
+
+	for (i = rp->begin; i < rp->end && rp->ok; i++) {
+		TextReader r = { rp->rows[i], rp->rows[i+1], true };
+		byte *row = rp->grid->c[i];
+		for (j = 0; j < size; j++) {
+			long long c = read_int(&r);
+			row[j] = (byte)BGR((color_t)c);
+			r.ok &= (c >= 0 && c <= 0xFF);
 		}
+		rp->ok = r.ok && row_parsed(rp);
 	}
-	return 0;
+	return NULL;
 }
 
-static int load_cells_s(Simulation *sim, FILE *input) {
+static void *parse_rows_s(void *arg)
+{
+	RowParser *rp = arg;
 	SparseCell cell = { 0 }, *sc = &cell;
 	unsigned i;
-	sim->grid->csr = calloc(sim->grid->size, sizeof(SparseCell *));
 
-	for (i = 0; i < sim->grid->size; i++) {
+	for (i = rp->begin; i < rp->end && rp->ok; i++) {
+		TextReader r = { rp->rows[i], rp->rows[i+1], true };
 		SparseCell *p = NULL;
-		char c;
-
-		while (true) {
-			if (fscanf(input, "%c", &c) < 1) {
-				return EOF;
-			}
-			if (c == '\n' || (c == '\r' && fgetc(input) == '\n')) {
-				break;  // newline, end of row
-			}
-			if (fscanf(input, "%X", &cell.packed) < 1) {
-				return EOF;
-			}
 
+		for (skip_space(&r); r.p < r.end && r.ok; skip_space(&r)) {
+			cell.packed = read_hex(&r);
 			CSR_SET_COLOR(sc, BGR(CSR_GET_COLOR(sc)));
 			p = sparse_append(p, CSR_GET_COLUMN(sc), CSR_GET_COLOR(sc));
-			if (!sim->grid->csr[i]) {
-				sim->grid->csr[i] = p;
+			if (!rp->grid->csr[i]) {
+				rp->grid->csr[i] = p;
 			}
 		}
+		rp->ok = r.ok && row_parsed(rp);
 	}
-	return 0;
+	return NULL;
 }
 
-static int save_cells_s(Simulation *sim, FILE *output)
+/* Splits the cell section at row boundaries and parses the pieces in parallel */
+static bool parse_cells(Grid *grid, bool is_sparse, const char *p, const char *end)
 {
-	unsigned i;
-	for (i = 0; i < sim->grid->size; i++) {
-		SparseCell *curr = sim->grid->csr[i];
-		while (curr) {
-			SparseCell cell = *curr;
-			CSR_SET_COLOR(&cell, BGR(CSR_GET_COLOR(&cell)));
-
-			if (fprintf(output, " %08X", cell.packed) < 0) {
-				return EOF;
-			}
-			curr = curr->next;
+	RowParser parsers[THREAD_MAX_WORKERS];
+	thread_t threads[THREAD_MAX_WORKERS];
+	bool started[THREAD_MAX_WORKERS] = { false };
+	thread_func_t parse_rows = is_sparse ? parse_rows_s : parse_rows_n;
+	unsigned size = grid->size, count, i, k;
+	const char **rows;
+	atomic_word_t done = 0, stop = false;
+	bool ok = true;
+
+	if (!(rows = malloc((size+1) * sizeof(char *)))) {
+		return false;
+	}
+	for (i = 0; i < size; i++) {
+		const char *nl = memchr(p, '\n', (size_t)(end - p));
+		if (!nl && i == size-1) {
+			nl = end;  // Last row may end without a newline
 		}
-
-		if (fprintf(output, "\n") < 0) {
-			return EOF;
+		if (!nl) {
+			free(rows);
+			return false;
+		}
+		rows[i] = p;
+		p = (nl < end) ? nl+1 : end;
+	}
+	rows[size] = p;
+
+	count = ((size_t)(rows[size] - rows[0]) >= TEXT_PARALLEL_MIN) ? MIN(thread_count_hint(), size) : 1;
+	for (k = i = 0; k < count; k++) {
+		/* Give each parser about the same number of bytes */
+		const char *target = rows[0] + (size_t)(rows[size] - rows[0]) * (k+1) / count;
+		parsers[k].grid = grid, parsers[k].rows = rows, parsers[k].ok = true;
+		parsers[k].done = &done, parsers[k].stop = &stop;
+		parsers[k].begin = i;
+		for (; i < size && (rows[i] < target || k == count-1); i++);
+		parsers[k].end = i;
+		if (k > 0) {
+			started[k] = thread_create(&threads[k], parse_rows, &parsers[k]);
 		}
 	}
-	return 0;
+	for (k = 0; k < count; k++) {
+		if (!started[k]) {
+			parse_rows(&parsers[k]);  // First piece (or one a thread couldn't take) on this thread
+		}
+	}
+	for (k = 0; k < count; k++) {
+		if (started[k]) {
+			thread_join(threads[k]);
+		}
+		ok &= parsers[k].ok;
+	}
+	free(rows);
+	return ok;
 }
 
 Simulation *load_simulation(const char *filename)
 {
-	Simulation *sim;
+	Simulation *sim = NULL;
 	Colors *colors;
-	FILE *input;
-	byte is_sparse, def, skip;
-	io_func_t load_cells;
+	Grid *grid;
+	TextReader r;
+	size_t size;
+	char *data;
+	bool is_sparse;
+	unsigned i;
 
-	if (!(colors = load_colors(filename))) {
-		return NULL;
+	if (is_lant_binary(filename)) {
+		return load_simulation_binary(filename);
 	}
-	if (!(input = fopen(filename, "r"))) {
+	if (!(data = read_text_file(filename, SIZE_MAX - 1, &size))) {
 		return NULL;
 	}
-	for (skip = 0; skip < 5; skip += (getc(input) == '\n'));
+	r.p = data, r.end = data + size, r.ok = true;
+	if (!(colors = parse_colors(&r))) {
+		goto error_end;
+	}
 
 	sim = simulation_new(colors, GRID_DEF_INIT_SIZE);
-	if (fscanf(input, "%d %d %u\n", &sim->ant->pos.y, &sim->ant->pos.x,
-	           &sim->ant->dir) < 3) {
+	sim->ant->pos.y = (int)read_int(&r);
+	sim->ant->pos.x = (int)read_int(&r);
+	sim->ant->dir = (Direction)read_int(&r);
+	if (!r.ok) {
+		free(data);
 		return sim;  // Colors only
 	}
-	if (fscanf(input, "%u\n", &sim->steps) < 1) {
-		goto error_end;
-	}
-	if (fscanf(input, "%hhu\n", &is_sparse) < 1) {
-		goto error_end;
-	}
+	sim->steps = (unsigned)read_int(&r);
+	is_sparse = read_int(&r) != 0;
 
 	grid_delete(sim->grid);  // Replace default grid with loaded data
-	sim->grid = malloc(sizeof(Grid));
-	sim->grid->c = NULL;
-	sim->grid->tmp = NULL;
-	sim->grid->tmp_size = 0;
-	sim->grid->csr = NULL;
-	if (fscanf(input, "%hhu %u %u %u\n", &def,
-	           &sim->grid->init_size, &sim->grid->size, &sim->grid->colored) < 4) {
+	if (!(sim->grid = grid = calloc(1, sizeof(Grid)))) {
+		sim->grid = grid_new(colors, GRID_DEF_INIT_SIZE);
 		goto error_end;
 	}
-	sim->grid->def_color = BGR(def);
-	if (fscanf(input, "%d %d %d %d", &sim->grid->top_left.y, &sim->grid->top_left.x,
-	           &sim->grid->bottom_right.y, &sim->grid->bottom_right.x) < 4) {
-		goto error_end;
-	}
-	if (fgetc(input) == '\r' && fgetc(input) != '\n') {  // Read trailing newline
+	grid->def_color = read_color(&r);
+	grid->init_size = (unsigned)read_int(&r);
+	grid->size = (unsigned)read_int(&r);
+	grid->colored = (unsigned)read_int(&r);
+	grid->top_left.y = (int)read_int(&r);
+	grid->top_left.x = (int)read_int(&r);
+	grid->bottom_right.y = (int)read_int(&r);
+	grid->bottom_right.x = (int)read_int(&r);
+	while (r.p < r.end && (*r.p == ' ' || *r.p == '\t' || *r.p == '\r')) {
+		r.p++;
+	}
+	if (!r.ok || !grid->size || r.p == r.end || *r.p++ != '\n') {  // Read trailing newline
 		goto error_end;
 	}
 
-	load_cells = is_sparse ? load_cells_s : load_cells_n;
-	if (load_cells(sim, input) == EOF) {
+	if (is_sparse) {
+		grid->csr = calloc(grid->size, sizeof(SparseCell *));
+	} else if ((grid->block = malloc((size_t)grid->size * grid->size))) {
+		grid->block_size = (size_t)grid->size * grid->size;
+		if ((grid->c = malloc(grid->size * sizeof(byte *)))) {
+			for (i = 0; i < grid->size; i++) {
+				grid->c[i] = grid->block + (size_t)i*grid->size;
+			}
+		}
+	}
+	if ((!grid->csr && !grid->c) || !parse_cells(grid, is_sparse, r.p, r.end)) {
 		goto error_end;
 	}
 
-	fclose(input);
+	free(data);
 	return sim;
 
 error_end:
-	fclose(input);
-	simulation_delete(sim);
+	free(data);
+	if (sim) {
+		if (!sim->grid->c && !sim->grid->csr) {
+			sim->grid->size = 0;  // No rows to free, only the block
+		}
+		simulation_delete(sim);
+	}
 	return NULL;
 }
 
-int save_simulation(const char *filename, Simulation *sim)
-{
-	FILE *output;
-	io_func_t save_cells;
+/*--------------------------------- Writing ----------------------------------*/
 
-	if (save_colors(filename, sim->colors) == EOF) {
-		return EOF;
+typedef struct text_writer {
+	FILE    *output;
+	char    *buf;
+	size_t   n;
+	bool     ok;
+} TextWriter;
+
+static bool writer_open(TextWriter *w, const char *filename)
+{
+	w->n = 0;
+	w->ok = true;
+	if (!(w->buf = malloc(TEXT_BLOCK_SZ))) {
+		return false;
 	}
-	if (!(output = fopen(filename, "a"))) {
-		return EOF;
+	if (!(w->output = fopen(filename, "w"))) {
+		free(w->buf);
+		return false;
 	}
+	return true;
+}
 
-	if (fprintf(output, "%d %d %u\n", sim->ant->pos.y, sim->ant->pos.x,
-	            sim->ant->dir) < 0) {
-		goto error_end;
-	}
-	if (fprintf(output, "%u\n", sim->steps) < 0) {
-		goto error_end;
+static void writer_flush(TextWriter *w)
+{
+	if (w->n && fwrite(w->buf, 1, w->n, w->output) < w->n) {
+		w->ok = false;
 	}
-	if (fprintf(output, "%hhu\n", is_grid_sparse(sim->grid)) < 0) {
-		goto error_end;
+	w->n = 0;
+}
+
+static int writer_close(TextWriter *w)
+{
+	writer_flush(w);
+	w->ok &= (fclose(w->output) != EOF);
+	free(w->buf);
+	return w->ok ? 0 : EOF;
+}
+
+/* Longest token (a sign and 20 digits) plus separator always fits after this */
+static inline void reserve(TextWriter *w)
+{
+	if (w->n > TEXT_BLOCK_SZ - 32) {
+		writer_flush(w);
 	}
-	if (fprintf(output, "%hhu %u %u %u\n", BGR(sim->grid->def_color),
-	            sim->grid->init_size, sim->grid->size, sim->grid->colored) < 0) {
-		goto error_end;
+}
+
+static void put_int(TextWriter *w, long long value, char sep)
+{
+	char digits[24];
+	unsigned long long u = (value < 0) ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+	int k = 0;
+
+	reserve(w);
+	if (value < 0) {
+		w->buf[w->n++] = '-';
 	}
-	if (fprintf(output, "%d %d %d %d\n", sim->grid->top_left.y, sim->grid->top_left.x,
-	            sim->grid->bottom_right.y, sim->grid->bottom_right.x) < 0) {
-		goto error_end;
+	do {
+		digits[k++] = (char)('0' + u%10);
+	} while (u /= 10);
+	while (k) {
+		w->buf[w->n++] = digits[--k];
 	}
+	w->buf[w->n++] = sep;
+}
 
-	save_cells = is_grid_sparse(sim->grid) ? save_cells_s : save_cells_n;
-	if (save_cells(sim, output) == EOF) {
-		goto error_end;
+static void put_hex(TextWriter *w, unsigned value)
+{
+	static const char hex[] = "0123456789ABCDEF";
+	int k;
+
+	reserve(w);
+	w->buf[w->n++] = ' ';
+	for (k = 28; k >= 0; k -= 4) {
+		w->buf[w->n++] = hex[value>>k & 0xF];
 	}
+}
 
-	return fclose(output);
+static void write_colors(TextWriter *w, Colors *colors)
+{
+	color_t i;
 
-error_end:
-	fclose(output);
-	return EOF;
+	put_int(w, BGR(colors->def), '\n');
+	for (i = 0; i < COLOR_COUNT; i++) {
+		put_int(w, BGR(colors->next[BGR(i)]), (i < COLOR_COUNT-1) ? ' ' : '\n');
+	}
+	for (i = 0; i < COLOR_COUNT; i++) {
+		put_int(w, colors->turn[BGR(i)], (i < COLOR_COUNT-1) ? ' ' : '\n');
+	}
+	put_int(w, BGR(colors->first), ' ');
+	put_int(w, BGR(colors->last), '\n');
+	put_int(w, colors->n, '\n');
 }
 
-int save_grid_bitmap(const char *filename, Grid *grid)
+int save_colors(const char *filename, Colors *colors)
 {
-	pixel_t *image;
-	unsigned height = grid->size, width = grid->size, i, j;
-	size_t size = width * height * sizeof(pixel_t);
+	TextWriter w;
 
-	if (size > BMP_MAX_SZ || !(image = malloc(size))) {
+	if (!writer_open(&w, filename)) {
 		return EOF;
 	}
+	write_colors(&w, colors);
+	return (writer_close(&w) == EOF) ? EOF : COLORS_FIELD_COUNT;
+}
+
+static void write_cells_n(TextWriter *w, Grid *grid)
+{
+	unsigned i, j;
+	for (i = 0; i < grid->size && (w->ok &= io_progress(i, grid->size)); i++) {
+		for (j = 0; j < grid->size; j++) {
+			put_int(w, BGR(grid->c[i][j]), (j < grid->size-1) ? ' ' : '\n');
+		}
+	}
+}
 
-	for (i = 0; i < height; i++) {
-		for (j = 0; j < width; j++) {
-			Vector2i pos = (Vector2i) { height-i-1, j };
-			const pixel_t *pixel = color_map + GRID_COLOR_AT(grid, pos);
-			memcpy(image[i*width + j], pixel, sizeof(pixel_t));
+static void write_cells_s(TextWriter *w, Grid *grid)
+{
+	unsigned i;
+	for (i = 0; i < grid->size && (w->ok &= io_progress(i, grid->size)); i++) {
+		SparseCell *curr;
+		for (curr = grid->csr[i]; curr; curr = curr->next) {
+			SparseCell cell = *curr;
+			CSR_SET_COLOR(&cell, BGR(CSR_GET_COLOR(&cell)));
+			put_hex(w, cell.packed);
 		}
+		reserve(w);
+		w->buf[w->n++] = '\n';
 	}
+}
 
-	int e = create_bitmap_file(filename, image, height, width);
-	free(image);
-	return e;
+int save_simulation(const char *filename, Simulation *sim)
+{
+	return save_simulation_binary(filename, sim);
+}
+
+int save_simulation_text(const char *filename, Simulation *sim)
+{
+	Grid *grid = sim->grid;
+	TextWriter w;
+
+	if (!writer_open(&w, filename)) {
+		return EOF;
+	}
+	write_colors(&w, sim->colors);
+	put_int(&w, sim->ant->pos.y, ' ');
+	put_int(&w, sim->ant->pos.x, ' ');
+	put_int(&w, sim->ant->dir, '\n');
+	put_int(&w, sim->steps, '\n');
+	put_int(&w, is_grid_sparse(grid), '\n');
+	put_int(&w, BGR(grid->def_color), ' ');
+	put_int(&w, grid->init_size, ' ');
+	put_int(&w, grid->size, ' ');
+	put_int(&w, grid->colored, '\n');
+	put_int(&w, grid->top_left.y, ' ');
+	put_int(&w, grid->top_left.x, ' ');
+	put_int(&w, grid->bottom_right.y, ' ');
+	put_int(&w, grid->bottom_right.x, '\n');
+
+	if (is_grid_sparse(grid)) {
+		write_cells_s(&w, grid);
+	} else {
+		write_cells_n(&w, grid);
+	}
+	return writer_close(&w);
+}
+
+int replace_file(const char *src, const char *dst)
+{
+#ifdef _WIN32
+	return MoveFileExA(src, dst, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ? 0 : EOF;
+#else
+	return rename(src, dst) ? EOF : 0;  // Atomic on POSIX
+#endif
+}
+
+int file_seek(FILE *file, uint64_t offset)
+{
+#ifdef _WIN32
+	return _fseeki64(file, (__int64)offset, SEEK_SET) ? EOF : 0;  // long is 32-bit on Windows
+#else
+	return fseeko(file, (off_t)offset, SEEK_SET) ? EOF : 0;
+#endif
+}
+
+long long file_size(FILE *file)
+{
+#ifdef _WIN32
+	return _fseeki64(file, 0, SEEK_END) ? -1 : (long long)_ftelli64(file);
+#else
+	return fseeko(file, 0, SEEK_END) ? -1 : (long long)ftello(file);
+#endif
+}
+
+static void read_grid_row(void *source, unsigned y, byte *row)
+{
+	Grid *grid = source;
+	grid_read_row(grid, (int)y, 0, grid->size, row);
+}
+
+int save_grid_bitmap(const char *filename, Grid *grid)
+{
+	return create_bitmap_file(filename, grid->size, grid->size, read_grid_row, grid);
 }
@@ -7,6 +7,8 @@
 #define __IO_H__
 
 #include "logic.h"
+#include <stdint.h>
+#include <stdio.h>
 #ifndef IO_NO_CURSES
 #	include "curses.h"
 #endif
@@ -20,16 +22,43 @@
 /** Total number of fields in a Colors struct */
 #define COLORS_FIELD_COUNT  (COLOR_COUNT*2 + 4)
 
+/** @name Text (v1) format buffering */
+///@{
+#define TEXT_BLOCK_SZ       (size_t)(1U << 20)  /**< Output is flushed in blocks of this size */
+#define TEXT_PARALLEL_MIN   (size_t)(1U << 18)  /**< Cell sections at least this long are parsed on threads */
+#define TEXT_COLORS_MAX     (size_t)1024U       /**< Longest colors header read by load_colors */
+///@}
+
+/**
+ * Receives the progress of a load or save, on the thread doing it
+ * @param arg Argument given to io_set_progress
+ * @param done Rows processed so far
+ * @param total Rows overall
+ * @return Keep going? The load or save fails if not
+ */
+typedef bool (*io_progress_func_t)(void *arg, uint64_t done, uint64_t total);
+
 
 /*----------------------- Bitmap I/O macros and types ------------------------*/
 
 /** @name Bitmap attributes */
 ///@{
-#define BMP_MAX_SZ          (size_t)(1U << 28)
+#define BMP_MAX_FILE_SZ     0xFFFFFFFFULL
 #define BMP_FILE_HEADER_SZ  (size_t)14U
 #define BMP_INFO_HEADER_SZ  (size_t)40U
+#define BMP_PALETTE_SZ      (size_t)(COLOR_COUNT * 4U)
+#define BMP_BITS_PER_PIXEL  4U  /**< Palettized, one nibble per cell */
+#define BMP_STRIDE(w)       (((size_t)(w) * BMP_BITS_PER_PIXEL + 31) / 32 * 4)
 ///@}
 
+/**
+ * Supplies one image row of palette indices (colors), top to bottom
+ * @param source Image source passed to the writer
+ * @param y Row index
+ * @param row Filled in with width indices
+ */
+typedef void (*bitmap_row_func_t)(void *source, unsigned y, byte *row);
+
 /** Pixel format size */
 #define BYTES_PER_PIXEL     (size_t)3U
 
@@ -56,6 +85,244 @@ typedef byte  pixel_t[BYTES_PER_PIXEL];
 extern const pixel_t  color_map[COLOR_COUNT];
 
 
+/*-------------------------- PNG export attributes ---------------------------*/
+
+/** @name PNG attributes */
+///@{
+#define PNG_MAX_SIDE    0x7FFFFFFFULL  /**< Largest width or height allowed by the format */
+#define PNG_BAND_BYTES  (1U << 20)     /**< Raw image data compressed by one worker at a time */
+///@}
+
+
+/*------------------------ Tiled pyramid attributes --------------------------*/
+
+/** @name Pyramid attributes */
+///@{
+#define PYRAMID_TILE_SIZE  256U  /**< Side of a (full) tile in pixels */
+#define PYRAMID_QUEUE_LEN  32U   /**< Tiles waiting to be encoded before the reader blocks */
+///@}
+
+
+/*-------------------- Binary snapshot (v2) macros and types -----------------*/
+
+/** @name Binary snapshot attributes */
+///@{
+#define LANT_MAGIC       "LANT"
+#define LANT_MAGIC_SZ    (size_t)4U
+#define LANT_VERSION     2U
+#define LANT_BYTE_ORDER  0x01020304U  /**< Files from other-endian machines are rejected */
+#define LANT_DATA_ALIGN  4096U        /**< Cell data offset alignment (page size) */
+///@}
+
+/** Cell data layout following the header */
+typedef enum {
+	LANT_DENSE,   /**< size*size bytes, row after row */
+	LANT_SPARSE,  /**< size+1 uint64 row offsets, then uint32 packed cells */
+	LANT_PACKED,       /**< Varint-coded spans of colored cells, see @ref LANT_RUN_MIN */
+	LANT_PACKED_DENSE  /**< Same as LANT_PACKED, loaded into a dense grid */
+} LantRepresentation;
+
+/**
+ * @name Packed sparse encoding
+ * Every non-empty row is stored as varints: the number of rows skipped since
+ * the previous one, its span count, then its spans. A span is the gap to its
+ * first column (from the end of the previous span, or a zigzag-coded offset
+ * from the first column of the previous row for the first span) followed by a head:
+ * (len-1)<<5 | color<<1 for a run of one color, or (len-1)<<1 | 1 for a
+ * literal of adjacent cells followed by their colors, two nibbles per byte
+ */
+///@{
+#define LANT_RUN_MIN      3U  /**< Shortest run of one color not kept in a literal */
+#define LANT_VARINT_MAX   5U  /**< Bytes taken by the largest 32-bit varint */
+///@}
+
+/**
+ * Fixed-size header of a binary snapshot, stored in native byte order
+ * Colors are stored in the same order as in text files (see @ref BGR(c)), cells
+ * in the writer's native order as flagged by cells_bgr
+ */
+typedef struct lant_header {
+	char      magic[LANT_MAGIC_SZ];
+	uint16_t  version, header_size;
+	uint32_t  byte_order;
+	uint8_t   next[COLOR_COUNT];
+	int8_t    turn[COLOR_COUNT];
+	uint8_t   first, last, def, cells_bgr;
+	uint32_t  n;
+	int32_t   ant_y, ant_x;
+	uint32_t  ant_dir, steps;
+	uint8_t   representation, def_color, reserved[2];
+	uint32_t  init_size, size, colored;
+	int32_t   top_left_y, top_left_x, bottom_right_y, bottom_right_x;
+	uint32_t  reserved2;
+	uint64_t  data_offset, data_size;
+} LantHeader;
+
+/** Binary snapshot compiled into the executable */
+typedef struct embedded_file {
+	const char  *name;  /**< Path of the file it was generated from */
+	const byte  *data;
+	size_t       size;
+} EmbeddedFile;
+
+/** Bundled examples, generated by scripts/embed_examples.py */
+extern const EmbeddedFile  embedded_examples[];
+extern const size_t        embedded_example_count;
+
+
+/*---------------- Background load and save macros and types -----------------*/
+
+/** Job progress is reported in thousandths */
+#define JOB_PROGRESS_MAX  1000U
+
+/** State of a background load or save */
+typedef enum {
+	JOB_RUNNING,
+	JOB_DONE,
+	JOB_FAILED,
+	JOB_CANCELLED
+} JobResult;
+
+/** Save running in a child process or worker thread (opaque) */
+typedef struct save_job  SaveJob;
+
+/** Load running in a worker thread (opaque) */
+typedef struct load_job  LoadJob;
+
+/** @name Jobs started from the menu (NULL if none is running) */
+///@{
+extern SaveJob  *active_save;
+extern LoadJob  *active_load;
+///@}
+
+
+/*------------------------- Prefetch macros and types ------------------------*/
+
+/** @name Prefetch attributes, can be set at compile time */
+///@{
+#ifndef PREFETCH_STEPS
+#	define PREFETCH_STEPS       0U                     /**< Steps a standby simulation is run ahead */
+#endif
+#ifndef PREFETCH_BUDGET
+#	define PREFETCH_BUDGET      ((size_t)256U << 20)   /**< Grid memory a standby simulation may use */
+#endif
+#define PREFETCH_CHECK_STEPS    4096U                  /**< Steps run between checks for a stop */
+///@}
+
+/** Simulation being loaded ahead of time into a standby slot (opaque) */
+typedef struct prefetch  Prefetch;
+
+
+/*------------------------ Recorder macros and types -------------------------*/
+
+/** @name Recorder attributes */
+///@{
+#define RECORDER_FRAME_SIZE  1080U  /**< Output frame width and height in pixels */
+#define RECORDER_QUEUE_LEN   8U     /**< Max captured frames waiting to be written */
+#define RECORDER_DEF_FPS     30U    /**< Frame rate if none is given */
+///@}
+
+/** Output stream formats, chosen by file extension */
+typedef enum {
+	REC_FORMAT_PPM,  /**< Concatenated binary PPM (P6) frames */
+	REC_FORMAT_Y4M   /**< YUV4MPEG2, 4:4:4 */
+} RecordFormat;
+
+/** Which part of the grid is recorded */
+typedef enum {
+	REC_REGION_VIEWPORT,     /**< Area currently shown in the grid window */
+	REC_REGION_BOUNDING_BOX  /**< Area colored so far, scaled to fit */
+} RecordRegion;
+
+/** What happens to a captured frame when the queue is full */
+typedef enum {
+	REC_POLICY_DROP,  /**< Discard the frame, never stall the simulation */
+	REC_POLICY_BLOCK  /**< Wait for the writer (back-pressure) */
+} RecordPolicy;
+
+/** Background frame recorder (opaque) */
+typedef struct recorder  Recorder;
+
+/** Recorder fed by the main loop (NULL if not recording) */
+extern Recorder  *active_recorder;
+
+
+/*----------------------- Checkpoint macros and types ------------------------*/
+
+/** @name Checkpoint attributes */
+///@{
+#define CHECKPOINT_MAGIC           "LJRN"
+#define CHECKPOINT_MAGIC_SZ        (size_t)4U
+#define CHECKPOINT_VERSION         2U
+#define CHECKPOINT_TILE_SHIFT      6U                            /**< Changes are journaled in tiles of 64x64 cells */
+#define CHECKPOINT_TILE_SIDE       (1U << CHECKPOINT_TILE_SHIFT)
+#define CHECKPOINT_JOURNAL_US      1000000LL                     /**< Time between journal records */
+#define CHECKPOINT_SNAPSHOT_US     (5 * 60 * 1000000LL)          /**< Time between full snapshots... */
+#define CHECKPOINT_JOURNAL_SZ      ((size_t)256U << 20)          /**< ...or bytes journaled since, whichever comes first */
+///@}
+
+/** Checkpoint of the simulation in the main loop (NULL if not checkpointing) */
+extern Checkpoint  *active_checkpoint;
+
+
+/*------------------- Shared memory export macros and types ------------------*/
+
+/** @name Shared memory export attributes */
+///@{
+#define SHM_MAGIC          "LSHM"
+#define SHM_MAGIC_SZ       (size_t)4U
+#define SHM_VERSION        1U                               /**< Bumped when the header below changes */
+#define SHM_BYTE_ORDER     0x01020304U                      /**< As written by the simulator */
+#define SHM_MAX_SIDE       2048U                            /**< Side of the largest window exported */
+#define SHM_CAPACITY       (SHM_MAX_SIDE * SHM_MAX_SIDE)    /**< Cells the segment has room for */
+#define SHM_FEED_CAPACITY  65536U                           /**< Cell changes buffered between updates */
+///@}
+
+/**
+ * Header at the start of the shared memory segment, followed by the cells
+ *
+ * The cells are the middle window_side x window_side square of the grid, row
+ * by row, one color (index into palette) per byte. The segment is sized for
+ * SHM_CAPACITY cells up front, so readers map it once and never remap.
+ *
+ * Seqlock: the simulator makes seq odd before it writes anything and even
+ * again after. A reader loads seq, waits while it's odd, reads what it needs
+ * straight from the mapping, then loads seq again and discards what it read
+ * if seq changed. Coordinates are relative to the grid center, y down, x right.
+ */
+typedef struct shm_header {
+	char      magic[SHM_MAGIC_SZ];
+	uint32_t  version;             /**< SHM_VERSION */
+	uint32_t  header_size;         /**< Offset of the cells from the start of the segment */
+	uint32_t  byte_order;          /**< SHM_BYTE_ORDER, in the simulator's byte order */
+	uint64_t  seq;                 /**< Seqlock counter, odd while the simulator is writing */
+	uint64_t  generation;          /**< Updates completed so far */
+	uint32_t  layout;              /**< Bumped when the grid is expanded, made sparse or replaced */
+	uint32_t  live;                /**< Cleared once the simulator stops exporting */
+	uint32_t  capacity;            /**< SHM_CAPACITY */
+	uint32_t  steps;
+	int32_t   ant_y, ant_x;
+	uint32_t  ant_dir;             /**< 0 up, 1 right, 2 down, 3 left */
+	uint32_t  running;
+	uint32_t  grid_size;
+	uint32_t  sparse;
+	uint32_t  colored;             /**< Cells colored so far, in the whole grid */
+	int32_t   top, left;           /**< Bounding box of the colored cells, inclusive */
+	int32_t   bottom, right;
+	int32_t   window_y, window_x;  /**< First cell of the window */
+	uint32_t  window_side;
+	uint32_t  def_color;           /**< Color of cells never stepped on */
+	byte      palette[COLOR_COUNT][3];  /**< RGB */
+	byte      reserved[20];        /**< Pads the header to 176 bytes */
+} ShmHeader;
+
+/** Grid exported to a shared memory segment (opaque) */
+typedef struct shm_export  ShmExport;
+
+/** Export updated by the main loop (NULL if not exporting) */
+extern ShmExport  *active_shm_export;
+
+
 /*----------------------------------------------------------------------------*
  *                                    io.c                                    *
  *----------------------------------------------------------------------------*/
@@ -86,35 +353,411 @@ int save_colors(const char *filename, Colors *colors);
 Simulation *load_simulation(const char *filename);
 
 /**
- * Write simulation state to a .lant file
+ * Write simulation state to a .lant file in the binary snapshot format
  * @param filename Destination .lant file path
  * @param simulation Simulation to be written
- * @return Number of written fields if successful; EOF otherwise
+ * @return 0 if successful; EOF otherwise
  * @see load_simulation(const char *)
+ * @see save_simulation_binary(const char *, Simulation *)
  */
 int save_simulation(const char *filename, Simulation *sim);
 
+/**
+ * Write simulation state to a .lant file in the (v1) text format
+ * @param filename Destination .lant file path
+ * @param simulation Simulation to be written
+ * @return 0 if successful; EOF otherwise
+ * @see load_simulation(const char *)
+ */
+int save_simulation_text(const char *filename, Simulation *sim);
+
+/**
+ * Replace a file with another, atomically where the platform allows it
+ * @param src Path of the new file, usually a temporary one
+ * @param dst Path of the file to be replaced
+ * @return 0 if successful; EOF otherwise
+ */
+int replace_file(const char *src, const char *dst);
+
+/**
+ * Seek to an absolute offset, past 2 GB even where long is 32-bit
+ * @param file Stream to be positioned
+ * @param offset Offset from the start of the file
+ * @return 0 if successful; EOF otherwise
+ */
+int file_seek(FILE *file, uint64_t offset);
+
+/**
+ * Get the size of a file, past 2 GB even where long is 32-bit
+ * Leaves the stream positioned at the end
+ * @param file Stream to be measured
+ * @return File size if successful; -1 otherwise
+ */
+long long file_size(FILE *file);
+
 /**
  * Save simulation grid as bitmap image
  * @param filename Destination .bmp file path
  * @param grid Grid to be written
  * @return Bitmap size if successful; EOF otherwise
- * @see create_bitmap_file(const char *, pixel_t *, size_t, size_t)
+ * @see create_bitmap_file(const char *, size_t, size_t, bitmap_row_func_t, void *)
  */
 int save_grid_bitmap(const char *filename, Grid *grid);
 
+/**
+ * Routes progress reports of loads and saves done by the calling thread
+ * @param func Receives the reports, NULL to stop them
+ * @param arg Argument passed to func
+ * @see io_progress(uint64_t, uint64_t)
+ */
+void io_set_progress(io_progress_func_t func, void *arg);
+
+/**
+ * Reports progress of a load or save to the calling thread's receiver, if any
+ * @param done Rows processed so far
+ * @param total Rows overall
+ * @return Keep going? Always true without a receiver
+ * @see io_set_progress(io_progress_func_t, void *)
+ */
+bool io_progress(uint64_t done, uint64_t total);
+
+
+/*----------------------------------------------------------------------------*
+ *                                binary_io.c                                 *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Checks if a file starts with the binary snapshot magic
+ * @param filename .lant file path
+ * @return Is the file a binary snapshot?
+ */
+bool is_lant_binary(const char *filename);
+
+/**
+ * Read a binary snapshot; dense cells are mapped into memory instead of copied
+ * where supported, and only paged in as they are touched
+ * @param filename Source .lant file path
+ * @return Pointer to a Simulation struct if successful; NULL otherwise
+ * @see save_simulation_binary(const char *, Simulation *)
+ */
+Simulation *load_simulation_binary(const char *filename);
+
+/**
+ * Read a binary snapshot held in memory, such as an embedded example
+ * Cells are copied out, so the data may be read-only and needn't outlive the simulation
+ * @param data Start of the snapshot
+ * @param size Snapshot size in bytes
+ * @return Pointer to a Simulation struct if successful; NULL otherwise
+ * @see embedded_examples
+ */
+Simulation *load_simulation_memory(const byte *data, size_t size);
+
+/**
+ * Write a binary snapshot via a temporary file that replaces the destination
+ * only once fully written
+ * @param filename Destination .lant file path
+ * @param sim Simulation to be written
+ * @return 0 if successful; EOF otherwise
+ * @see load_simulation_binary(const char *)
+ */
+int save_simulation_binary(const char *filename, Simulation *sim);
+
 
 /*----------------------------------------------------------------------------*
  *                                bitmap_io.c                                 *
  *----------------------------------------------------------------------------*/
 
 /**
- * Create bitmap file from image byte array
+ * Create 4-bit palettized bitmap file, streaming it one row at a time
+ * The palette is built from @ref color_map, so rows hold internal colors
  * @param filename Destination .bmp file path
- * @param image Byte array in 24-bit BGR format
  * @param height Image height
  * @param width Image width
+ * @param read_row Called once for each row, bottom to top
+ * @param source Passed to read_row
+ * @return Bitmap size (capped to INT_MAX) if successful; EOF otherwise
+ */
+int create_bitmap_file(const char *filename, size_t height, size_t width,
+                       bitmap_row_func_t read_row, void *source);
+
+
+/*----------------------------------------------------------------------------*
+ *                                  png_io.c                                  *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Save the colored part of the grid as a 4-bit indexed PNG image
+ * Rows are filtered and compressed in bands on worker threads, using a
+ * built-in deflate (fixed Huffman, or stored if incompressible)
+ * @param filename Destination .png file path
+ * @param grid Grid to be written, cropped to its bounding box
+ * @param scale Side of the square of pixels drawn for each cell (1 or more)
+ * @return 0 if successful; EOF otherwise
+ */
+int save_grid_png(const char *filename, Grid *grid, unsigned scale);
+
+
+/*----------------------------------------------------------------------------*
+ *                                pyramid_io.c                                *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Save the colored part of the grid as a Deep Zoom image pyramid
+ * Writes the manifest and a "<name>_files/<level>/<col>_<row>.bmp" tile tree,
+ * halving each level into the one above (colored cells win over the default)
+ * The grid is read once, holding only one strip of tiles per level in memory
+ * @param filename Destination .dzi manifest path
+ * @param grid Grid to be written, cropped to its bounding box
+ * @return 0 if successful; EOF otherwise
+ */
+int save_grid_pyramid(const char *filename, Grid *grid);
+
+
+/*----------------------------------------------------------------------------*
+ *                                 save_job.c                                 *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Starts saving a simulation (and optionally its bitmap) in the background
+ * The simulation is snapshotted by forking where possible, or copied for a worker
+ * thread otherwise, so it can keep running while the files are written
+ * @param filename Destination .lant file path, ".bmp" is appended for the bitmap
+ * @param sim Simulation to be written
+ * @param text Write the (v1) text format instead of a binary snapshot?
+ * @param bitmap Also write the grid as a bitmap?
+ * @return Pointer to a SaveJob if started; NULL otherwise
+ * @see save_job_poll(SaveJob *)
+ */
+SaveJob *save_job_start(const char *filename, Simulation *sim, bool text, bool bitmap);
+
+/**
+ * Checks if a background save has finished, without blocking
+ * @param job Save to check, freed once it has finished
+ * @return JOB_RUNNING, or the result if finished
+ * @see save_job_wait(SaveJob *)
+ */
+JobResult save_job_poll(SaveJob *job);
+
+/**
+ * Waits for a background save to finish
+ * @param job Save to wait for, freed afterwards
+ * @return JOB_DONE, JOB_FAILED or JOB_CANCELLED
+ * @see save_job_poll(SaveJob *)
+ */
+JobResult save_job_wait(SaveJob *job);
+
+/**
+ * Asks a background save to stop, leaving the destination as it was
+ * A save past writing the .lant file finishes regardless, without the bitmap
+ * @param job Save to cancel, still to be polled or waited for
+ */
+void save_job_cancel(SaveJob *job);
+
+/**
+ * Finds how far along a background save is
+ * @param job Save to check
+ * @return Thousandths of the work done, up to JOB_PROGRESS_MAX
+ */
+unsigned save_job_progress(SaveJob *job);
+
+/**
+ * Starts loading a simulation from file on a worker thread
+ * @param filename Source .lant file path
+ * @return Pointer to a LoadJob if started; NULL otherwise
+ * @see load_job_poll(LoadJob *, Simulation **)
+ */
+LoadJob *load_job_start(const char *filename);
+
+/**
+ * Checks if a background load has finished, without blocking
+ * @param job Load to check, freed once it has finished
+ * @param sim Filled in with the loaded simulation if done, which the caller then owns
+ * @return JOB_RUNNING, or the result if finished
+ * @see load_job_wait(LoadJob *, Simulation **)
+ */
+JobResult load_job_poll(LoadJob *job, Simulation **sim);
+
+/**
+ * Waits for a background load to finish
+ * @param job Load to wait for, freed afterwards
+ * @param sim Filled in with the loaded simulation if done, which the caller then owns
+ * @return JOB_DONE, JOB_FAILED or JOB_CANCELLED
+ * @see load_job_poll(LoadJob *, Simulation **)
+ */
+JobResult load_job_wait(LoadJob *job, Simulation **sim);
+
+/**
+ * Asks a background load to stop, discarding whatever it has read
+ * @param job Load to cancel, still to be polled or waited for
+ */
+void load_job_cancel(LoadJob *job);
+
+/**
+ * Finds how far along a background load is
+ * @param job Load to check
+ * @return Thousandths of the work done, up to JOB_PROGRESS_MAX
+ */
+unsigned load_job_progress(LoadJob *job);
+
+
+/*----------------------------------------------------------------------------*
+ *                                 prefetch.c                                 *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Starts loading a simulation into a standby slot on a worker thread
+ * Once loaded, it's run ahead by the given number of steps. A simulation whose grid
+ * outgrows the budget, while loading or running ahead, is dropped
+ * @param filename Source .lant file path, read unless a snapshot is given
+ * @param file Embedded snapshot to build it from; NULL to read the file
+ * @param steps Steps to run it ahead by
+ * @param budget Most grid memory the standby simulation may use (bytes)
+ * @return Pointer to a Prefetch if started; NULL otherwise
+ * @see prefetch_take(Prefetch *)
+ */
+Prefetch *prefetch_start(const char *filename, const EmbeddedFile *file, unsigned steps, size_t budget);
+
+/**
+ * Takes the standby simulation, cutting short running it ahead
+ * Waits if it's still loading, which never takes longer than loading it anew
+ * @param pf Prefetch to take from, freed afterwards
+ * @return Pointer to the simulation, which the caller then owns; NULL if it failed or was dropped
+ * @see prefetch_discard(Prefetch *)
+ */
+Simulation *prefetch_take(Prefetch *pf);
+
+/**
+ * Stops a prefetch and frees its standby simulation
+ * @param pf Prefetch to discard, freed afterwards
+ * @see prefetch_take(Prefetch *)
+ */
+void prefetch_discard(Prefetch *pf);
+
+
+/*----------------------------------------------------------------------------*
+ *                                 recorder.c                                 *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Starts recording frames on a background writer thread
+ * @param target Destination file path (.y4m for Y4M, PPM otherwise), "-" for stdout
+ *        or "|command" to pipe into a command
+ * @param region Part of the grid to be recorded
+ * @param every Capture a frame every this many steps (blocks when queue is full);
+ *        0 to capture at a fixed frame rate instead (drops when queue is full)
+ * @param fps Frame rate for capturing and for the Y4M header (0 for default)
+ * @return Pointer to a Recorder if successful; NULL otherwise
+ * @see recorder_close(Recorder *)
+ */
+Recorder *recorder_open(const char *target, RecordRegion region, unsigned every, unsigned fps);
+
+/**
+ * Writes out all queued frames and stops recording
+ * @param rec Recorder to be closed
+ * @return 0 if all frames were written; EOF otherwise
+ * @see recorder_open(const char *, RecordRegion, unsigned, unsigned)
+ */
+int recorder_close(Recorder *rec);
+
+/**
+ * Checks if a frame should be captured now
+ * @param rec Recorder
+ * @param steps Current simulation step count
+ * @param now_us Current time in microseconds
+ * @return Is a frame due?
+ */
+bool recorder_due(Recorder *rec, unsigned steps, long long now_us);
+
+/**
+ * Snapshots the recorded region and queues it for the writer
+ * @param rec Recorder
+ * @param sim Simulation to be captured
+ * @param view_top_left Origin of the visible area, in grid coordinates
+ * @param view_side Size of the visible area, in cells
+ * @param now_us Current time in microseconds
+ * @return Was the frame queued?
+ */
+bool recorder_capture(Recorder *rec, Simulation *sim, Vector2i view_top_left, unsigned view_side,
+                      long long now_us);
+
+/**
+ * Finds the number of frames dropped because the writer fell behind, or a region was too large to sample
+ * @param rec Recorder
+ * @return Number of dropped frames
+ */
+unsigned long recorder_dropped(Recorder *rec);
+
+
+/*----------------------------------------------------------------------------*
+ *                                checkpoint.c                                *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Starts checkpointing a simulation: writes a full snapshot right away, then
+ * journals changed tiles and the ant's state on a background writer thread
+ * @param filename Snapshot .lant file path, journals are kept next to it
+ * @param sim Simulation to be checkpointed
+ * @return Pointer to a Checkpoint if successful; NULL otherwise
+ * @see checkpoint_stop(Checkpoint *, Simulation *)
+ */
+Checkpoint *checkpoint_start(const char *filename, Simulation *sim);
+
+/**
+ * Journals changes and takes snapshots when they're due, called from the main loop
+ * A simulation that isn't the checkpointed one any more is snapshotted anew in
+ * the background, and journaled once that snapshot is in place
+ * @param cp Checkpoint
+ * @param sim Current simulation
+ * @param now_us Current time in microseconds
+ */
+void checkpoint_poll(Checkpoint *cp, Simulation *sim, long long now_us);
+
+/**
+ * Journals the last changes, waits for the writer and stops checkpointing
+ * @param cp Checkpoint to be stopped
+ * @param sim Current simulation
+ * @return 0 if everything was written; EOF otherwise
+ */
+int checkpoint_stop(Checkpoint *cp, Simulation *sim);
+
+/**
+ * Restores the newest consistent state: the snapshot with its journals replayed
+ * @param filename Snapshot .lant file path given to checkpoint_start
+ * @return Pointer to a Simulation struct if a snapshot exists; NULL otherwise
+ */
+Simulation *checkpoint_restore(const char *filename);
+
+
+/*----------------------------------------------------------------------------*
+ *                                shm_export.c                                *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Creates a POSIX shared memory segment laid out as described at @ref ShmHeader
+ * and subscribes to the cells changed by the simulation (not on Windows)
+ * An existing segment by that name is replaced
+ * @param name Segment name, with or without the leading slash
+ * @param sim Simulation to be exported, call before the engine starts
+ * @return Pointer to a ShmExport if successful; NULL otherwise
+ * @see shm_export_stop(ShmExport *, Simulation *)
+ */
+ShmExport *shm_export_start(const char *name, Simulation *sim);
+
+/**
+ * Writes the cells changed since the last update, or all of them if some went
+ * unseen or the grid changed, along with the ant's state; call with the engine locked
+ * @param exp Export
+ * @param sim Current simulation
+ * @param epoch Engine epoch the simulation was read in, see @ref EngineView
+ */
+void shm_export_update(ShmExport *exp, Simulation *sim, unsigned epoch);
+
+/**
+ * Marks the segment as no longer live, unmaps and removes it
+ * Readers that still have it mapped keep the last frame
+ * @param exp Export to be stopped
+ * @param sim Current simulation
  */
-int create_bitmap_file(const char *filename, pixel_t *image, size_t height, size_t width);
+void shm_export_stop(ShmExport *exp, Simulation *sim);
 
 #endif  // __IO_H__
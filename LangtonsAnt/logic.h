@@ -9,6 +9,7 @@
 #include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 
 /*--------------------- General purpose macros and types ---------------------*/
@@ -158,18 +159,93 @@ typedef struct grid {
 	unsigned     init_size, size, tmp_size;
 	unsigned     colored;
 	Vector2i     top_left, bottom_right;
+	byte        *block;       /**< Single allocation or mapping holding all rows of c, if any */
+	size_t       block_size;
+	bool         is_mapped;   /**< Is block a file mapping rather than heap memory? */
 } Grid;
 
 
+/*---------------------- Trajectory log macros and types ---------------------*/
+
+/** @name Trajectory log attributes */
+///@{
+#define TRAJ_MAGIC        "LTRJ"
+#define TRAJ_MAGIC_SZ     (size_t)4U
+#define TRAJ_VERSION      1U
+#define TRAJ_BYTE_ORDER   0x01020304U  /**< Files from other-endian machines are rejected */
+#define TRAJ_BLOCK_STEPS  (1U << 16)   /**< Steps per block (between keyframes), multiple of 64 */
+#define TRAJ_BUFFERS      8U           /**< Blocks filled or waiting for the writer thread */
+///@}
+
+/** Ant state before a given step, position relative to the grid center */
+typedef struct trajectory_state {
+	uint64_t   step;
+	Vector2i   pos;
+	Direction  dir;
+} TrajectoryState;
+
+/** Header at the start of a trajectory file */
+typedef struct traj_file_header {
+	char      magic[TRAJ_MAGIC_SZ];
+	uint16_t  version, header_size;
+	uint32_t  byte_order, block_steps;
+} TrajFileHeader;
+
+/**
+ * Keyframe starting every block of a trajectory file, followed by block_steps
+ * bits (LSB first), one per step: 1 if the ant turned right, 0 if left
+ */
+typedef struct traj_keyframe {
+	uint64_t  step;      /**< Step number the state is from */
+	int32_t   y, x;      /**< Position relative to the grid center */
+	uint32_t  dir;
+	uint32_t  count;     /**< Steps logged in this block, block_steps if full */
+} TrajKeyframe;
+
+/** Background trajectory writer (opaque) */
+typedef struct trajectory Trajectory;
+
+/** Seekable trajectory file reader (opaque) */
+typedef struct trajectory_reader TrajectoryReader;
+
+
+/*------------------------- Checkpoint type definition -----------------------*/
+
+/** Periodic snapshots with a journal of changed cells (opaque) */
+typedef struct checkpoint Checkpoint;
+
+
+/*------------------------ Cell feed macros and types -----------------------*/
+
+/** What simulation_step does when a subscriber's ring is full */
+typedef enum feed_policy {
+	FEED_DROP,   /**< Drop the change and mark the subscriber for resync */
+	FEED_BLOCK,  /**< Wait for the subscriber to make room */
+} FeedPolicy;
+
+/** Cell changed by a step */
+typedef struct cell_change {
+	uint32_t  step;                  /**< Step count after the change */
+	int32_t   y, x;                  /**< Position relative to the grid center */
+	byte      old_color, new_color;
+} CellChange;
+
+/** Single-producer/single-consumer ring of cell changes (opaque) */
+typedef struct cell_feed CellFeed;
+
+
 /*------------------------ Simulation type definition ------------------------*/
 
 /** Simulation container */
 typedef struct simulation {
-	Colors   *colors;
-	Grid     *grid;
-	Ant      *ant;
-	unsigned  steps;
-	bool      is_running;
+	Colors      *colors;
+	Grid        *grid;
+	Ant         *ant;
+	unsigned     steps;
+	bool         is_running;
+	Trajectory  *trajectory;  /**< Log fed by simulation_step (NULL if not logging) */
+	Checkpoint  *checkpoint;  /**< Checkpoint tracking cells changed by simulation_step (NULL if none) */
+	CellFeed    *feeds;       /**< Subscribers to the cells changed by simulation_step (list) */
 } Simulation;
 
 
@@ -207,11 +283,15 @@ bool has_enough_colors(Colors *colors);
 
 Grid *grid_new(Colors *colors, unsigned init_size);
 void grid_delete(Grid *grid);
+void grid_free_block(Grid *grid);
+Grid *grid_copy(Grid *grid);
 void grid_silent_expand(Grid *grid);
 void grid_expand(Grid *grid, Ant *ant);
 void grid_make_sparse(Grid *grid);
 bool is_grid_sparse(Grid *grid);
 bool is_grid_usage_low(Grid *grid);
+size_t grid_memory_usage(Grid *grid);
+void grid_read_row(Grid *grid, int y, int x, unsigned n, byte *out);
 void sparse_prepend(SparseCell **phead, unsigned column, byte color);
 SparseCell *sparse_append(SparseCell *head, unsigned column, byte color);
 byte sparse_color_at(Grid *grid, Vector2i pos);
@@ -223,10 +303,48 @@ byte sparse_color_at(Grid *grid, Vector2i pos);
 
 Simulation *simulation_new(Colors *colors, unsigned init_size);
 void simulation_delete(Simulation *sim);
+Simulation *simulation_copy(Simulation *sim);
 void simulation_run(Simulation *sim);
 void simulation_halt(Simulation *sim);
 bool simulation_step(Simulation *sim);
 bool is_simulation_running(Simulation *sim);
 bool has_simulation_started(Simulation *sim);
 
+
+/*----------------------------------------------------------------------------*
+ *                                trajectory.c                                *
+ *----------------------------------------------------------------------------*/
+
+Trajectory *trajectory_start(const char *filename, Simulation *sim);
+int trajectory_stop(Simulation *sim);
+void trajectory_record(Trajectory *traj, Simulation *sim, Direction before);
+TrajectoryReader *trajectory_open(const char *filename);
+void trajectory_close(TrajectoryReader *reader);
+bool trajectory_range(TrajectoryReader *reader, uint64_t *first, uint64_t *end);
+bool trajectory_seek(TrajectoryReader *reader, uint64_t step, TrajectoryState *state);
+bool trajectory_next(TrajectoryReader *reader, TrajectoryState *state);
+
+
+/*----------------------------------------------------------------------------*
+ *                                checkpoint.c                                *
+ *----------------------------------------------------------------------------*/
+
+void checkpoint_mark(Checkpoint *cp, Simulation *sim);
+
+
+/*----------------------------------------------------------------------------*
+ *                                   feed.c                                   *
+ *----------------------------------------------------------------------------*/
+
+CellFeed *feed_new(unsigned capacity, FeedPolicy policy);
+void feed_delete(CellFeed *feed);
+void feed_subscribe(Simulation *sim, CellFeed *feed);
+void feed_unsubscribe(Simulation *sim, CellFeed *feed);
+void feed_transfer(Simulation *from, Simulation *to);
+void feed_close(CellFeed *feed);
+bool feed_is_wanted(Simulation *sim);
+void feed_publish(Simulation *sim, const CellChange *change);
+size_t feed_read(CellFeed *feed, CellChange *out, size_t max);
+bool feed_take_resync(CellFeed *feed);
+
 #endif  // __LOGIC_H__
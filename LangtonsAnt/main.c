@@ -1,32 +1,279 @@
 #include "graphics.h"
 #include "io.h"
+#include "serial.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
-int main(int argc, char *argv[])
+static void usage(const char *app)
 {
-	if (argc > 2) {
-		fprintf(stderr, "usage: %s [simulation_file]\n", *argv);
-		return EXIT_FAILURE;
+	fprintf(stderr, "usage: %s [-H | -P] [-n steps] [-s speed] [-r target [-e steps] [-B]]\n"
+	                "       [-o image [-z scale]] [-t log] [-c checkpoint] [-C socket]\n"
+	                "       [-M name] [-T] [simulation_file]\n"
+	                "  -H         headless, run without a terminal (null render backend)\n"
+	                "  -P         draw the grid as sixel/kitty images, one pixel or block per cell\n"
+	                "  -n steps   stop after the given number of steps\n"
+	                "  -s speed   initial speed (%d-%d, turbo above %d)\n"
+	                "  -r target  record frames to a .y4m/.ppm file, '-' or '|command'\n"
+	                "  -e steps   record every given number of steps instead of at %u fps\n"
+	                "  -B         record the bounding box instead of the visible area\n"
+	                "  -o image   export the grid to a .png (bounding box), .bmp or .dzi (tiles) on exit\n"
+	                "  -z scale   PNG pixels per cell side (default 1)\n"
+	                "  -T         save .lant files in the text format older versions read\n"
+	                "  -t log     append the ant's path to a trajectory log (1 bit per step)\n"
+	                "  -c file    checkpoint to a .lant file and journal, resuming from them if present\n"
+	                "  -C socket  serve JSON telemetry and take commands on a UNIX domain socket\n"
+	                "  -M name    export the grid and the ant to a POSIX shared memory segment\n",
+	        app, LOOP_MIN_SPEED, LOOP_TOP_SPEED, LOOP_MAX_SPEED, RECORDER_DEF_FPS);
+#if SERIAL_COLORS
+	fprintf(stderr, "  -S port    serial port of the color rule displays (default: first " SERIAL_PORT_FMT ")\n",
+	        SERIAL_PORT_FIRST);
+#endif
+}
+
+static bool parse_uint(const char *str, unsigned *value)
+{
+	char *end;
+	unsigned long ul = str ? strtoul(str, &end, 10) : 0;
+	if (!str || *end || ul > UINT_MAX) {
+		return false;
 	}
+	*value = (unsigned)ul;
+	return true;
+}
+
+static bool has_suffix(const char *str, const char *suffix)
+{
+	size_t n = strlen(str), m = strlen(suffix);
+	return n >= m && !strcmp(str + n - m, suffix);
+}
+
+static int export_image(const char *filename, Grid *grid, unsigned scale)
+{
+	if (has_suffix(filename, ".png")) {
+		return save_grid_png(filename, grid, scale);
+	} else if (has_suffix(filename, ".bmp")) {
+		return save_grid_bitmap(filename, grid);
+	} else if (has_suffix(filename, ".dzi")) {
+		return save_grid_pyramid(filename, grid);
+	}
+	return EOF;
+}
+
+static void print_render_stats(ttime_t elapsed_us)
+{
+	Simulation *sim = stgs.simulation;
+	double elapsed_s = elapsed_us / 1e6;
+	printf("backend   %s\n", render->name);
+	printf("steps     %u\n", sim->steps);
+	printf("elapsed   %.3f s\n", elapsed_s);
+	printf("steps/s   %.0f\n", (elapsed_s > 0) ? sim->steps / elapsed_s : 0.0);
+	printf("regions   %llu\n", render_stats.regions);
+	printf("cells     %llu\n", render_stats.cells);
+	printf("menus     %llu\n", render_stats.menus);
+	printf("presents  %llu\n", render_stats.presents);
+	printf("polls     %llu\n", render_stats.polls);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *filename = NULL, *record_target = NULL, *export_target = NULL, *traj_target = NULL;
+	const char *checkpoint_target = NULL, *control_target = NULL, *shm_target = NULL;
+#if SERIAL_COLORS
+	const char *serial_port = SERIAL_DEVICE;
+#endif
+	RecordRegion record_region = REC_REGION_VIEWPORT;
+	unsigned record_every = 0, export_scale = 1;
+	bool headless = false, pixel = false;
+	int i;
 
 	stgs.init_size = GRID_DEF_INIT_SIZE;
 	stgs.speed = LOOP_DEF_SPEED;
-	if (argc == 2 && (stgs.simulation = load_simulation(argv[1]))) {
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-H")) {
+			headless = true;
+		} else if (!strcmp(argv[i], "-P")) {
+			pixel = true;
+		} else if (!strcmp(argv[i], "-n")) {
+			if (!parse_uint(argv[++i], &stgs.step_limit)) {
+				goto usage_end;
+			}
+		} else if (!strcmp(argv[i], "-s")) {
+			if (!parse_uint(argv[++i], &stgs.speed)
+			 || stgs.speed < LOOP_MIN_SPEED || stgs.speed > LOOP_TOP_SPEED) {
+				goto usage_end;
+			}
+		} else if (!strcmp(argv[i], "-r")) {
+			if (!(record_target = argv[++i])) {
+				goto usage_end;
+			}
+		} else if (!strcmp(argv[i], "-e")) {
+			if (!parse_uint(argv[++i], &record_every)) {
+				goto usage_end;
+			}
+		} else if (!strcmp(argv[i], "-o")) {
+			if (!(export_target = argv[++i])) {
+				goto usage_end;
+			}
+		} else if (!strcmp(argv[i], "-z")) {
+			if (!parse_uint(argv[++i], &export_scale) || !export_scale) {
+				goto usage_end;
+			}
+		} else if (!strcmp(argv[i], "-t")) {
+			if (!(traj_target = argv[++i])) {
+				goto usage_end;
+			}
+		} else if (!strcmp(argv[i], "-c")) {
+			if (!(checkpoint_target = argv[++i])) {
+				goto usage_end;
+			}
+		} else if (!strcmp(argv[i], "-C")) {
+			if (!(control_target = argv[++i])) {
+				goto usage_end;
+			}
+		} else if (!strcmp(argv[i], "-M")) {
+			if (!(shm_target = argv[++i])) {
+				goto usage_end;
+			}
+#if SERIAL_COLORS
+		} else if (!strcmp(argv[i], "-S")) {
+			if (!(serial_port = argv[++i])) {
+				goto usage_end;
+			}
+#endif
+		} else if (!strcmp(argv[i], "-B")) {
+			record_region = REC_REGION_BOUNDING_BOX;
+		} else if (!strcmp(argv[i], "-T")) {
+			stgs.text_saves = true;
+		} else if (argv[i][0] == '-' || filename) {
+			goto usage_end;
+		} else {
+			filename = argv[i];
+		}
+	}
+
+	if (checkpoint_target && (stgs.simulation = checkpoint_restore(checkpoint_target))) {
+		stgs.colors = stgs.simulation->colors;
+		filename = NULL;  // Resuming takes precedence
+	} else if (filename && (stgs.simulation = load_simulation(filename))) {
 		stgs.colors = stgs.simulation->colors;
 	} else {
 		stgs.colors = colors_new(COLOR_SILVER);
 		stgs.simulation = simulation_new(stgs.colors, stgs.init_size);
 	}
 
-	init_graphics(COLOR_BLACK, COLOR_WHITE);
+	if (headless) {
+		if (!has_enough_colors(stgs.colors)) {
+			fprintf(stderr, "%s: headless mode requires a simulation file with color rules\n", *argv);
+			return EXIT_FAILURE;
+		}
+		render = &null_backend;
+		simulation_run(stgs.simulation);
+	} else if (pixel) {
+		render = &pixel_backend;
+	}
+
+	if (checkpoint_target && !(active_checkpoint = checkpoint_start(checkpoint_target, stgs.simulation))) {
+		fprintf(stderr, "%s: couldn't checkpoint to '%s'\n", *argv, checkpoint_target);
+		return EXIT_FAILURE;
+	}
+
+	if (traj_target && !trajectory_start(traj_target, stgs.simulation)) {
+		fprintf(stderr, "%s: couldn't log the trajectory to '%s' (an existing log must end at step %u)\n",
+		        *argv, traj_target, stgs.simulation->steps);
+		return EXIT_FAILURE;
+	}
+
+	if (record_target) {
+		active_recorder = recorder_open(record_target, record_region, record_every, 0);
+		if (!active_recorder) {
+			fprintf(stderr, "%s: couldn't record to '%s'\n", *argv, record_target);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (control_target && !(active_control = control_start(control_target))) {
+		fprintf(stderr, "%s: couldn't listen on '%s'\n", *argv, control_target);
+		return EXIT_FAILURE;
+	}
+
+	if (shm_target && !(active_shm_export = shm_export_start(shm_target, stgs.simulation))) {
+		fprintf(stderr, "%s: couldn't export to shared memory '%s'\n", *argv, shm_target);
+		return EXIT_FAILURE;
+	}
+
+#if SERIAL_COLORS
+	if (serial_start(serial_port)) {
+		serial_send_colors(stgs.colors);  // Goes out as soon as a device is there
+	}
+#endif
+
+	render_init(COLOR_BLACK, COLOR_WHITE);
 
 	main_loop();
 
-	end_graphics();
+	render_end();
+
+	if (active_control) {
+		control_stop(active_control);
+		active_control = NULL;
+	}
+
+	if (active_shm_export) {
+		shm_export_stop(active_shm_export, stgs.simulation);
+		active_shm_export = NULL;
+	}
+
+#if SERIAL_COLORS
+	serial_stop();
+#endif
+
+	if (active_save) {
+		save_job_wait(active_save);  // Don't leave a half-written temp file behind
+		active_save = NULL;
+	}
+	if (active_load) {
+		Simulation *loaded;
+		load_job_cancel(active_load);
+		load_job_wait(active_load, &loaded);  // Nothing left to show it in
+		active_load = NULL;
+	}
+
+	if (headless) {
+		print_render_stats(timer_micros());
+	}
+	if (active_recorder) {
+		unsigned long dropped = recorder_dropped(active_recorder);
+		if (recorder_close(active_recorder) == EOF) {
+			fprintf(stderr, "%s: recording to '%s' failed\n", *argv, record_target);
+		} else if (dropped) {
+			fprintf(stderr, "%s: %lu frames dropped while recording\n", *argv, dropped);
+		}
+		active_recorder = NULL;
+	}
+
+	if (active_checkpoint) {
+		if (checkpoint_stop(active_checkpoint, stgs.simulation) == EOF) {
+			fprintf(stderr, "%s: checkpointing to '%s' failed\n", *argv, checkpoint_target);
+		}
+		active_checkpoint = NULL;
+	}
+
+	if (stgs.simulation->trajectory && trajectory_stop(stgs.simulation) == EOF) {
+		fprintf(stderr, "%s: logging the trajectory to '%s' failed\n", *argv, traj_target);
+	}
+
+	if (export_target && export_image(export_target, stgs.simulation->grid, export_scale) == EOF) {
+		fprintf(stderr, "%s: couldn't export to '%s'\n", *argv, export_target);
+	}
 
 	simulation_delete(stgs.simulation);
 	colors_delete(stgs.colors);
 	return EXIT_SUCCESS;
+
+usage_end:
+	usage(*argv);
+	return EXIT_FAILURE;
 }
@@ -1,27 +1,143 @@
 #include "graphics.h"
+#include "io.h"
 #include "serial.h"
+#include "thread.h"
 
-static volatile bool do_loop = true;
+#ifdef _WIN32
+static mutex_t wake_lock;
+static cond_t wake_cond;
+static bool woken;
+#else
+#	include <errno.h>
+#	include <fcntl.h>
+#	include <poll.h>
+#	include <signal.h>
+#	include <string.h>
+#	include <unistd.h>
 
-static state_t handle_input(Simulation *sim)
+static int wake_pipe[2] = { -1, -1 };  // Written to by wake_main_loop, polled along with stdin
+static const int wake_signals[] = { SIGINT, SIGTERM, SIGHUP, SIGCHLD };
+static struct sigaction old_actions[LEN(wake_signals)];
+#endif
+
+static atomic_word_t do_loop = true;  // Also cleared by the simulation thread
+static CellFeed *feed;                // Cells changed since they were last drawn
+
+#ifndef _WIN32
+static void handle_signal(int sig)
+{
+	int saved = errno;
+	if (sig != SIGCHLD) {  // A save job finishing only needs polling
+		stop_main_loop();
+	}
+	wake_main_loop();
+	errno = saved;
+}
+#endif
+
+static void init_wakeup(void)
+{
+#ifdef _WIN32
+	mutex_init(&wake_lock);
+	cond_init(&wake_cond);
+#else
+	struct sigaction sa;
+	size_t i;
+
+	if (pipe(wake_pipe) == 0) {
+		for (i = 0; i < 2; i++) {
+			fcntl(wake_pipe[i], F_SETFL, fcntl(wake_pipe[i], F_GETFL) | O_NONBLOCK);
+			fcntl(wake_pipe[i], F_SETFD, FD_CLOEXEC);
+		}
+	} else {
+		wake_pipe[0] = wake_pipe[1] = -1;
+	}
+
+	memset(&sa, 0, sizeof sa);
+	sa.sa_handler = handle_signal;
+	sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+	sigemptyset(&sa.sa_mask);
+	for (i = 0; i < LEN(wake_signals); i++) {
+		sigaction(wake_signals[i], &sa, &old_actions[i]);
+	}
+#endif
+}
+
+static void end_wakeup(void)
+{
+#ifdef _WIN32
+	mutex_destroy(&wake_lock);
+	cond_destroy(&wake_cond);
+#else
+	size_t i;
+	int fds[2] = { wake_pipe[0], wake_pipe[1] };
+
+	for (i = 0; i < LEN(wake_signals); i++) {
+		sigaction(wake_signals[i], &old_actions[i], NULL);
+	}
+	wake_pipe[0] = wake_pipe[1] = -1;
+	if (fds[0] != -1) {
+		close(fds[0]), close(fds[1]);
+	}
+#endif
+}
+
+/* Sleeps until input arrives, wake_main_loop is called or the timeout passes (ms, -1 for none) */
+static void wait_for_events(int timeout_ms)
+{
+#ifdef _WIN32
+	if (timeout_ms < 0 || timeout_ms > (int)LOOP_POLL_MS) {
+		timeout_ms = LOOP_POLL_MS;  // Console input can't be waited on along with the condition
+	}
+	mutex_lock(&wake_lock);
+	if (!woken) {
+		cond_timedwait(&wake_cond, &wake_lock, (unsigned)timeout_ms);
+	}
+	woken = false;
+	mutex_unlock(&wake_lock);
+#else
+	struct pollfd fds[2] = {
+		{ .fd = wake_pipe[0], .events = POLLIN },
+		{ .fd = (render == &null_backend) ? -1 : STDIN_FILENO, .events = POLLIN },  // Ignored if < 0
+	};
+	char buf[64];
+
+	if (poll(fds, LEN(fds), timeout_ms) <= 0) {
+		return;  // Timed out or interrupted by a signal
+	}
+	if (fds[0].revents & POLLIN) {
+		while (read(wake_pipe[0], buf, sizeof buf) > 0);  // Drain, any number of wakeups is one
+	}
+	if (fds[1].revents & (POLLHUP | POLLERR | POLLNVAL) && !(fds[1].revents & POLLIN)) {
+		stop_main_loop();  // Terminal went away
+	}
+#endif
+}
+
+/* Handles one key or pending action, active is set if there was any */
+static state_t handle_input(bool *active)
 {
 	state_t ret;
 	int key;
 	MEVENT m, *mouse = &m;
 
 	if (pending_action.func) {
+		*active = true;
+		engine_lock();
 		ret = (*pending_action.func)(pending_action.arg);  // Blocking
+		engine_unlock();
 
-		flushinp();
+		render_flush_input();
 		pending_action.func = NULL;
 		return ret;
 	}
 
 	// These functions must be called only once per loop
-	if ((key = getch()) == ERR) {
+	if ((key = render_poll_input(mouse)) == ERR) {
 		return STATE_NO_CHANGE;
 	}
-	if (key == KEY_MOUSE && getmouse(mouse) != ERR && mouse->bstate) {
+	*active = true;
+	if (key == KEY_MOUSE && mouse->bstate) {
 #if MOUSE_ACT_ON_PRESS
 		if (mouse->bstate & MOUSE_ANTIMASK) {
 			return STATE_NO_CHANGE;  // Prevent double press
@@ -31,78 +147,229 @@ static state_t handle_input(Simulation *sim)
 		mouse = NULL;
 	}
 
+	engine_lock();
 	ret = STATE_NO_CHANGE;
-	if (sim) {
-		ret |= grid_key_command(sim->grid, sim->ant, key, mouse);
+	if (inputw) {
+		ret |= input_key_command(key, mouse);  // A filename is being typed, one key per loop
+	} else {
+		if (stgs.simulation) {
+			ret |= grid_key_command(stgs.simulation->grid, stgs.simulation->ant, key, mouse);
+		}
+		ret |= menu_key_command(key, mouse);
 	}
-	ret |= menu_key_command(key, mouse);
+	engine_unlock();
 	return ret;
 }
 
-#define DRAW_ITER(w, ...)              \
-	if (! w##_changed) {               \
-		draw_##w##_iter(__VA_ARGS__);  \
+/* Carries out the commands that came in through the control socket, like input */
+static state_t handle_control(void)
+{
+	ControlCommand cmd;
+	const char *error;
+	state_t ret = STATE_NO_CHANGE;
+
+	if (!active_control) {
+		return ret;
+	}
+	while (control_take(active_control, &cmd)) {
+		engine_lock();
+		ret |= menu_remote_command(&cmd, &error);
+		engine_unlock();
+		control_reply(active_control, &cmd, error);
 	}
+	return ret;
+}
+
+/* Fills in the telemetry read from the simulation; call with the engine locked */
+static void update_telemetry(Telemetry *tel, Simulation *sim, EngineView *view)
+{
+	Grid *grid = sim->grid;
+
+	tel->steps = view->steps;
+	tel->rate = view->rate;
+	tel->speed = stgs.speed;
+	tel->running = is_simulation_running(sim);
+	tel->grid_size = grid->size;
+	tel->colored = grid->colored;
+	tel->sparse = is_grid_sparse(grid);
+	tel->top_left = grid->top_left;
+	tel->bottom_right = grid->bottom_right;
+	tel->load_status = load_status;
+	tel->save_status = save_status;
+	tel->load_progress = load_progress;
+	tel->save_progress = save_progress;
+}
+
+/* Draws the cells changed since the last call, or the entire region if some went unseen */
+static void draw_changes(Simulation *sim, bool full)
+{
+	CellChange changes[256];
+	int center = (int)(sim->grid->size / 2);
+	size_t n, i;
+
+	full |= !feed || feed_take_resync(feed);
+	while (feed && (n = feed_read(feed, changes, LEN(changes)))) {
+		for (i = 0; i < n && !full; i++) {
+			Vector2i pos = { changes[i].y + center, changes[i].x + center };
+			render_cell(sim->grid, NULL, pos);
+		}
+	}
+	if (full) {
+		render_region(sim->grid, sim->ant);
+	} else {
+		render_cell(sim->grid, sim->ant, sim->ant->pos);
+	}
+}
+
+/* Time by which the loop has to run again (us), -1 if only input or a wakeup can give it work */
+static ttime_t next_due(EngineView *shown, bool dirty, ttime_t draw_time, ttime_t menu_time)
+{
+	ttime_t due = -1, frame = draw_time + (ttime_t)LOOP_FRAME_TIME_US;
+	EngineView view;
+
+	engine_watch();  // Before looking, so progress can't slip in between
+	engine_view(&view);
+	if (view.epoch != shown->epoch) {
+		return 0;
+	}
+	if (view.steps != shown->steps) {
+		due = MIN(frame, menu_time + (ttime_t)LOOP_MENU_TIME_US(stgs.speed));
+	}
+	if (dirty) {
+		due = (due < 0) ? frame : MIN(due, frame);
+	}
+	if (active_save || active_load) {  // Polled, the threads doing the I/O don't signal
+		ttime_t poll_time = timer_micros() + (ttime_t)LOOP_FRAME_TIME_US;
+		due = (due < 0) ? poll_time : MIN(due, poll_time);
+	}
+	return due;
+}
 
 void main_loop(void)
 {
-	static ttime_t step_time, menu_time, draw_time;
-	ttime_t curr_time;
-	bool do_step, do_menu, do_draw;
+	static ttime_t menu_time, draw_time;
+	ttime_t curr_time, due;
+	bool do_menu, do_draw, dirty = true;
+	EngineView view, shown;
+	Telemetry tel = { 0 };
 	Simulation *sim = stgs.simulation;
 
 	init_timer();
-	draw_grid_full(sim->grid, sim->ant);
-	draw_menu_full();
+	init_wakeup();
+	render_region(sim->grid, sim->ant);
+	render_menu(true);
+	if (render != &null_backend) {  // Nothing would read it, and publishing slows every step down
+		feed = feed_new(LOOP_FEED_CAPACITY, FEED_DROP);
+		feed_subscribe(sim, feed);
+	}
+	engine_start();
+	engine_view(&shown);
+	if (active_shm_export) {
+		engine_lock();
+		shm_export_update(active_shm_export, sim, shown.epoch);  // Readers get a frame before the first step
+		engine_unlock();
+	}
+	if (active_control) {
+		engine_lock();
+		update_telemetry(&tel, sim, &shown);
+		engine_unlock();
+		control_publish(active_control, &tel);  // For clients that connect before anything changes
+	}
 
-	while (do_loop) {
-		state_t input = handle_input(sim);
+	while (atomic_word_load(&do_loop)) {
+		bool active = false;
+		state_t input = handle_input(&active) | poll_io_jobs() | handle_control();
 		bool grid_changed   = input & STATE_GRID_CHANGED;
 		bool menu_changed   = input & STATE_MENU_CHANGED;
 		bool colors_changed = input & STATE_COLORS_CHANGED;
-		sim = stgs.simulation;  // May have changed on input
+		bool stepped, publish = false;
 
 		curr_time = timer_micros();
-		do_step = (curr_time - step_time >= LOOP_STEP_TIME_US(stgs.speed));
 		do_menu = (curr_time - menu_time >= LOOP_MENU_TIME_US(stgs.speed));
 		do_draw = (curr_time - draw_time >= LOOP_FRAME_TIME_US);
+		dirty |= active;  // Key handlers may draw by themselves
 
-		if (is_simulation_running(sim)) {
-			if (do_step) {
-				Vector2i prev_pos = sim->ant->pos;
-				if (simulation_step(sim)) {
-					DRAW_ITER(grid, sim->grid, sim->ant, prev_pos);
-				} else {
-					grid_changed = menu_changed = true;  // Grid expanded/sparse
-				}
-				step_time = curr_time;
+		/* Progress made by the simulation thread since it was last shown, read without locking */
+		engine_view(&view);
+		stepped = view.steps != shown.steps;
+		if (view.epoch != shown.epoch) {
+			grid_changed = menu_changed = true;  // Grid expanded/sparse/replaced
+		}
+
+		if (grid_changed || menu_changed || (stepped && (do_draw || do_menu))) {
+			engine_lock();
+			engine_view(&view);  // Nothing steps while locked, so this matches the simulation
+			sim = stgs.simulation;
+			stepped = view.steps != shown.steps;
+			grid_changed |= view.epoch != shown.epoch;
+			if (grid_changed || (stepped && (do_draw || view.steps == shown.steps+1))) {
+				draw_changes(sim, grid_changed);  // Single steps are drawn as they come
+				shown = view;
+				dirty = true;
 			}
-			if (do_menu) {
-				DRAW_ITER(menu);
+			if (menu_changed || (stepped && do_menu)) {
+				render_menu(false);  // Redraws only the widgets whose state changed
+				do_draw |= !!(pending_action.func);  // Draw before blocking I/O
 				menu_time = curr_time;
+				dirty = true;
+			}
+			if (active_control) {
+				update_telemetry(&tel, sim, &view);
+				publish = true;
 			}
+			if (active_shm_export) {
+				shm_export_update(active_shm_export, sim, view.epoch);
+			}
+			engine_unlock();
 		}
 
-		if (grid_changed) {
-			draw_grid_full(sim->grid, sim->ant);
-		}
-		if (menu_changed) {
-			draw_menu_full();
-			do_draw |= !!(pending_action.func);  // Draw before blocking I/O
-		}
-		if (do_draw) {
-			doupdate();
+		if (do_draw && dirty) {
+			dirty = !render_present();
+			tel.frame_ms = draw_time ? (curr_time - draw_time) / 1e3 : 0;
+			tel.draw_ms = (timer_micros() - curr_time) / 1e3;
 			draw_time = curr_time;
+			publish = true;
+		}
+		if (active_control && publish) {
+			control_publish(active_control, &tel);  // Only a copy, sent out by the server thread
 		}
 		if (colors_changed) {
 #if SERIAL_COLORS
-			serial_send_colors(sim->colors);
+			serial_send_colors(stgs.simulation->colors);
 #endif
 		}
+		if (!active && !input && atomic_word_load(&do_loop)) {
+			due = next_due(&shown, dirty, draw_time, menu_time);
+			curr_time = timer_micros();
+			wait_for_events((due < 0) ? -1 : (due <= curr_time) ? 0 : (int)((due - curr_time + 999) / 1000));
+		}
+	}
+
+	engine_stop();
+	end_wakeup();
+	if (feed) {
+		feed_unsubscribe(stgs.simulation, feed);
+		feed_delete(feed);
+		feed = NULL;
 	}
 }
 
 void stop_main_loop(void)
 {
-	do_loop = false;
+	atomic_word_store(&do_loop, false);
+}
+
+void wake_main_loop(void)
+{
+#ifdef _WIN32
+	mutex_lock(&wake_lock);
+	woken = true;
+	cond_signal(&wake_cond);
+	mutex_unlock(&wake_lock);
+#else
+	char c = 0;
+	if (wake_pipe[1] != -1 && write(wake_pipe[1], &c, 1) < 0) {
+		return;  // Full, so a wakeup is pending anyway
+	}
+#endif
 }
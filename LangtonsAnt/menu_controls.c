@@ -2,30 +2,99 @@
 #include "io.h"
 
 #include <assert.h>
+#include <stdio.h>
 #include <string.h>
 
 #define INPUT_WINDOW_WIDTH  (MENU_WINDOW_WIDTH - 4)
 #define INPUT_WINDOW_HEIGHT 3
+#define INPUT_MAX_LEN       (FILENAME_SZ - 5)  // Leave room for ".bmp"
 
-static WINDOW *inputw;
+WINDOW *inputw;
 static const Vector2i input_pos = {
 	.y = MENU_CONTROLS_Y - 13,
 	.x = GRID_WINDOW_SIZE + MENU_WINDOW_WIDTH - INPUT_WINDOW_WIDTH - 2,
 };
 
-static bool read_filename(char* filename)
-{
-	int ret;
-	inputw = newwin(3, INPUT_WINDOW_WIDTH, input_pos.y, input_pos.x);  // TODO: Move to window drawing file
-	wbkgd(inputw, PAIR_FOR(COLOR_GRAY) | A_REVERSE);
-	wattron(inputw, fg_pair);
-	waddstr(inputw, " Filename: ");
-	wattroff(inputw, fg_pair);
-	echo();
-	ret = mvwgetnstr(inputw, 1, 1, filename, FILENAME_SZ - 5);  // Leave room for ".bmp"
-	noecho();
+/* Filename typed so far, keys come in with the main loop so nothing waits for it */
+static char input_text[INPUT_MAX_LEN + 1];
+static size_t input_len;
+static bool input_dirty;
+static state_t (*input_entered)(const char *filename);
+
+static void read_filename(state_t (*entered)(const char *filename))
+{
+	inputw = newwin(INPUT_WINDOW_HEIGHT, INPUT_WINDOW_WIDTH, input_pos.y, input_pos.x);  // TODO: Move to window drawing file
+	input_text[0] = '\0';
+	input_len = 0;
+	input_dirty = true;
+	input_entered = entered;
+}
+
+static state_t close_input(bool ok)
+{
 	delwin(inputw);
-	return ret != ERR && strlen(filename) > 0;
+	inputw = NULL;
+	menu_invalidate_area(abs2rel(input_pos, menu_pos), INPUT_WINDOW_HEIGHT);
+	return (*input_entered)((ok && input_len > 0) ? input_text : NULL) | STATE_MENU_CHANGED;
+}
+
+void update_input(bool overlapped)
+{
+	int shown = MIN((int)input_len, INPUT_WINDOW_WIDTH - 3);  // Scrolled to the end
+
+	if (input_dirty) {
+		werase(inputw);
+		wbkgd(inputw, PAIR_FOR(COLOR_GRAY) | A_REVERSE);
+		wattron(inputw, fg_pair);
+		waddstr(inputw, " Filename: ");
+		wattroff(inputw, fg_pair);
+		mvwaddnstr(inputw, 1, 1, input_text + input_len - shown, shown);
+		waddch(inputw, '_');  // Cursor
+		input_dirty = false;
+	} else if (overlapped) {
+		touchwin(inputw);
+	} else {
+		return;
+	}
+	wnoutrefresh(inputw);
+}
+
+state_t input_key_command(int key, MEVENT *mouse)
+{
+	Vector2i mouse_pos;
+
+	switch (key) {
+	case '\n': case '\r': case KEY_ENTER:
+#ifdef PDCURSES
+	case PADENTER:
+#endif
+		return close_input(true);
+	case KEY_ESC:
+		return close_input(false);
+	case KEY_BACKSPACE: case '\b': case 0x7F:
+		if (input_len > 0) {
+			input_text[--input_len] = '\0';
+			input_dirty = true;
+		}
+		return STATE_MENU_CHANGED;
+	case KEY_MOUSE:
+		if (!mouse) {
+			return STATE_NO_CHANGE;
+		}
+		mouse_pos.y = mouse->y, mouse_pos.x = mouse->x;
+		if (!area_contains(input_pos, INPUT_WINDOW_WIDTH, INPUT_WINDOW_HEIGHT, mouse_pos)) {
+			return close_input(false);  // Clicked away, as with the dialog
+		}
+		return STATE_NO_CHANGE;
+	default:
+		if (key >= ' ' && key < 0x7F && input_len < INPUT_MAX_LEN) {
+			input_text[input_len++] = (char)key;
+			input_text[input_len] = '\0';
+			input_dirty = true;
+			return STATE_MENU_CHANGED;
+		}
+		return STATE_NO_CHANGE;
+	}
 }
 
 static const char *example_files[] = {
@@ -44,8 +113,16 @@ static const char *example_files[] = {
 #	define USER_FILE  example_files[LEN(example_files) - 1]
 #endif
 
+static int cycle_index;  /**< Example loaded next by cycling through them */
+
+#if GALLERY_MODE
+static Prefetch *standby;  /**< That example, loaded ahead while the current one is shown */
+static int standby_index = -1;
+#endif
+
 state_t set_simulation(Simulation *sim)
 {
+	feed_transfer(stgs.simulation, sim);  // Observers follow the current simulation
 	simulation_delete(stgs.simulation);
 	stgs.simulation = sim;
 	colors_delete(stgs.colors);
@@ -58,10 +135,11 @@ state_t set_simulation(Simulation *sim)
 state_t reset_simulation(void)
 {
 	Simulation *sim = stgs.simulation;
+	stgs.simulation = simulation_new(stgs.colors, stgs.init_size);
 	if (sim) {
+		feed_transfer(sim, stgs.simulation);
 		simulation_delete(sim);
 	}
-	stgs.simulation = simulation_new(stgs.colors, stgs.init_size);
 	scroll_reset();
 	return STATE_GRID_CHANGED | STATE_MENU_CHANGED;
 }
@@ -106,20 +184,23 @@ static state_t speed_button_clicked(int delta)
 {
 	unsigned old_value = stgs.speed;
 	if (delta > 0) {
-		stgs.speed = MIN((int)stgs.speed+delta, LOOP_MAX_SPEED);
+		stgs.speed = MIN((int)stgs.speed+delta, LOOP_TOP_SPEED);
 	} else if (delta < 0) {
 		stgs.speed = MAX((int)stgs.speed+delta, LOOP_MIN_SPEED);
 	}
-	return (stgs.speed != old_value) ? STATE_MENU_CHANGED : STATE_NO_CHANGE;
+	if (stgs.speed != old_value) {
+		engine_command(ENGINE_SPEED);
+		return STATE_MENU_CHANGED;
+	}
+	return STATE_NO_CHANGE;
 }
 
 static state_t stepup_button_clicked(void)
 {
 	Simulation *sim = stgs.simulation;
 	if (sim && has_enough_colors(sim->colors)) {
-		simulation_halt(sim);
-		simulation_step(sim);
-		return STATE_GRID_CHANGED | STATE_MENU_CHANGED;
+		engine_command(ENGINE_STEP);  // Shown once the simulation thread has taken it
+		return STATE_MENU_CHANGED;
 	}
 	return STATE_NO_CHANGE;
 }
@@ -128,11 +209,11 @@ static state_t play_button_clicked(void)
 {
 	Simulation *sim = stgs.simulation;
 	if (is_simulation_running(sim)) {
-		simulation_halt(sim);
+		engine_command(ENGINE_PAUSE);
 		return STATE_MENU_CHANGED;
 	}
 	if (sim && has_enough_colors(sim->colors)) {
-		simulation_run(sim);
+		engine_command(ENGINE_PLAY);
 		return STATE_MENU_CHANGED;
 	}
 	return STATE_NO_CHANGE;
@@ -143,17 +224,15 @@ static state_t stop_button_clicked(void)
 	return has_simulation_started(stgs.simulation) ? reset_simulation() : clear_simulation();
 }
 
-static inline void set_pending_action(pending_func_t func, const char *filename)
+static inline void set_pending_action(pending_func_t func, const void *arg)
 {
 	pending_action.func = func;
-	pending_action.arg = (void *)filename;
+	pending_action.arg = (void *)arg;
 }
 
-static state_t load_sim_action(void *arg)
+static state_t set_loaded_simulation(Simulation *sim)
 {
-	char *filename = arg;
-	Simulation *sim;
-	if ((sim = load_simulation(filename))) {
+	if (sim) {
 		load_status = STATUS_SUCCESS;
 		return set_simulation(sim);
 	} else {
@@ -162,36 +241,136 @@ static state_t load_sim_action(void *arg)
 	}
 }
 
+/* Drops the load in progress, a newer one having taken its place */
+static void cancel_load(void)
+{
+	Simulation *sim;
+	if (active_load) {
+		load_job_cancel(active_load);
+		load_job_wait(active_load, &sim);  // Stops at the next row
+		active_load = NULL;
+		load_progress = 0;
+	}
+}
+
+static state_t start_load(const char *filename)
+{
+	cancel_load();
+	active_load = load_job_start(filename);
+	load_status = active_load ? STATUS_PENDING : STATUS_FAILURE;  // Swapped in once polled as done
+	return STATE_MENU_CHANGED;
+}
+
+static state_t load_embedded_action(void *arg)
+{
+	const EmbeddedFile *file = arg;
+	cancel_load();
+	return set_loaded_simulation(load_simulation_memory(file->data, file->size));
+}
+
+static const EmbeddedFile *find_embedded_example(const char *filename)
+{
+	size_t i;
+#if GALLERY_MODE
+	if (filename == USER_FILE) {
+		return NULL;  // Saved over from the menu, read it from disk
+	}
+#endif
+	for (i = 0; i < embedded_example_count; i++) {
+		if (!strcmp(embedded_examples[i].name, filename)) {
+			return &embedded_examples[i];
+		}
+	}
+	return NULL;
+}
+
+static state_t load_example_now(const char *filename)
+{
+	const EmbeddedFile *file;
+	if (!(file = find_embedded_example(filename))) {
+		return start_load(filename);
+	}
+	set_pending_action(load_embedded_action, file);  // No file I/O or parsing
+	load_status = STATUS_PENDING;
+	return STATE_MENU_CHANGED;
+}
+
+#if GALLERY_MODE
+
+/* Starts loading the given example into the standby slot, unless it's the one saved from the menu */
+static void prefetch_example(int index)
+{
+	const char *filename = example_files[index];
+	if (standby) {
+		prefetch_discard(standby);
+		standby = NULL;
+	}
+	standby_index = index;
+	if (filename != USER_FILE) {
+		standby = prefetch_start(filename, find_embedded_example(filename), PREFETCH_STEPS, PREFETCH_BUDGET);
+	}
+}
+
+static state_t take_standby_action(void *arg)
+{
+	const char *filename = arg;
+	Simulation *sim = prefetch_take(standby);  // Usually loaded by now
+	const EmbeddedFile *file;
+
+	standby = NULL;
+	if (sim) {
+		cancel_load();
+		return set_loaded_simulation(sim);  // Only a pointer swap
+	}
+	if ((file = find_embedded_example(filename))) {  // Failed or outgrew the budget, load it anew
+		return load_embedded_action((void *)file);
+	}
+	return start_load(filename);
+}
+
+#endif  // GALLERY_MODE
+
 static state_t load_example(int index) {
-	static int cycle_index = 0;
 	if (index < 0) {
 		index = cycle_index;
 		cycle_index = (cycle_index+1) % LEN(example_files);
+#if GALLERY_MODE
+		if (standby && standby_index == index) {
+			set_pending_action(take_standby_action, example_files[index]);
+			load_status = STATUS_PENDING;
+			return STATE_MENU_CHANGED;
+		}
+#endif
 	} else if (index >= (int)LEN(example_files)) {
 		return STATE_NO_CHANGE;
 	}
-	set_pending_action(load_sim_action, example_files[index]);
-	load_status = STATUS_PENDING;
-	return STATE_MENU_CHANGED;
+	return load_example_now(example_files[index]);
+}
+
+#if !GALLERY_MODE
+static state_t load_file_entered(const char *filename)
+{
+	if (!filename) {
+		load_status = STATUS_FAILURE;
+		return STATE_MENU_CHANGED;
+	}
+	return start_load(filename);
 }
+#endif
 
 static state_t load_button_clicked(bool input)
 {
-	static char filename[FILENAME_SZ];
+	if (active_load) {
+		load_job_cancel(active_load);  // Pressed again while busy, reported once polled
+		return STATE_NO_CHANGE;
+	}
 	if (input) {
 #if GALLERY_MODE
-		strcpy(filename, USER_FILE);
+		return start_load(USER_FILE);
 #else
-		if (read_filename(filename)) {
-#endif
-			set_pending_action(load_sim_action, filename);
-			load_status = STATUS_PENDING;
-#if !GALLERY_MODE
-		} else {
-			load_status = STATUS_FAILURE;
-		}
-#endif
+		read_filename(load_file_entered);
 		return STATE_MENU_CHANGED;
+#endif
 	}
 	return load_example(-1);
 }
@@ -201,36 +380,93 @@ static state_t load_button_clicked(bool input)
 static state_t save_sim_action(void *arg)
 {
 	char *filename = arg;
-	if (save_simulation(filename, stgs.simulation) != EOF) {
-		save_status = STATUS_SUCCESS;
-		strcat(filename, ".bmp");
-		save_grid_bitmap(filename, stgs.simulation->grid);
-	} else {
+	active_save = save_job_start(filename, stgs.simulation, stgs.text_saves, true);
+	save_status = active_save ? STATUS_PENDING : STATUS_FAILURE;  // Until polled as done
+	return STATE_MENU_CHANGED;
+}
+
+static state_t save_file_entered(const char *filename)
+{
+	static char name[FILENAME_SZ];  // Read by the pending action
+	if (!filename) {
 		save_status = STATUS_FAILURE;
+		return STATE_MENU_CHANGED;
 	}
+	snprintf(name, sizeof name, "%s", filename);
+	set_pending_action(save_sim_action, name);
+	save_status = STATUS_PENDING;
 	return STATE_MENU_CHANGED;
 }
 
 static state_t save_button_clicked(void)
 {
-	static char filename[FILENAME_SZ];
+	if (active_save) {
+		save_job_cancel(active_save);  // One save at a time, pressed again to stop it
+		return STATE_NO_CHANGE;
+	}
 #if GALLERY_MODE
-	strcpy(filename, USER_FILE);
+	return save_file_entered(USER_FILE);
 #else
-	if (read_filename(filename)) {
-#endif
-		set_pending_action(save_sim_action, filename);
-		save_status = STATUS_PENDING;
-#if !GALLERY_MODE
-	} else {
-		save_status = STATUS_FAILURE;
-	}
-#endif
+	read_filename(save_file_entered);
 	return STATE_MENU_CHANGED;
+#endif
 }
 
 #endif  // SAVE_ENABLE
 
+static inline IOStatus job_status(JobResult result)
+{
+	return (result == JOB_DONE) ? STATUS_SUCCESS : (result == JOB_FAILED) ? STATUS_FAILURE : STATUS_NONE;
+}
+
+static state_t poll_save_job(void)
+{
+	JobResult result;
+	if ((result = save_job_poll(active_save)) == JOB_RUNNING) {
+		unsigned old_progress = save_progress;
+		save_progress = save_job_progress(active_save);
+		return (save_progress != old_progress) ? STATE_MENU_CHANGED : STATE_NO_CHANGE;
+	}
+	active_save = NULL;
+	save_progress = 0;
+	save_status = job_status(result);
+	return STATE_MENU_CHANGED;
+}
+
+static state_t poll_load_job(void)
+{
+	Simulation *sim;
+	JobResult result;
+	state_t ret;
+
+	if ((result = load_job_poll(active_load, &sim)) == JOB_RUNNING) {
+		unsigned old_progress = load_progress;
+		load_progress = load_job_progress(active_load);
+		return (load_progress != old_progress) ? STATE_MENU_CHANGED : STATE_NO_CHANGE;
+	}
+	active_load = NULL;
+	load_progress = 0;
+	if (result == JOB_CANCELLED) {
+		load_status = STATUS_NONE;
+		return STATE_MENU_CHANGED;
+	}
+	engine_lock();
+	ret = set_loaded_simulation(sim);  // The engine moves on to it in one go
+	engine_unlock();
+	return ret;
+}
+
+state_t poll_io_jobs(void)
+{
+#if GALLERY_MODE
+	if (standby_index != cycle_index) {
+		prefetch_example(cycle_index);  // Next in the cycle, ahead of the button press
+	}
+#endif
+	return (active_load ? poll_load_job() : STATE_NO_CHANGE)
+	     | (active_save ? poll_save_job() : STATE_NO_CHANGE);
+}
+
 state_t menu_key_command(int key, MEVENT *mouse)
 {
 	switch (key) {
@@ -409,3 +645,52 @@ state_t menu_mouse_command(MEVENT *mouse)
 
 	return STATE_NO_CHANGE;
 }
+
+state_t menu_remote_command(const ControlCommand *cmd, const char **error)
+{
+	Simulation *sim = stgs.simulation;
+	state_t ret;
+
+	*error = NULL;
+	switch (cmd->type) {
+	case CONTROL_PAUSE:
+		return is_simulation_running(sim) ? play_button_clicked() : STATE_NO_CHANGE;
+	case CONTROL_RUN:
+		if (is_simulation_running(sim)) {
+			return STATE_NO_CHANGE;
+		}
+		if (!(ret = play_button_clicked())) {
+			*error = "not enough colors to run";
+		}
+		return ret;
+	case CONTROL_SPEED:
+		if (cmd->value < LOOP_MIN_SPEED || cmd->value > LOOP_TOP_SPEED) {
+			*error = "speed out of range";
+			return STATE_NO_CHANGE;
+		}
+		return speed_button_clicked((int)cmd->value - (int)stgs.speed);
+	case CONTROL_LOAD:
+		ret = start_load(cmd->arg);  // Replaces one in progress, as a key press would
+		if (!active_load) {
+			*error = "couldn't start loading";
+		}
+		return ret;
+	case CONTROL_SAVE:
+#if SAVE_ENABLE
+		if (active_save) {
+			*error = "already saving";
+			return STATE_NO_CHANGE;
+		}
+		ret = save_sim_action((void *)cmd->arg);  // Copied by the save job
+		if (!active_save) {
+			*error = "couldn't start saving";
+		}
+		return ret;
+#else
+		*error = "saving is disabled";
+		return STATE_NO_CHANGE;
+#endif
+	}
+	*error = "unknown command";
+	return STATE_NO_CHANGE;
+}
@@ -1,4 +1,5 @@
 #include "graphics.h"
+#include "io.h"
 #include "version.h"
 
 #include <assert.h>
@@ -8,6 +9,7 @@
 WINDOW        *menuw;
 Settings       stgs;
 IOStatus       load_status, save_status;
+unsigned       load_progress, save_progress;
 PendingAction  pending_action;
 
 const Vector2i  menu_pos              = { 0,                  GRID_WINDOW_SIZE };
@@ -37,6 +39,9 @@ static const Vector2i  dir_msg_pos    = { MENU_DIRECTION_Y,    MENU_RIGHT_COL_X
 static const Vector2i  stepup_msg_pos = { MENU_STEPUP_Y,       MENU_RIGHT_COL_X };
 static const Vector2i  speed_pos      = { MENU_SPEED_Y+2,      MENU_RIGHT_COL_X+13 };
 static const Vector2i  speed_msg_pos  = { MENU_SPEED_Y,        MENU_RIGHT_COL_X };
+static const Vector2i  turbo_msg_pos  = { MENU_SPEED_Y+3,      MENU_RIGHT_COL_X };
+static const Vector2i  rate_msg_pos   = { MENU_SPEED_Y+6,      MENU_RIGHT_COL_X };
+static const Vector2i  rate_pos       = { MENU_SPEED_Y+7,      MENU_RIGHT_COL_X };
 static const Vector2i  func_pos       = { MENU_STATE_FUNC_Y+2, MENU_RIGHT_COL_X+3 };
 static const Vector2i  func_msg_pos   = { MENU_STATE_FUNC_Y,   MENU_RIGHT_COL_X };
 static const Vector2i  sparse_msg_pos = { MENU_STATE_FUNC_Y+7, MENU_RIGHT_COL_X };
@@ -50,6 +55,8 @@ static const char *rules_msg          = "COLOR RULES";
 static const char *isize_msg          = "INIT GRID SIZE";
 static const char *dir_msg            = "ANT DIRECTION";
 static const char *speed_msg          = "SIMULATION SPEED";
+static const char *turbo_msg          = "TURBO";
+static const char *rate_msg           = "STEPS/S";
 static const char *stepup_msg         = "STEP BY STEP";
 static const char *func_msg           = "STATE FUNCTION";
 static const char *sparse_msg         = "[SPARSE MATRIX]";
@@ -121,6 +128,17 @@ static unsigned logo_index;
 
 static unsigned state_map[COLOR_COUNT];
 
+#define WIDGET_INIT(d, k)  { .draw = d, .key = k, .dirty = true }
+
+typedef unsigned long  widget_key_t;
+
+typedef struct widget {
+	void          (*draw)(void);  /**< Draws the widget into menuw */
+	widget_key_t  (*key)(void);   /**< Digest of the state the widget depends on */
+	widget_key_t    last_key;     /**< Key at the time of the last draw */
+	bool            dirty;        /**< Forced redraw on the next pass */
+} Widget;
+
 void init_menu_window(void)
 {
 	menuw = newwin(MENU_WINDOW_HEIGHT, MENU_WINDOW_WIDTH, menu_pos.y, menu_pos.x);
@@ -378,7 +396,8 @@ static void draw_speed(void)
 {
 	int mult = MENU_SPEED_HEIGHT / 8;
 	int dy = menu_speed_d_pos.y - menu_speed_u_pos.y - 2/mult;
-	Vector2i slider_pos = { speed_pos.y + dy - mult*stgs.speed, speed_pos.x };
+	unsigned speed = MIN(stgs.speed, LOOP_MAX_SPEED);  // Turbo tiers sit at the top
+	Vector2i slider_pos = { speed_pos.y + dy - mult*(int)speed, speed_pos.x };
 
 	wattrset(menuw, bg_pair);
 	draw_rect(menuw, speed_pos, SPRITE_DIGIT_WIDTH, MENU_SPEED_HEIGHT+SPRITE_DIGIT_HEIGHT-1);
@@ -391,8 +410,13 @@ static void draw_speed(void)
 	wattrset(menuw, fg_pair);
 	mvwvline(menuw, slider_pos.y+1, slider_pos.x-3, CHAR_FULL, 3);
 
-	/* Draw speed value */
-	draw_sprite(menuw, ui_sprite(UI_DIGIT, stgs.speed), slider_pos);
+	/* Draw speed value, or the turbo tier */
+	if (IS_TURBO_SPEED(stgs.speed)) {
+		wattrset(menuw, PAIR_FOR(MENU_ACTIVE_COLOR));
+		draw_sprite(menuw, ui_sprite(UI_DIGIT, stgs.speed - LOOP_MAX_SPEED), slider_pos);
+	} else {
+		draw_sprite(menuw, ui_sprite(UI_DIGIT, stgs.speed), slider_pos);
+	}
 
 	/* Draw arrow buttons */
 	wattrset(menuw, PAIR_FOR(MENU_ACTIVE_COLOR));
@@ -400,6 +424,39 @@ static void draw_speed(void)
 	draw_sprite(menuw, ui_sprite(UI_ARROW, DIR_DOWN), menu_speed_d_pos);
 }
 
+/* Formats a steps/s figure in at most 4 characters and a unit, e.g. 950, 12k, 3.4M */
+static void format_rate(char *str, unsigned rate)
+{
+	static const char units[] = "kMG";
+	double value = rate;
+	int unit = -1;
+
+	while (value >= 999.5 && unit < 2) {
+		value /= 1000, unit++;
+	}
+	if (unit < 0) {
+		sprintf(str, "%u", rate);
+	} else {
+		sprintf(str, (value < 9.95) ? "%.1f%c" : "%.0f%c", value, units[unit]);
+	}
+}
+
+static void draw_rate(void)
+{
+	EngineView view;
+	char str[MENU_RATE_LEN+1] = "";
+
+	engine_view(&view);
+	if (view.rate) {
+		format_rate(str, view.rate);
+	}
+	wattrset(menuw, fg_pair);
+	mvwprintw(menuw, turbo_msg_pos.y, turbo_msg_pos.x, "%-" STR(MENU_RATE_LEN) "s",
+	          IS_TURBO_SPEED(stgs.speed) ? turbo_msg : "");
+	mvwprintw(menuw, rate_msg_pos.y, rate_msg_pos.x, "%-" STR(MENU_RATE_LEN) "s", view.rate ? rate_msg : "");
+	mvwprintw(menuw, rate_pos.y, rate_pos.x, "%-" STR(MENU_RATE_LEN) "s", str);
+}
+
 static void draw_state_func(void)
 {
 	Simulation *sim = stgs.simulation;
@@ -456,7 +513,13 @@ static void draw_control_buttons(void)
 	}
 }
 
-static void draw_io_button(Vector2i pos, const char **label, IOStatus status, bool draw_status)
+/* Rows of the status bar a job's progress fills */
+static inline int io_progress_rows(unsigned progress)
+{
+	return (int)(MIN(progress, JOB_PROGRESS_MAX) * MENU_BUTTON_HEIGHT / JOB_PROGRESS_MAX);
+}
+
+static void draw_io_button(Vector2i pos, const char **label, IOStatus status, unsigned progress, bool draw_status)
 {
 	Vector2i inner_pos  = { pos.y+1, pos.x+1 };
 	Vector2i text_pos   = { pos.y+2, pos.x+2 };
@@ -480,19 +543,24 @@ static void draw_io_button(Vector2i pos, const char **label, IOStatus status, bo
 		chtype ch = (status == STATUS_SUCCESS) ? PAIR_FOR(COLOR_LIME) | CHAR_FULL
 		          : (status == STATUS_FAILURE) ? PAIR_FOR(COLOR_RED)  | CHAR_FULL
 		          : CHAR_SEMI;
-		mvwvline(menuw, pos.y, pos.x+MENU_BUTTON_WIDTH, ch, MENU_BUTTON_HEIGHT);
+		int filled = (status == STATUS_PENDING) ? io_progress_rows(progress) : 0;
+		mvwvline(menuw, pos.y, pos.x+MENU_BUTTON_WIDTH, ch, MENU_BUTTON_HEIGHT - filled);
+		if (filled) {  // Progress fills the bar from the bottom up
+			mvwvline(menuw, pos.y+MENU_BUTTON_HEIGHT-filled, pos.x+MENU_BUTTON_WIDTH,
+			         PAIR_FOR(MENU_PROGRESS_COLOR) | CHAR_FULL, filled);
+		}
 	}
 }
 
 static void draw_io_buttons(void)
 {
 #if !SAVE_ENABLE && GALLERY_MODE
-	draw_io_button(menu_load_pos, load_label, load_status, false);
+	draw_io_button(menu_load_pos, load_label, load_status, load_progress, false);
 #else
-	draw_io_button(menu_load_pos, load_label, load_status, true);
+	draw_io_button(menu_load_pos, load_label, load_status, load_progress, true);
 #endif
 #if SAVE_ENABLE
-	draw_io_button(menu_save_pos, save_label, save_status, true);
+	draw_io_button(menu_save_pos, save_label, save_status, save_progress, true);
 #endif
 }
 
@@ -547,36 +615,198 @@ static void draw_labels(void)
 	mvwaddstr(menuw, steps_msg_pos.y,  steps_msg_pos.x,  steps_msg);
 }
 
-void draw_menu_full(void)
+static inline widget_key_t key_mix(widget_key_t key, widget_key_t value)
 {
-	draw_logo();
-	draw_border();
-	draw_color_rules();
-	draw_init_size();
-	draw_direction();
-	draw_stepup();
-	draw_speed();
-	draw_state_func();
-	draw_control_buttons();
-	draw_io_buttons();
-	draw_size();
-	draw_steps();
-	draw_labels();
-	wnoutrefresh(menuw);
+	return key*31 + value;
+}
 
-	if (dialogw) {
-		draw_dialog();
+static widget_key_t logo_key(void)
+{
+	return logo_index;
+}
+
+static widget_key_t border_key(void)
+{
+	Simulation *sim = stgs.simulation;
+	return sim && is_grid_sparse(sim->grid);
+}
+
+static widget_key_t rules_key(void)
+{
+	Colors *colors = stgs.colors;
+	widget_key_t key = 0;
+	color_t i;
+
+	if (!colors) {
+		return 0;
+	}
+	for (i = 0; i < COLOR_COUNT; i++) {
+		key = key_mix(key, (widget_key_t)colors->next[i]);
+		key = key_mix(key, (widget_key_t)colors->turn[i]);
 	}
+	key = key_mix(key, (widget_key_t)colors->first);
+	key = key_mix(key, (widget_key_t)colors->last);
+	key = key_mix(key, (widget_key_t)colors->def);
+	return key_mix(key, colors->n);
 }
 
-void draw_menu_iter(void)
+static widget_key_t init_size_key(void)
 {
-	draw_dir_arrow();
-	draw_state_func();
-	draw_steps();
-	wnoutrefresh(menuw);
+	return stgs.init_size;
+}
+
+static widget_key_t direction_key(void)
+{
+	return stgs.simulation->ant->dir;
+}
+
+static widget_key_t stepup_key(void)
+{
+	return has_enough_colors(stgs.colors);
+}
+
+static widget_key_t speed_key(void)
+{
+	return stgs.speed;
+}
+
+static widget_key_t rate_key(void)
+{
+	EngineView view;
+	char str[MENU_RATE_LEN+1], *c;
+	widget_key_t key = IS_TURBO_SPEED(stgs.speed);
+
+	engine_view(&view);
+	format_rate(str, view.rate);
+	for (c = str; *c; c++) {
+		key = key_mix(key, (widget_key_t)*c);  // Redrawn only when the text changes
+	}
+	return key_mix(key, view.rate > 0);
+}
 
-	if (dialogw) {  // TODO: Replace with panel
-		draw_dialog();
+static widget_key_t state_func_key(void)
+{
+	Simulation *sim = stgs.simulation;
+	color_t ant_color = GRID_ANT_COLOR(sim->grid, sim->ant);
+	color_t next_color = sim->colors->next[ant_color];
+	widget_key_t key = (widget_key_t)ant_color;
+
+	key = key_mix(key, (widget_key_t)next_color);
+	key = key_mix(key, (widget_key_t)sim->colors->turn[ant_color]);
+	key = key_mix(key, state_map[ant_color]);
+	return key_mix(key, state_map[next_color]);
+}
+
+static widget_key_t controls_key(void)
+{
+	widget_key_t key = is_simulation_running(stgs.simulation);
+	key = key_mix(key, has_simulation_started(stgs.simulation));
+	key = key_mix(key, has_enough_colors(stgs.colors));
+	return key_mix(key, is_colors_empty(stgs.colors));
+}
+
+static widget_key_t io_buttons_key(void)
+{
+	widget_key_t key = key_mix(load_status, save_status);
+	key = key_mix(key, io_progress_rows(load_progress));
+	return key_mix(key, io_progress_rows(save_progress));
+}
+
+static widget_key_t size_key(void)
+{
+	Simulation *sim = stgs.simulation;
+	return sim ? sim->grid->size : 0;
+}
+
+static widget_key_t steps_key(void)
+{
+	Simulation *sim = stgs.simulation;
+	return sim ? sim->steps : 0;
+}
+
+static widget_key_t labels_key(void)
+{
+	return 0;
+}
+
+/* Drawing order matters: state function depends on state_map from color rules */
+static Widget widgets[_MW_COUNT] = {
+	[MW_LOGO]       = WIDGET_INIT(draw_logo,            logo_key),
+	[MW_BORDER]     = WIDGET_INIT(draw_border,          border_key),
+	[MW_RULES]      = WIDGET_INIT(draw_color_rules,     rules_key),
+	[MW_INIT_SIZE]  = WIDGET_INIT(draw_init_size,       init_size_key),
+	[MW_DIRECTION]  = WIDGET_INIT(draw_direction,       direction_key),
+	[MW_STEPUP]     = WIDGET_INIT(draw_stepup,          stepup_key),
+	[MW_SPEED]      = WIDGET_INIT(draw_speed,           speed_key),
+	[MW_RATE]       = WIDGET_INIT(draw_rate,            rate_key),
+	[MW_STATE_FUNC] = WIDGET_INIT(draw_state_func,      state_func_key),
+	[MW_CONTROLS]   = WIDGET_INIT(draw_control_buttons, controls_key),
+	[MW_IO_BUTTONS] = WIDGET_INIT(draw_io_buttons,      io_buttons_key),
+	[MW_SIZE]       = WIDGET_INIT(draw_size,            size_key),
+	[MW_STEPS]      = WIDGET_INIT(draw_steps,           steps_key),
+	[MW_LABELS]     = WIDGET_INIT(draw_labels,          labels_key),
+};
+static bool menu_touched;
+
+void menu_invalidate(MenuWidgetType type)
+{
+	assert(type >= 0 && type < _MW_COUNT);
+	widgets[type].dirty = true;
+}
+
+void menu_invalidate_all(void)
+{
+	MenuWidgetType type;
+	for (type = 0; type < _MW_COUNT; type++) {
+		widgets[type].dirty = true;
+	}
+}
+
+void menu_invalidate_area(Vector2i top_left, unsigned height)
+{
+	int y = MAX(top_left.y, 0);
+	int n = MIN(top_left.y + (int)height, MENU_WINDOW_HEIGHT) - y;
+	if (n > 0) {
+		touchline(menuw, y, n);  // Contents are intact, only recopy to screen
+		menu_touched = true;
+	}
+}
+
+static void draw_menu_widgets(void)
+{
+	Widget *w;
+	widget_key_t key;
+	bool drawn = menu_touched;
+
+	for (w = widgets; w < widgets + _MW_COUNT; w++) {
+		key = (*w->key)();
+		if (w->dirty || key != w->last_key) {
+			(*w->draw)();
+			w->last_key = key;
+			w->dirty = false;
+			drawn = true;
+		}
+	}
+	if (drawn) {
+		wnoutrefresh(menuw);
+		menu_touched = false;
 	}
+
+	if (dialogw) {
+		update_dialog(drawn);
+	}
+	if (inputw) {
+		update_input(drawn);
+	}
+}
+
+void draw_menu_full(void)
+{
+	menu_invalidate_all();
+	draw_menu_widgets();
+}
+
+void draw_menu_iter(void)
+{
+	draw_menu_widgets();
 }
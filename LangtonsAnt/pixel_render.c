@@ -0,0 +1,519 @@
+#include "graphics.h"
+#include "io.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#	include <sys/ioctl.h>
+#	include <unistd.h>
+#endif
+
+typedef enum {
+	PIXEL_SIXEL,
+	PIXEL_KITTY,
+} PixelProtocol;
+
+static struct pixel_state {
+	bool           active;             /**< False if setup failed, falls back to curses */
+	PixelProtocol  protocol;
+	color_t        ant_color, bg_color;
+	int            cell_w, cell_h;     /**< Terminal character size in pixels */
+	int            width, height;      /**< Image area in pixels */
+	int            tiles_x, tiles_y;   /**< Image area in tiles */
+	byte          *curr, *prev;        /**< Palette indices, width*height each */
+	bool          *dirty;              /**< Tiles that may have changed */
+	bool           any_dirty;
+	ttime_t        emit_time;
+
+	Grid          *grid;               /**< Grid the view was computed for */
+	unsigned       grid_size;
+	Vector2i       view_tl;            /**< Top left cell of the square view */
+	int            view_side;          /**< In cells */
+	int            side, off_y, off_x; /**< Placement of the view in pixels */
+
+	char          *row;                /**< Scratch for grid_read_row and sixel lines */
+	size_t         row_cap;
+	char          *out;                /**< Escape sequences for one frame */
+	size_t         out_len, out_cap;
+} px;
+
+#define TILE_W  (PIXEL_TILE_CHARS * px.cell_w)
+#define TILE_H  (PIXEL_TILE_CHARS * px.cell_h)
+
+/*------------------------------ Output buffer -------------------------------*/
+
+static void out_reserve(size_t n)
+{
+	if (px.out_len + n > px.out_cap) {
+		size_t cap = MAX(px.out_cap*2, px.out_len + n);
+		char *out = realloc(px.out, cap);
+		if (!out) {
+			px.active = false;
+			return;
+		}
+		px.out = out, px.out_cap = cap;
+	}
+}
+
+static void out_write(const char *data, size_t n)
+{
+	out_reserve(n);
+	if (px.active) {
+		memcpy(px.out + px.out_len, data, n);
+		px.out_len += n;
+	}
+}
+
+static void out_printf(const char *fmt, int a, int b, int c)
+{
+	char buf[64];
+	int n = snprintf(buf, sizeof buf, fmt, a, b, c);
+	out_write(buf, (size_t)n);
+}
+
+static void out_flush(void)
+{
+	if (px.out_len) {
+		fwrite(px.out, 1, px.out_len, stdout);
+		fflush(stdout);
+		px.out_len = 0;
+	}
+}
+
+/*--------------------------------- Encoders ---------------------------------*/
+
+static void sixel_run(char ch, int run)
+{
+	if (run > 3) {
+		out_printf("!%d%c", run, ch, 0);
+	} else {
+		while (run--) {
+			out_write(&ch, 1);
+		}
+	}
+}
+
+static void encode_sixel(int x0, int y0, int w, int h)
+{
+	bool used[COLOR_COUNT] = { false };
+	int y, x, c, band;
+
+	for (y = y0; y < y0+h; y++) {
+		for (x = x0; x < x0+w; x++) {
+			used[px.curr[y*px.width + x]] = true;
+		}
+	}
+
+	// 1:1 aspect ratio, explicit size so the last band is cropped
+	out_printf("\033P0;1;0q\"1;1;%d;%d", w, h, 0);
+	for (c = 0; c < COLOR_COUNT; c++) {
+		if (used[c]) {
+			const byte *bgr = color_map[c];
+			out_printf("#%d;2;%d", c, bgr[2]*100/255, 0);
+			out_printf(";%d;%d", bgr[1]*100/255, bgr[0]*100/255, 0);
+		}
+	}
+
+	for (band = y0; band < y0+h; band += 6) {
+		int rows = MIN(6, y0+h - band);
+		bool first = true;
+		for (c = 0; c < COLOR_COUNT; c++) {
+			char *line = px.row, run_ch;
+			int end = 0, run, i;
+			if (!used[c]) {
+				continue;
+			}
+			for (x = 0; x < w; x++) {
+				int bits = 0;
+				for (i = 0; i < rows; i++) {
+					bits |= (px.curr[(band+i)*px.width + x0+x] == c) << i;
+				}
+				line[x] = (char)('?' + bits);
+				end = bits ? x+1 : end;  // Trailing blanks are implied
+			}
+			if (!end) {
+				continue;
+			}
+
+			out_printf(first ? "#%d" : "$#%d", c, 0, 0);  // $ returns to start of band
+			first = false;
+			for (x = 1, run_ch = line[0], run = 1; x < end; x++) {
+				if (line[x] == run_ch) {
+					run++;
+				} else {
+					sixel_run(run_ch, run);
+					run_ch = line[x], run = 1;
+				}
+			}
+			sixel_run(run_ch, run);
+		}
+		out_write("-", 1);
+	}
+	out_write("\033\\", 2);
+}
+
+static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static void encode_kitty(int x0, int y0, int w, int h, int id)
+{
+	size_t n = (size_t)w*h*3, i = 0, chunk;
+	byte *rgb = malloc(n), *p = rgb;
+	int y, x;
+
+	if (!rgb) {
+		return;
+	}
+	for (y = y0; y < y0+h; y++) {
+		for (x = x0; x < x0+w; x++) {
+			const byte *bgr = color_map[px.curr[y*px.width + x]];
+			*p++ = bgr[2], *p++ = bgr[1], *p++ = bgr[0];
+		}
+	}
+
+	// Same image and placement id replaces the tile in place, C=1 keeps the cursor still
+	out_printf("\033_Gf=24,a=T,t=d,s=%d,v=%d,i=%d", w, h, id);
+	out_write(",p=1,q=2,C=1", 12);
+	for (i = 0; i < n; i += chunk) {
+		size_t j;
+		chunk = MIN(n - i, PIXEL_KITTY_CHUNK / 4 * 3);  // Multiple of 3, no padding until the end
+		out_printf(i ? "\033_Gm=%d;" : ",m=%d;", i + chunk < n, 0, 0);
+		out_reserve((chunk+2) / 3 * 4);
+		if (!px.active) {
+			break;
+		}
+		for (j = i; j < i+chunk; j += 3) {
+			unsigned v = rgb[j] << 16 | ((j+1 < i+chunk) ? rgb[j+1] << 8 : 0)
+			                          | ((j+2 < i+chunk) ? rgb[j+2] : 0);
+			char *o = px.out + px.out_len;
+			o[0] = b64[v >> 18 & 63];
+			o[1] = b64[v >> 12 & 63];
+			o[2] = (j+1 < i+chunk) ? b64[v >> 6 & 63] : '=';
+			o[3] = (j+2 < i+chunk) ? b64[v & 63] : '=';
+			px.out_len += 4;
+		}
+		out_write("\033\\", 2);
+	}
+	free(rgb);
+}
+
+/*---------------------------------- View ------------------------------------*/
+
+static void mark_all_dirty(void)
+{
+	memset(px.dirty, true, (size_t)px.tiles_x * px.tiles_y);
+	px.any_dirty = true;
+}
+
+/* Frames the whole grid while it fits at one pixel per cell, otherwise the
+ * bounding box with some room to grow so the view doesn't change every step */
+static bool update_view(Grid *grid)
+{
+	int S = MIN(px.width, px.height);
+	Vector2i tl = grid->top_left, br = grid->bottom_right;
+	Vector2i vtl = px.view_tl;
+	int vs = px.view_side;
+
+	if (grid == px.grid && grid->size == px.grid_size
+	 && tl.y >= vtl.y && tl.x >= vtl.x && br.y < vtl.y+vs && br.x < vtl.x+vs) {
+		return false;
+	}
+
+	if ((int)grid->size <= S) {
+		vtl.y = vtl.x = 0, vs = grid->size;
+	} else {
+		int h = br.y - tl.y + 1, w = br.x - tl.x + 1;
+		vs = MIN(MAX(h, w) * 3/2, (int)grid->size);
+		vtl.y = tl.y + h/2 - vs/2;
+		vtl.x = tl.x + w/2 - vs/2;
+	}
+
+	px.grid = grid, px.grid_size = grid->size;
+	px.view_tl = vtl, px.view_side = vs;
+	px.side = (vs <= S) ? S / vs * vs : S;  // Whole blocks when magnifying
+	px.off_y = (px.height - px.side) / 2;
+	px.off_x = (px.width - px.side) / 2;
+	return true;
+}
+
+/* Pixel range [*p0, *p1] that samples cell offset c, empty if p1 < p0 */
+static void cell_pixels(int c, int *p0, int *p1)
+{
+	int S = px.side, V = px.view_side;
+	*p0 = (c*S + V-1) / V;
+	*p1 = ((c+1)*S + V-1) / V - 1;
+}
+
+static void mark_cell_dirty(Vector2i pos)
+{
+	int y0, y1, x0, x1, ty, tx;
+
+	if (!px.grid) {
+		return;
+	}
+	cell_pixels(pos.y - px.view_tl.y, &y0, &y1);
+	cell_pixels(pos.x - px.view_tl.x, &x0, &x1);
+	if (y1 < y0 || x1 < x0 || y0 < 0 || x0 < 0 || y1 >= px.side || x1 >= px.side) {
+		return;  // Not sampled or out of view, view update will catch it
+	}
+	for (ty = (px.off_y+y0) / TILE_H; ty <= (px.off_y+y1) / TILE_H; ty++) {
+		for (tx = (px.off_x+x0) / TILE_W; tx <= (px.off_x+x1) / TILE_W; tx++) {
+			px.dirty[ty*px.tiles_x + tx] = true;
+		}
+	}
+	px.any_dirty = true;
+}
+
+static void render_tile(Grid *grid, Ant *ant, int x0, int y0, int w, int h)
+{
+	int V = px.view_side, S = px.side, y, x, prev_cy = INT_MIN;
+	byte *row = (byte *)px.row;
+	int sx0 = MAX(x0 - px.off_x, 0), sx1 = MIN(x0+w - px.off_x, S);
+	int cx0 = (sx0 < sx1) ? (int)((long long)sx0 * V / S) : 0;
+	int cx1 = (sx0 < sx1) ? (int)((long long)(sx1-1) * V / S) : -1;
+
+	for (y = y0; y < y0+h; y++) {
+		byte *out = px.curr + (size_t)y*px.width;
+		int sy = y - px.off_y, cy;
+
+		if (sy < 0 || sy >= S || sx0 >= sx1) {
+			memset(out + x0, px.bg_color, w);
+			continue;
+		}
+		cy = (int)((long long)sy * V / S);
+		if (cy == prev_cy) {
+			memcpy(out + x0, out - px.width + x0, w);
+			continue;
+		}
+		prev_cy = cy;
+
+		if ((size_t)(cx1-cx0+1) > px.row_cap) {
+			char *r = realloc(px.row, cx1-cx0+1);
+			if (!r) {
+				px.active = false;
+				return;
+			}
+			px.row = r, px.row_cap = cx1-cx0+1, row = (byte *)r;
+		}
+
+		grid_read_row(grid, px.view_tl.y + cy, px.view_tl.x + cx0, cx1-cx0+1, (byte *)px.row);
+		if (ant && ant->pos.y == px.view_tl.y + cy) {
+			int ax = ant->pos.x - px.view_tl.x;
+			if (ax >= cx0 && ax <= cx1) {
+				row[ax - cx0] = px.ant_color;
+			}
+		}
+		for (x = x0; x < x0+w; x++) {
+			int sx = x - px.off_x;
+			out[x] = (sx < 0 || sx >= S) ? px.bg_color
+			       : row[(int)((long long)sx * V / S) - cx0];
+		}
+	}
+}
+
+static bool tile_changed(int x0, int y0, int w, int h)
+{
+	int y;
+	for (y = y0; y < y0+h; y++) {
+		size_t i = (size_t)y*px.width + x0;
+		if (memcmp(px.curr + i, px.prev + i, w)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void emit_frame(void)
+{
+	Simulation *sim;
+	int ty, tx;
+
+	/* Sample the dirty tiles while holding the simulation, encode them after letting go */
+	engine_lock();
+	sim = stgs.simulation;
+	if (!sim || !sim->grid) {
+		engine_unlock();
+		return;
+	}
+	if (update_view(sim->grid)) {
+		mark_all_dirty();
+	}
+	for (ty = 0; ty < px.tiles_y; ty++) {
+		for (tx = 0; tx < px.tiles_x; tx++) {
+			int x0 = tx*TILE_W, y0 = ty*TILE_H;
+			if (px.dirty[ty*px.tiles_x + tx]) {
+				render_tile(sim->grid, sim->ant, x0, y0, MIN(TILE_W, px.width - x0), MIN(TILE_H, px.height - y0));
+			}
+		}
+	}
+	engine_unlock();
+
+	out_write("\0337", 2);  // Save cursor, curses keeps its own idea of it
+	for (ty = 0; ty < px.tiles_y; ty++) {
+		for (tx = 0; tx < px.tiles_x; tx++) {
+			int x0 = tx*TILE_W, y0 = ty*TILE_H;
+			int w = MIN(TILE_W, px.width - x0), h = MIN(TILE_H, px.height - y0), y;
+			if (!px.dirty[ty*px.tiles_x + tx]) {
+				continue;
+			}
+			px.dirty[ty*px.tiles_x + tx] = false;
+
+			if (!tile_changed(x0, y0, w, h)) {
+				continue;
+			}
+			for (y = y0; y < y0+h; y++) {
+				size_t i = (size_t)y*px.width + x0;
+				memcpy(px.prev + i, px.curr + i, w);
+			}
+
+			out_printf("\033[%d;%dH", grid_pos.y + ty*PIXEL_TILE_CHARS + 1,
+			                           grid_pos.x + tx*PIXEL_TILE_CHARS + 1, 0);
+			if (px.protocol == PIXEL_KITTY) {
+				encode_kitty(x0, y0, w, h, ty*px.tiles_x + tx + 1);
+			} else {
+				encode_sixel(x0, y0, w, h);
+			}
+		}
+	}
+	out_write("\0338", 2);
+	px.any_dirty = false;
+
+	if (px.active) {
+		out_flush();
+	}
+}
+
+/*--------------------------------- Backend ----------------------------------*/
+
+static PixelProtocol detect_protocol(void)
+{
+	const char *term = getenv("TERM"), *prog = getenv("TERM_PROGRAM");
+	if (getenv("KITTY_WINDOW_ID") || (term && strstr(term, "kitty"))
+	 || (prog && (!strcmp(prog, "WezTerm") || !strcmp(prog, "ghostty")))) {
+		return PIXEL_KITTY;
+	}
+	return PIXEL_SIXEL;
+}
+
+static void detect_cell_size(void)
+{
+	px.cell_w = PIXEL_DEF_CELL_W, px.cell_h = PIXEL_DEF_CELL_H;
+#ifndef _WIN32
+	struct winsize ws;
+	if (!ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) && ws.ws_col && ws.ws_row
+	 && ws.ws_xpixel && ws.ws_ypixel) {
+		px.cell_w = ws.ws_xpixel / ws.ws_col;
+		px.cell_h = ws.ws_ypixel / ws.ws_row;
+	}
+#endif
+}
+
+static void pixel_init(color_t fg_color, color_t bg_color)
+{
+	size_t n;
+
+	init_graphics(fg_color, bg_color);
+	px = (struct pixel_state) { .ant_color = fg_color, .bg_color = bg_color };
+	px.protocol = detect_protocol();
+	detect_cell_size();  // After initscr, which resizes the terminal
+
+	px.width = GRID_WINDOW_SIZE * px.cell_w;
+	px.height = GRID_WINDOW_SIZE * px.cell_h;
+	px.tiles_x = (GRID_WINDOW_SIZE + PIXEL_TILE_CHARS-1) / PIXEL_TILE_CHARS;
+	px.tiles_y = px.tiles_x;
+	n = (size_t)px.width * px.height;
+
+	px.curr = malloc(n);
+	px.prev = malloc(n);
+	px.dirty = malloc((size_t)px.tiles_x * px.tiles_y);
+	px.row_cap = MAX(px.width, px.height);
+	px.row = malloc(px.row_cap);
+	px.active = px.curr && px.prev && px.dirty && px.row;
+}
+
+static void pixel_end(void)
+{
+	if (px.active && px.protocol == PIXEL_KITTY) {
+		fputs("\033_Ga=d,d=A,q=2\033\\", stdout);  // Delete all placements
+		fflush(stdout);
+	}
+	free(px.curr), free(px.prev), free(px.dirty), free(px.row), free(px.out);
+	px = (struct pixel_state) { .active = false };
+	end_graphics();
+}
+
+static void pixel_draw_region(Grid *grid, Ant *ant)
+{
+	if (!px.active) {
+		draw_grid_full(grid, ant);
+		return;
+	}
+	werase(gridw);  // Text layer stays blank under the image
+	wnoutrefresh(gridw);
+	memset(px.prev, 0xFF, (size_t)px.width * px.height);  // Force re-upload after erase
+	px.grid = NULL;
+	if (grid) {
+		mark_all_dirty();
+	}
+}
+
+static void pixel_draw_cell(Grid *grid, Ant *ant, Vector2i prev_pos)
+{
+	if (!px.active) {
+		draw_grid_iter(grid, ant, prev_pos);
+		return;
+	}
+	mark_cell_dirty(prev_pos);
+	if (ant) {
+		mark_cell_dirty(ant->pos);
+	}
+}
+
+static void pixel_draw_menu(bool full)
+{
+	full ? draw_menu_full() : draw_menu_iter();
+}
+
+static bool pixel_present(void)
+{
+	ttime_t now;
+
+	doupdate();
+	if (!px.active || !px.any_dirty) {
+		return true;
+	}
+	now = timer_micros();
+	if (now - px.emit_time < PIXEL_FRAME_TIME_US) {
+		return false;  // Dirty tiles wait for the next frame
+	}
+	emit_frame();
+	px.emit_time = now;
+	return true;
+}
+
+static int pixel_poll_input(MEVENT *mouse)
+{
+	int key = getch();
+	if (key == KEY_MOUSE && getmouse(mouse) == ERR) {
+		mouse->bstate = 0;
+	}
+	return key;
+}
+
+static void pixel_flush_input(void)
+{
+	flushinp();
+}
+
+const RenderBackend pixel_backend = {
+	.name        = "pixel",
+	.init        = pixel_init,
+	.end         = pixel_end,
+	.draw_region = pixel_draw_region,
+	.draw_cell   = pixel_draw_cell,
+	.draw_menu   = pixel_draw_menu,
+	.present     = pixel_present,
+	.poll_input  = pixel_poll_input,
+	.flush_input = pixel_flush_input,
+};
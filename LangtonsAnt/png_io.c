@@ -0,0 +1,430 @@
+#include "io.h"
+#include "thread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Deflate limits (RFC 1951) */
+#define DEFLATE_WINDOW    32768U
+#define DEFLATE_MIN_LEN   3U
+#define DEFLATE_MAX_LEN   258U
+#define DEFLATE_STORED    65535U  /**< Max payload of a stored block */
+#define HASH_BITS         15
+#define HASH_SIZE         (1U << HASH_BITS)
+
+typedef struct bit_writer {
+	byte      *out;
+	size_t     len, cap;
+	uint64_t   bits;
+	unsigned   count;
+} BitWriter;
+
+typedef struct png_band {
+	/* Set up by the caller */
+	Grid      *grid;
+	Vector2i   top_left;
+	unsigned   scale, width;  /**< Width in pixels */
+	size_t     line;          /**< Filter byte + packed pixels */
+	unsigned   first, rows;   /**< Output rows covered */
+	bool       last;
+	/* Filled in by the worker */
+	byte      *raw;           /**< Filtered scanlines */
+	BitWriter  bw;
+	uint32_t   adler;
+	bool       ok;
+} PngBand;
+
+/*--------------------------------- Checksums --------------------------------*/
+
+static uint32_t crc_table[256];
+
+static void init_crc_table(void)
+{
+	uint32_t c, n, k;
+	for (n = 0; n < 256; n++) {
+		for (c = n, k = 0; k < 8; k++) {
+			c = (c & 1) ? 0xEDB88320U ^ (c >> 1) : c >> 1;
+		}
+		crc_table[n] = c;
+	}
+}
+
+static uint32_t crc32_update(uint32_t crc, const byte *data, size_t n)
+{
+	size_t i;
+	crc = ~crc;
+	for (i = 0; i < n; i++) {
+		crc = crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+#define ADLER_MOD  65521U
+
+static uint32_t adler32(const byte *data, size_t n)
+{
+	uint32_t a = 1, b = 0;
+	while (n) {
+		size_t k = MIN(n, 5552U);  // Largest run without overflow
+		n -= k;
+		while (k--) {
+			a += *data++;
+			b += a;
+		}
+		a %= ADLER_MOD, b %= ADLER_MOD;
+	}
+	return b << 16 | a;
+}
+
+/* Checksum of the concatenation of two blocks, the second n2 bytes long */
+static uint32_t adler32_combine(uint32_t adler1, uint32_t adler2, size_t n2)
+{
+	uint32_t rem = (uint32_t)(n2 % ADLER_MOD);
+	uint32_t a1 = adler1 & 0xFFFF, b1 = adler1 >> 16;
+	uint32_t a2 = adler2 & 0xFFFF, b2 = adler2 >> 16;
+	uint32_t a = (a1 + a2 + ADLER_MOD - 1) % ADLER_MOD;
+	uint32_t b = (uint32_t)(((uint64_t)rem * a1 + b1 + b2 + ADLER_MOD - rem) % ADLER_MOD);
+	return b << 16 | a;
+}
+
+/*---------------------------------- Deflate ---------------------------------*/
+
+static bool bw_reserve(BitWriter *bw, size_t n)
+{
+	if (bw->len + n > bw->cap) {
+		size_t cap = MAX(bw->cap*2, bw->len + n);
+		byte *out = realloc(bw->out, cap);
+		if (!out) {
+			return false;
+		}
+		bw->out = out, bw->cap = cap;
+	}
+	return true;
+}
+
+/* Caller reserves space, at most 32 bits at a time */
+static void bw_put(BitWriter *bw, uint32_t value, unsigned n)
+{
+	bw->bits |= (uint64_t)value << bw->count;
+	bw->count += n;
+	while (bw->count >= 8) {
+		bw->out[bw->len++] = (byte)bw->bits;
+		bw->bits >>= 8;
+		bw->count -= 8;
+	}
+}
+
+static void bw_align(BitWriter *bw)
+{
+	if (bw->count) {
+		bw_put(bw, 0, 8 - bw->count);
+	}
+}
+
+static uint32_t reverse_bits(uint32_t code, unsigned n)
+{
+	uint32_t r = 0;
+	while (n--) {
+		r = r << 1 | (code & 1);
+		code >>= 1;
+	}
+	return r;
+}
+
+/* Fixed Huffman literal/length code (RFC 1951, 3.2.6) */
+static void put_litlen(BitWriter *bw, unsigned sym)
+{
+	if (sym < 144) {
+		bw_put(bw, reverse_bits(0x30 + sym, 8), 8);
+	} else if (sym < 256) {
+		bw_put(bw, reverse_bits(0x190 + sym-144, 9), 9);
+	} else if (sym < 280) {
+		bw_put(bw, reverse_bits(sym-256, 7), 7);
+	} else {
+		bw_put(bw, reverse_bits(0xC0 + sym-280, 8), 8);
+	}
+}
+
+static const unsigned short len_base[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const byte len_extra[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const unsigned short dist_base[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const byte dist_extra[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static void put_match(BitWriter *bw, unsigned len, unsigned dist)
+{
+	unsigned l = 28, d = 29;
+	while (len_base[l] > len) {
+		l--;
+	}
+	while (dist_base[d] > dist) {
+		d--;
+	}
+	put_litlen(bw, 257 + l);
+	bw_put(bw, len - len_base[l], len_extra[l]);
+	bw_put(bw, reverse_bits(d, 5), 5);
+	bw_put(bw, dist - dist_base[d], dist_extra[d]);
+}
+
+static unsigned match_len(const byte *data, size_t pos, size_t cand, size_t n)
+{
+	size_t max = MIN(DEFLATE_MAX_LEN, n - pos), len = 0;
+	while (len < max && data[cand+len] == data[pos+len]) {
+		len++;
+	}
+	return (unsigned)len;
+}
+
+/* One fixed Huffman block; matches are tried at the previous byte (runs), the
+ * previous scanline (repeated or scaled rows) and the last hashed occurrence */
+static bool deflate_fixed(BitWriter *bw, const byte *data, size_t n, size_t line, bool final)
+{
+	uint32_t *head = malloc(HASH_SIZE * sizeof(uint32_t));
+	size_t pos = 0;
+
+	if (!head || !bw_reserve(bw, n + n/8 + 16)) {  // 9 bits per literal at worst
+		free(head);
+		return false;
+	}
+	memset(head, 0xFF, HASH_SIZE * sizeof(uint32_t));
+	bw_put(bw, final, 1);
+	bw_put(bw, 1, 2);  // Fixed Huffman
+
+	while (pos < n) {
+		unsigned best = 0, best_dist = 0, len, h = 0;
+		size_t cands[3], i;
+		cands[0] = 1, cands[1] = line;
+		cands[2] = 0;
+		if (pos + DEFLATE_MIN_LEN <= n) {
+			h = ((uint32_t)data[pos] << 16 | data[pos+1] << 8 | data[pos+2]) * 2654435761U >> (32-HASH_BITS);
+			if (head[h] != UINT32_MAX) {
+				cands[2] = pos - head[h];
+			}
+			head[h] = (uint32_t)pos;
+		}
+		for (i = 0; i < 3; i++) {
+			size_t dist = cands[i];
+			if (!dist || dist > pos || dist > DEFLATE_WINDOW) {
+				continue;
+			}
+			len = match_len(data, pos, pos - dist, n);
+			if (len > best) {
+				best = len, best_dist = (unsigned)dist;
+			}
+		}
+		if (best >= DEFLATE_MIN_LEN) {
+			put_match(bw, best, best_dist);
+			pos += best;
+		} else {
+			put_litlen(bw, data[pos++]);
+		}
+	}
+	put_litlen(bw, 256);  // End of block
+	free(head);
+	return true;
+}
+
+/* Empty stored block, byte-aligns the stream so bands can be concatenated */
+static bool deflate_sync(BitWriter *bw, bool final)
+{
+	if (!bw_reserve(bw, 8)) {
+		return false;
+	}
+	bw_put(bw, final, 1);
+	bw_put(bw, 0, 2);
+	bw_align(bw);
+	bw_put(bw, 0x0000, 16);
+	bw_put(bw, 0xFFFF, 16);
+	return true;
+}
+
+static bool deflate_stored(BitWriter *bw, const byte *data, size_t n, bool final)
+{
+	size_t i = 0;
+	do {
+		size_t k = MIN(n - i, DEFLATE_STORED);
+		bool last = final && i + k == n;
+		if (!bw_reserve(bw, k + 8)) {
+			return false;
+		}
+		bw_put(bw, last, 1);
+		bw_put(bw, 0, 2);
+		bw_align(bw);
+		bw_put(bw, (uint32_t)k, 16);
+		bw_put(bw, (uint32_t)~k & 0xFFFF, 16);
+		memcpy(bw->out + bw->len, data + i, k);
+		bw->len += k;
+		i += k;
+	} while (i < n);
+	return true;
+}
+
+/*-------------------------------- Row bands ---------------------------------*/
+
+static void read_scanline(PngBand *b, unsigned y, byte *cells, byte *out)
+{
+	unsigned cw = (b->width + b->scale-1) / b->scale, x;
+	grid_read_row(b->grid, b->top_left.y + (int)(y / b->scale), b->top_left.x, cw, cells);
+	memset(out, 0, b->line - 1);
+	for (x = 0; x < b->width; x++) {
+		out[x/2] |= (cells[x / b->scale] & 0xF) << ((x & 1) ? 0 : 4);
+	}
+}
+
+static void *band_worker(void *arg)
+{
+	PngBand *b = arg;
+	size_t n = b->line - 1, i;
+	byte *cells = malloc(b->width / b->scale + 1), *prev = calloc(n, 1), *curr = malloc(n);
+	unsigned r;
+
+	b->ok = false;
+	b->raw = malloc(b->line * b->rows);
+	if (!cells || !prev || !curr || !b->raw) {
+		goto end;
+	}
+	if (b->first > 0) {
+		read_scanline(b, b->first-1, cells, prev);  // Up filter needs the row above
+	}
+
+	for (r = 0; r < b->rows; r++) {
+		byte *out = b->raw + r*b->line;
+		unsigned long cost_none = 0, cost_up = 0;
+		read_scanline(b, b->first + r, cells, curr);
+
+		/* Pick None or Up, whichever looks cheaper (minimum sum of absolute differences) */
+		for (i = 0; i < n; i++) {
+			cost_none += (curr[i] < 128) ? curr[i] : 256 - curr[i];
+			byte d = (byte)(curr[i] - prev[i]);
+			cost_up += (d < 128) ? d : 256 - d;
+		}
+		out[0] = (cost_up < cost_none) ? 2 : 0;
+		for (i = 0; i < n; i++) {
+			out[1+i] = out[0] ? (byte)(curr[i] - prev[i]) : curr[i];
+		}
+		memcpy(prev, curr, n);
+	}
+
+	b->adler = adler32(b->raw, b->line * b->rows);
+	b->ok = deflate_fixed(&b->bw, b->raw, b->line * b->rows, b->line, false);
+	if (b->ok && b->bw.len > b->line * b->rows + 16) {
+		b->bw.len = b->bw.count = 0;  // Incompressible, store instead
+		b->bw.bits = 0;
+		b->ok = deflate_stored(&b->bw, b->raw, b->line * b->rows, false);
+	}
+	b->ok = b->ok && deflate_sync(&b->bw, b->last);
+
+end:
+	free(cells), free(prev), free(curr);
+	free(b->raw);
+	b->raw = NULL;
+	return NULL;
+}
+
+/*------------------------------------ PNG -----------------------------------*/
+
+static void put_be32(byte *p, uint32_t v)
+{
+	p[0] = (byte)(v >> 24), p[1] = (byte)(v >> 16), p[2] = (byte)(v >> 8), p[3] = (byte)v;
+}
+
+static bool write_chunk(FILE *output, const char *type, const byte *data, size_t n)
+{
+	byte len[4], crc[4];
+	uint32_t c = crc32_update(0, (const byte *)type, 4);
+	if (n > 0) {  // IEND has no data, and passes NULL for it
+		c = crc32_update(c, data, n);
+	}
+	put_be32(len, (uint32_t)n);
+	put_be32(crc, c);
+	return fwrite(len, 1, 4, output) == 4 && fwrite(type, 1, 4, output) == 4
+	    && (n == 0 || fwrite(data, 1, n, output) == n) && fwrite(crc, 1, 4, output) == 4;
+}
+
+int save_grid_png(const char *filename, Grid *grid, unsigned scale)
+{
+	static const byte signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	static const byte zlib_header[2] = { 0x78, 0x01 };
+	Vector2i tl = grid->top_left, br = grid->bottom_right;
+	unsigned long long w = (unsigned long long)(br.x - tl.x + 1) * scale;
+	unsigned long long h = (unsigned long long)(br.y - tl.y + 1) * scale;
+	unsigned workers = thread_count_hint(), i, y;
+	PngBand bands[THREAD_MAX_WORKERS];
+	thread_t threads[THREAD_MAX_WORKERS];
+	bool started[THREAD_MAX_WORKERS];
+	byte ihdr[13], plte[3*COLOR_COUNT], trailer[4];
+	uint32_t adler = 1;
+	FILE *output;
+	color_t c;
+	bool ok;
+
+	if (!scale || w > PNG_MAX_SIDE || h > PNG_MAX_SIDE || !(output = fopen(filename, "wb"))) {
+		return EOF;
+	}
+	init_crc_table();
+
+	put_be32(ihdr, (uint32_t)w);
+	put_be32(ihdr+4, (uint32_t)h);
+	ihdr[8] = 4;   // Bit depth
+	ihdr[9] = 3;   // Indexed color
+	ihdr[10] = ihdr[11] = ihdr[12] = 0;
+	for (c = 0; c < COLOR_COUNT; c++) {
+		plte[3*c]   = color_map[c][2];
+		plte[3*c+1] = color_map[c][1];
+		plte[3*c+2] = color_map[c][0];
+	}
+	ok = fwrite(signature, 1, sizeof signature, output) == sizeof signature
+	  && write_chunk(output, "IHDR", ihdr, sizeof ihdr)
+	  && write_chunk(output, "PLTE", plte, sizeof plte)
+	  && write_chunk(output, "IDAT", zlib_header, sizeof zlib_header);
+
+	/* Each batch runs one band per worker, then writes them out in order */
+	for (y = 0; ok && y < h; ) {
+		unsigned n = 0;
+		for (i = 0; i < workers && y < h; i++, n++) {
+			PngBand *b = &bands[i];
+			memset(b, 0, sizeof *b);
+			b->grid = grid;
+			b->top_left = tl;
+			b->scale = scale;
+			b->width = (unsigned)w;
+			b->line = 1 + ((size_t)w * 4 + 7) / 8;
+			b->first = y;
+			b->rows = (unsigned)MIN(h - y, MAX(PNG_BAND_BYTES / b->line, 1));
+			y += b->rows;
+			b->last = (y == h);
+			if (!(started[i] = thread_create(&threads[i], band_worker, b))) {
+				band_worker(b);  // Run inline instead
+			}
+		}
+		for (i = 0; i < n; i++) {
+			PngBand *b = &bands[i];
+			if (started[i]) {
+				thread_join(threads[i]);
+			}
+			ok = ok && b->ok && write_chunk(output, "IDAT", b->bw.out, b->bw.len);
+			adler = adler32_combine(adler, b->adler, b->line * b->rows);
+			free(b->bw.out);
+		}
+	}
+
+	put_be32(trailer, adler);
+	ok = ok && write_chunk(output, "IDAT", trailer, sizeof trailer)
+	        && write_chunk(output, "IEND", NULL, 0);
+	if (fclose(output) == EOF || !ok) {
+		return EOF;
+	}
+	return 0;
+}
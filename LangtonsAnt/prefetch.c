@@ -0,0 +1,103 @@
+#include "io.h"
+#include "thread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+struct prefetch {
+	char                 filename[FILENAME_SZ];
+	const EmbeddedFile  *file;    /**< Snapshot to build from, NULL to read the file */
+	unsigned             steps;
+	size_t               budget;
+	thread_t             thread;
+	atomic_word_t        stop;    /**< Wanted now, stop running ahead */
+	atomic_word_t        dropped; /**< Not wanted anymore, stop loading too */
+	Simulation          *sim;     /**< Written by the worker, read once it's joined */
+};
+
+static void delete_simulation(Simulation *sim)
+{
+	Colors *colors = sim->colors;
+	simulation_delete(sim);
+	colors_delete(colors);
+}
+
+static bool over_budget(Prefetch *pf, Simulation *sim)
+{
+	return grid_memory_usage(sim->grid) > pf->budget;
+}
+
+static bool keep_loading(void *arg, uint64_t done, uint64_t total)
+{
+	Prefetch *pf = arg;
+	(void)done, (void)total;
+	return !atomic_word_load(&pf->dropped);
+}
+
+static void *prefetch_thread(void *arg)
+{
+	Prefetch *pf = arg;
+	Simulation *sim;
+	unsigned i;
+
+	io_set_progress(keep_loading, pf);
+	sim = pf->file ? load_simulation_memory(pf->file->data, pf->file->size) : load_simulation(pf->filename);
+	io_set_progress(NULL, NULL);
+
+	if (sim && has_enough_colors(sim->colors)) {
+		for (i = 0; i < pf->steps; i++) {
+			if (i % PREFETCH_CHECK_STEPS == 0 && atomic_word_load(&pf->stop)) {
+				break;
+			}
+			if (!simulation_step(sim) && over_budget(pf, sim)) {
+				break;  // Grid expanded past the budget, dropped below
+			}
+		}
+	}
+	if (sim && over_budget(pf, sim)) {
+		delete_simulation(sim);
+		sim = NULL;
+	}
+	pf->sim = sim;
+	return NULL;
+}
+
+Prefetch *prefetch_start(const char *filename, const EmbeddedFile *file, unsigned steps, size_t budget)
+{
+	Prefetch *pf;
+
+	if (!(pf = calloc(1, sizeof(Prefetch)))) {
+		return NULL;
+	}
+	snprintf(pf->filename, sizeof pf->filename, "%s", filename);
+	pf->file = file;
+	pf->steps = steps;
+	pf->budget = budget;
+	if (!thread_create(&pf->thread, prefetch_thread, pf)) {
+		free(pf);
+		return NULL;
+	}
+	return pf;
+}
+
+Simulation *prefetch_take(Prefetch *pf)
+{
+	Simulation *sim;
+
+	atomic_word_store(&pf->stop, true);
+	thread_join(pf->thread);
+	sim = pf->sim;
+	free(pf);
+	return sim;
+}
+
+void prefetch_discard(Prefetch *pf)
+{
+	Simulation *sim;
+
+	atomic_word_store(&pf->dropped, true);
+	sim = prefetch_take(pf);
+	if (sim) {
+		delete_simulation(sim);
+	}
+}
@@ -0,0 +1,275 @@
+#include "io.h"
+#include "thread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#	include <direct.h>
+#	define make_dir(path)  _mkdir(path)
+#else
+#	include <sys/stat.h>
+#	define make_dir(path)  mkdir(path, 0755)
+#endif
+
+/* Sized so that the longest base name and the largest level and tile numbers always fit */
+#define DIR_SZ   (FILENAME_SZ + 24)  // base + "_files/" + level
+#define PATH_SZ  (DIR_SZ + 32)       // dir + "/" + column + "_" + row + ".bmp"
+
+typedef struct tile_job {
+	char      path[PATH_SZ];
+	unsigned  width, height;
+	byte     *pixels;  /**< width*height palette indices */
+} TileJob;
+
+/** Rows of one zoom level waiting to be cut into tiles */
+typedef struct level {
+	unsigned  width, height;
+	unsigned  row;      /**< Next row of the level to be added */
+	byte     *strip;    /**< PYRAMID_TILE_SIZE rows */
+	byte     *pending;  /**< Even row waiting for its pair, to be halved into the level above */
+	bool      has_pending;
+} Level;
+
+typedef struct pyramid {
+	char      base[FILENAME_SZ];  /**< Manifest path without the extension */
+	byte      def_color;
+	unsigned  max_level;
+	Level    *levels;
+
+	/* Bounded queue of tiles for the encoder pool */
+	TileJob  *queue[PYRAMID_QUEUE_LEN];
+	unsigned  head, count;
+	bool      closing, failed;
+	mutex_t   lock;
+	cond_t    not_empty, not_full;
+	thread_t  workers[THREAD_MAX_WORKERS];
+	unsigned  worker_count;
+} Pyramid;
+
+/*------------------------------- Encoder pool -------------------------------*/
+
+static void read_tile_row(void *source, unsigned y, byte *row)
+{
+	TileJob *job = source;
+	memcpy(row, job->pixels + (size_t)y*job->width, job->width);
+}
+
+static void *tile_worker(void *arg)
+{
+	Pyramid *p = arg;
+	TileJob *job;
+	bool ok;
+
+	mutex_lock(&p->lock);
+	while (true) {
+		while (!p->count && !p->closing) {
+			cond_wait(&p->not_empty, &p->lock);
+		}
+		if (!p->count) {
+			break;  // Closing and drained
+		}
+		job = p->queue[p->head];
+		p->head = (p->head+1) % PYRAMID_QUEUE_LEN;
+		p->count--;
+		cond_signal(&p->not_full);
+		mutex_unlock(&p->lock);
+
+		ok = create_bitmap_file(job->path, job->height, job->width, read_tile_row, job) != EOF;
+		free(job->pixels);
+		free(job);
+
+		mutex_lock(&p->lock);
+		p->failed |= !ok;
+	}
+	mutex_unlock(&p->lock);
+	return NULL;
+}
+
+static bool submit_tile(Pyramid *p, TileJob *job)
+{
+	bool failed;
+	mutex_lock(&p->lock);
+	while (p->count == PYRAMID_QUEUE_LEN) {
+		cond_wait(&p->not_full, &p->lock);  // Back-pressure keeps the working set bounded
+	}
+	p->queue[(p->head + p->count) % PYRAMID_QUEUE_LEN] = job;
+	p->count++;
+	failed = p->failed;
+	cond_signal(&p->not_empty);
+	mutex_unlock(&p->lock);
+	return !failed;
+}
+
+/*---------------------------------- Levels ----------------------------------*/
+
+/* Cuts the level's current strip into tiles, starting at row y0 of the level */
+static bool emit_strip(Pyramid *p, unsigned index, unsigned y0, unsigned rows)
+{
+	Level *l = &p->levels[index];
+	unsigned x0, y;
+	char dir[DIR_SZ];
+
+	snprintf(dir, sizeof dir, "%s_files/%u", p->base, index);
+	if (y0 == 0) {
+		make_dir(dir);
+	}
+	for (x0 = 0; x0 < l->width; x0 += PYRAMID_TILE_SIZE) {
+		TileJob *job = malloc(sizeof(TileJob));
+		if (!job) {
+			return false;
+		}
+		job->width = MIN(PYRAMID_TILE_SIZE, l->width - x0);
+		job->height = rows;
+		if (!(job->pixels = malloc((size_t)job->width * rows))) {
+			free(job);
+			return false;
+		}
+		for (y = 0; y < rows; y++) {
+			memcpy(job->pixels + (size_t)y*job->width, l->strip + (size_t)y*l->width + x0, job->width);
+		}
+		snprintf(job->path, sizeof job->path, "%s/%u_%u.bmp",
+		         dir, x0 / PYRAMID_TILE_SIZE, y0 / PYRAMID_TILE_SIZE);
+		if (!submit_tile(p, job)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/* Halves a row, keeping any colored cell so thin features stay visible */
+static void halve_row(const byte *row, unsigned width, byte def, byte *out)
+{
+	unsigned x;
+	for (x = 0; x < width; x += 2) {
+		byte a = row[x], b = (x+1 < width) ? row[x+1] : def;
+		out[x/2] = (a != def) ? a : b;
+	}
+}
+
+static bool add_row(Pyramid *p, unsigned index, const byte *row)
+{
+	Level *l = &p->levels[index];
+	unsigned y = l->row++ % PYRAMID_TILE_SIZE;
+	bool ok = true;
+
+	memcpy(l->strip + (size_t)y*l->width, row, l->width);
+	if (y == PYRAMID_TILE_SIZE-1 || l->row == l->height) {
+		ok = emit_strip(p, index, l->row-1 - y, y+1);
+	}
+
+	if (ok && index > 0) {
+		if (!l->has_pending) {
+			memcpy(l->pending, row, l->width);
+			l->has_pending = l->row < l->height;  // Last odd row goes up alone
+			if (l->has_pending) {
+				return true;
+			}
+		} else {
+			unsigned x;
+			for (x = 0; x < l->width; x++) {  // Merge the pair first, colored cells win
+				l->pending[x] = (l->pending[x] != p->def_color) ? l->pending[x] : row[x];
+			}
+			l->has_pending = false;
+		}
+		halve_row(l->pending, l->width, p->def_color, l->pending);
+		ok = add_row(p, index-1, l->pending);
+	}
+	return ok;
+}
+
+/*--------------------------------- Pyramid ----------------------------------*/
+
+static bool write_manifest(const char *filename, unsigned width, unsigned height)
+{
+	FILE *output = fopen(filename, "w");
+	int e;
+	if (!output) {
+		return false;
+	}
+	e = fprintf(output, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	                    "<Image xmlns=\"http://schemas.microsoft.com/deepzoom/2008\""
+	                    " Format=\"bmp\" Overlap=\"0\" TileSize=\"%u\">\n"
+	                    "  <Size Width=\"%u\" Height=\"%u\"/>\n"
+	                    "</Image>\n", PYRAMID_TILE_SIZE, width, height);
+	return fclose(output) != EOF && e > 0;
+}
+
+int save_grid_pyramid(const char *filename, Grid *grid)
+{
+	Pyramid *p;
+	Vector2i tl = grid->top_left, br = grid->bottom_right;
+	unsigned width = br.x - tl.x + 1, height = br.y - tl.y + 1, side, i, y;
+	size_t n = strlen(filename);
+	char dir[DIR_SZ];
+	byte *row = NULL;
+	bool ok = true;
+
+	if (n < 4 || n - 4 >= FILENAME_SZ || !(p = calloc(1, sizeof(Pyramid)))) {
+		return EOF;
+	}
+	memcpy(p->base, filename, n - 4);  // Strip ".dzi"
+	p->def_color = grid->def_color;
+	for (side = 1; side < MAX(width, height); side *= 2) {
+		p->max_level++;
+	}
+
+	if (!(p->levels = calloc(p->max_level+1, sizeof(Level))) || !(row = malloc(width))) {
+		ok = false;
+		goto cleanup;
+	}
+	for (i = p->max_level+1; i-- > 0; ) {
+		Level *l = &p->levels[i];
+		unsigned shift = p->max_level - i;
+		l->width = ((width-1) >> shift) + 1;
+		l->height = ((height-1) >> shift) + 1;
+		l->strip = malloc((size_t)l->width * PYRAMID_TILE_SIZE);
+		l->pending = malloc(l->width);
+		ok = ok && l->strip && l->pending;
+	}
+	snprintf(dir, sizeof dir, "%s_files", p->base);
+	make_dir(dir);
+	if (!ok || !write_manifest(filename, width, height)) {
+		ok = false;
+		goto cleanup;
+	}
+
+	mutex_init(&p->lock);
+	cond_init(&p->not_empty);
+	cond_init(&p->not_full);
+	for (i = 0; i < thread_count_hint(); i++) {
+		p->worker_count += thread_create(&p->workers[p->worker_count], tile_worker, p);
+	}
+
+	/* Single pass over the grid, every level is fed as rows come in */
+	for (y = 0; ok && y < height && p->worker_count; y++) {
+		grid_read_row(grid, tl.y + (int)y, tl.x, width, row);
+		ok = add_row(p, p->max_level, row);
+	}
+	ok = ok && p->worker_count;
+
+	mutex_lock(&p->lock);
+	p->closing = true;
+	cond_broadcast(&p->not_empty);
+	mutex_unlock(&p->lock);
+	for (i = 0; i < p->worker_count; i++) {
+		thread_join(p->workers[i]);
+	}
+	ok = ok && !p->failed;
+	mutex_destroy(&p->lock);
+	cond_destroy(&p->not_empty);
+	cond_destroy(&p->not_full);
+
+cleanup:
+	if (p->levels) {
+		for (i = 0; i <= p->max_level; i++) {
+			free(p->levels[i].strip);
+			free(p->levels[i].pending);
+		}
+	}
+	free(p->levels);
+	free(row);
+	free(p);
+	return ok ? 0 : EOF;
+}
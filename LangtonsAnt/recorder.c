@@ -0,0 +1,321 @@
+#include "io.h"
+#include "thread.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct recorder {
+	FILE         *output;
+	bool          is_pipe;
+	RecordFormat  format;
+	RecordRegion  region;
+	RecordPolicy  policy;
+	unsigned      every, fps, size;
+	unsigned      last_steps;
+	long long     last_us;
+
+	byte         *frames[RECORDER_QUEUE_LEN];  /**< Palette indices, size*size each */
+	unsigned      head, count;                 /**< Queue of captured frames */
+	bool          closing, failed;
+	unsigned long written, dropped;
+	byte         *row;                         /**< Scratch row for sampling */
+	unsigned      row_len;
+
+	mutex_t       lock;
+	cond_t        not_empty, not_full;
+	thread_t      writer;
+};
+
+Recorder *active_recorder;
+
+/* Full range BT.601, precomputed from color_map */
+static byte yuv_map[COLOR_COUNT][3];
+
+static void init_yuv_map(void)
+{
+	color_t c;
+	for (c = 0; c < COLOR_COUNT; c++) {
+		double b = color_map[c][0], g = color_map[c][1], r = color_map[c][2];
+		double y = 0.299*r + 0.587*g + 0.114*b;
+		yuv_map[c][0] = (byte)(y + 0.5);
+		yuv_map[c][1] = (byte)(128 + 0.564*(b-y) + 0.5);
+		yuv_map[c][2] = (byte)(128 + 0.713*(r-y) + 0.5);
+	}
+}
+
+static bool write_header(Recorder *rec)
+{
+	if (rec->format == REC_FORMAT_Y4M) {
+		return fprintf(rec->output, "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C444 XCOLORRANGE=FULL\n",
+		               rec->size, rec->size, rec->fps) > 0;
+	}
+	return true;  // PPM frames each carry their own header
+}
+
+static bool write_frame(Recorder *rec, const byte *frame, byte *buf)
+{
+	size_t n = (size_t)rec->size * rec->size, i;
+	byte *p = buf;
+
+	if (rec->format == REC_FORMAT_Y4M) {
+		for (i = 0; i < n; i++) {
+			buf[i]     = yuv_map[frame[i]][0];
+			buf[i+n]   = yuv_map[frame[i]][1];
+			buf[i+2*n] = yuv_map[frame[i]][2];
+		}
+		return fputs("FRAME\n", rec->output) != EOF
+		    && fwrite(buf, 1, 3*n, rec->output) == 3*n;
+	}
+
+	for (i = 0; i < n; i++) {
+		const byte *bgr = color_map[frame[i]];
+		*p++ = bgr[2], *p++ = bgr[1], *p++ = bgr[0];
+	}
+	return fprintf(rec->output, "P6\n%u %u\n255\n", rec->size, rec->size) > 0
+	    && fwrite(buf, 1, 3*n, rec->output) == 3*n;
+}
+
+static void *writer_thread(void *arg)
+{
+	Recorder *rec = arg;
+	byte *buf = malloc((size_t)rec->size * rec->size * 3);
+
+	mutex_lock(&rec->lock);
+	while (true) {
+		while (!rec->count && !rec->closing) {
+			cond_wait(&rec->not_empty, &rec->lock);
+		}
+		if (!rec->count) {
+			break;  // Closing and drained
+		}
+		byte *frame = rec->frames[rec->head];
+		mutex_unlock(&rec->lock);
+
+		bool ok = buf && !rec->failed && write_frame(rec, frame, buf);
+
+		mutex_lock(&rec->lock);
+		rec->failed |= !ok;
+		rec->written += ok;
+		rec->head = (rec->head+1) % RECORDER_QUEUE_LEN;
+		rec->count--;
+		cond_signal(&rec->not_full);
+	}
+	mutex_unlock(&rec->lock);
+
+	free(buf);
+	fflush(rec->output);
+	return NULL;
+}
+
+static bool has_suffix(const char *str, const char *suffix)
+{
+	size_t n = strlen(str), m = strlen(suffix);
+	return n >= m && !strcmp(str + n - m, suffix);
+}
+
+Recorder *recorder_open(const char *target, RecordRegion region, unsigned every, unsigned fps)
+{
+	Recorder *rec;
+	unsigned i;
+
+	assert(target);
+	if (!(rec = calloc(1, sizeof(Recorder)))) {
+		return NULL;
+	}
+	rec->format = has_suffix(target, ".y4m") ? REC_FORMAT_Y4M : REC_FORMAT_PPM;
+	rec->region = region;
+	rec->policy = every ? REC_POLICY_BLOCK : REC_POLICY_DROP;  // Step-based timelapses are exact
+	rec->every = every;
+	rec->fps = fps ? fps : RECORDER_DEF_FPS;
+	rec->size = RECORDER_FRAME_SIZE;
+	rec->last_us = -1;
+
+	if (*target == '|') {
+#ifdef _WIN32
+		rec->output = _popen(target+1, "wb");
+#else
+		rec->output = popen(target+1, "w");
+#endif
+		rec->is_pipe = true;
+	} else if (!strcmp(target, "-")) {
+		rec->output = stdout;
+	} else {
+		rec->output = fopen(target, "wb");
+	}
+	if (!rec->output) {
+		free(rec);
+		return NULL;
+	}
+
+	for (i = 0; i < RECORDER_QUEUE_LEN; i++) {
+		if (!(rec->frames[i] = malloc((size_t)rec->size * rec->size))) {
+			goto error_end;
+		}
+	}
+	init_yuv_map();
+	if (!write_header(rec)) {
+		goto error_end;
+	}
+
+	mutex_init(&rec->lock);
+	cond_init(&rec->not_empty);
+	cond_init(&rec->not_full);
+	if (!thread_create(&rec->writer, writer_thread, rec)) {
+		mutex_destroy(&rec->lock);
+		cond_destroy(&rec->not_empty);
+		cond_destroy(&rec->not_full);
+		goto error_end;
+	}
+	return rec;
+
+error_end:
+	for (i = 0; i < RECORDER_QUEUE_LEN; i++) {
+		free(rec->frames[i]);
+	}
+	if (rec->is_pipe) {
+#ifdef _WIN32
+		_pclose(rec->output);
+#else
+		pclose(rec->output);
+#endif
+	} else if (rec->output != stdout) {
+		fclose(rec->output);
+	}
+	free(rec);
+	return NULL;
+}
+
+int recorder_close(Recorder *rec)
+{
+	unsigned i;
+	int e;
+
+	assert(rec);
+	mutex_lock(&rec->lock);
+	rec->closing = true;
+	cond_signal(&rec->not_empty);
+	mutex_unlock(&rec->lock);
+	thread_join(rec->writer);
+
+	mutex_destroy(&rec->lock);
+	cond_destroy(&rec->not_empty);
+	cond_destroy(&rec->not_full);
+	for (i = 0; i < RECORDER_QUEUE_LEN; i++) {
+		free(rec->frames[i]);
+	}
+	free(rec->row);
+
+	if (rec->is_pipe) {
+#ifdef _WIN32
+		e = _pclose(rec->output);
+#else
+		e = pclose(rec->output);
+#endif
+	} else {
+		e = (rec->output != stdout) ? fclose(rec->output) : fflush(rec->output);
+	}
+	e = (e || rec->failed) ? EOF : 0;
+	free(rec);
+	return e;
+}
+
+bool recorder_due(Recorder *rec, unsigned steps, long long now_us)
+{
+	assert(rec);
+	if (rec->every) {
+		return steps % rec->every == 0 && steps != rec->last_steps;
+	}
+	return rec->last_us < 0 || now_us - rec->last_us >= 1000000LL / rec->fps;
+}
+
+/* Nearest-neighbour sampling of a square region into a size*size frame, false if out of memory */
+static bool sample_region(Recorder *rec, Grid *grid, Vector2i top_left, unsigned side, byte *frame)
+{
+	unsigned size = rec->size, i, j;
+	int prev_y = INT_MIN;
+
+	if (rec->row_len < side) {
+		byte *row = malloc(side);
+		if (!row) {
+			return false;  // Keeps the old row for smaller regions
+		}
+		free(rec->row);
+		rec->row = row;
+		rec->row_len = side;
+	}
+	for (i = 0; i < size; i++) {
+		int y = top_left.y + (int)((unsigned long long)i * side / size);
+		byte *out = frame + (size_t)i*size;
+		if (y == prev_y) {
+			memcpy(out, out - size, size);  // Upscaled, same source row
+			continue;
+		}
+		grid_read_row(grid, y, top_left.x, side, rec->row);
+		for (j = 0; j < size; j++) {
+			out[j] = rec->row[(unsigned long long)j * side / size];
+		}
+		prev_y = y;
+	}
+	return true;
+}
+
+bool recorder_capture(Recorder *rec, Simulation *sim, Vector2i view_top_left, unsigned view_side,
+                      long long now_us)
+{
+	Grid *grid = sim->grid;
+	Vector2i top_left = view_top_left;
+	unsigned side = view_side, slot;
+
+	assert(rec), assert(sim);
+	rec->last_steps = sim->steps;
+	rec->last_us = now_us;
+
+	if (rec->region == REC_REGION_BOUNDING_BOX) {
+		int h = grid->bottom_right.y - grid->top_left.y + 1;
+		int w = grid->bottom_right.x - grid->top_left.x + 1;
+		side = (unsigned)MAX(h, w);
+		top_left.y = grid->top_left.y - ((int)side - h) / 2;
+		top_left.x = grid->top_left.x - ((int)side - w) / 2;
+	}
+
+	mutex_lock(&rec->lock);
+	if (rec->count == RECORDER_QUEUE_LEN && rec->policy == REC_POLICY_DROP) {
+		rec->dropped++;
+		mutex_unlock(&rec->lock);
+		return false;
+	}
+	while (rec->count == RECORDER_QUEUE_LEN && !rec->failed) {
+		cond_wait(&rec->not_full, &rec->lock);  // Back-pressure
+	}
+	if (rec->failed) {
+		mutex_unlock(&rec->lock);
+		return false;
+	}
+	slot = (rec->head + rec->count) % RECORDER_QUEUE_LEN;
+	mutex_unlock(&rec->lock);
+
+	if (!sample_region(rec, grid, top_left, side, rec->frames[slot])) {  // Slot is not visible to writer yet
+		mutex_lock(&rec->lock);
+		rec->dropped++;
+		mutex_unlock(&rec->lock);
+		return false;
+	}
+
+	mutex_lock(&rec->lock);
+	rec->count++;
+	cond_signal(&rec->not_empty);
+	mutex_unlock(&rec->lock);
+	return true;
+}
+
+unsigned long recorder_dropped(Recorder *rec)
+{
+	unsigned long dropped;
+	assert(rec);
+	mutex_lock(&rec->lock);
+	dropped = rec->dropped;
+	mutex_unlock(&rec->lock);
+	return dropped;
+}
@@ -0,0 +1,143 @@
+#include "graphics.h"
+
+RenderStats render_stats;
+
+/* Curses backend - draws to gridw/menuw and reads input from stdscr */
+
+static int curses_poll_input(MEVENT *mouse)
+{
+	int key = getch();
+	if (key == KEY_MOUSE && getmouse(mouse) == ERR) {
+		mouse->bstate = 0;
+	}
+	return key;
+}
+
+static void curses_draw_menu(bool full)
+{
+	full ? draw_menu_full() : draw_menu_iter();
+}
+
+static bool curses_present(void)
+{
+	doupdate();
+	return true;
+}
+
+static void curses_flush_input(void)
+{
+	flushinp();
+}
+
+const RenderBackend curses_backend = {
+	.name        = "curses",
+	.init        = init_graphics,
+	.end         = end_graphics,
+	.draw_region = draw_grid_full,
+	.draw_cell   = draw_grid_iter,
+	.draw_menu   = curses_draw_menu,
+	.present     = curses_present,
+	.poll_input  = curses_poll_input,
+	.flush_input = curses_flush_input,
+};
+
+/* Null backend - no terminal required, only counts calls */
+
+static void null_init(color_t fg_color, color_t bg_color)
+{
+	(void)fg_color, (void)bg_color;
+}
+
+static void null_end(void)
+{
+}
+
+static void null_draw_region(Grid *grid, Ant *ant)
+{
+	(void)grid, (void)ant;
+}
+
+static void null_draw_cell(Grid *grid, Ant *ant, Vector2i prev_pos)
+{
+	(void)grid, (void)ant, (void)prev_pos;
+}
+
+static void null_draw_menu(bool full)
+{
+	(void)full;
+}
+
+static bool null_present(void)
+{
+	return true;
+}
+
+static int null_poll_input(MEVENT *mouse)
+{
+	(void)mouse;
+	return ERR;
+}
+
+static void null_flush_input(void)
+{
+}
+
+const RenderBackend null_backend = {
+	.name        = "null",
+	.init        = null_init,
+	.end         = null_end,
+	.draw_region = null_draw_region,
+	.draw_cell   = null_draw_cell,
+	.draw_menu   = null_draw_menu,
+	.present     = null_present,
+	.poll_input  = null_poll_input,
+	.flush_input = null_flush_input,
+};
+
+const RenderBackend *render = &curses_backend;
+
+void render_init(color_t fg_color, color_t bg_color)
+{
+	render_stats = (RenderStats) { 0 };
+	(*render->init)(fg_color, bg_color);
+}
+
+void render_end(void)
+{
+	(*render->end)();
+}
+
+void render_region(Grid *grid, Ant *ant)
+{
+	render_stats.regions++;
+	(*render->draw_region)(grid, ant);
+}
+
+void render_cell(Grid *grid, Ant *ant, Vector2i prev_pos)
+{
+	render_stats.cells++;
+	(*render->draw_cell)(grid, ant, prev_pos);
+}
+
+void render_menu(bool full)
+{
+	render_stats.menus++;
+	(*render->draw_menu)(full);
+}
+
+bool render_present(void)
+{
+	render_stats.presents++;
+	return (*render->present)();
+}
+
+int render_poll_input(MEVENT *mouse)
+{
+	render_stats.polls++;
+	return (*render->poll_input)(mouse);
+}
+
+void render_flush_input(void)
+{
+	(*render->flush_input)();
+}
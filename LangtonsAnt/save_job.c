@@ -0,0 +1,318 @@
+#include "io.h"
+#include "thread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#	include <sys/mman.h>
+#	include <sys/types.h>
+#	include <sys/wait.h>
+#	include <unistd.h>
+#endif
+
+/** Progress shared with whoever does the work, which may be a child process */
+typedef struct job_progress {
+	atomic_word_t  done;       /**< Thousandths of the work done */
+	atomic_word_t  cancelled;
+	unsigned       phase, phases;  /**< Files written so far and overall, only used by the worker */
+} JobProgress;
+
+struct save_job {
+	char          filename[FILENAME_SZ];
+	bool          text, bitmap;
+#ifndef _WIN32
+	pid_t         pid;       /**< Child process doing the writing, 0 if a thread is */
+#endif
+	Simulation   *snapshot;  /**< Private copy written by the thread */
+	JobProgress  *progress;
+	thread_t      thread;
+	mutex_t       lock;
+	bool          finished;
+	int           result;
+};
+
+struct load_job {
+	char          filename[FILENAME_SZ];
+	JobProgress  *progress;
+	thread_t      thread;
+	mutex_t       lock;
+	bool          finished;
+	Simulation   *sim;       /**< Loaded simulation, NULL if loading failed */
+};
+
+SaveJob *active_save;
+LoadJob *active_load;
+
+/*--------------------------------- Progress ---------------------------------*/
+
+static JobProgress *progress_new(void)
+{
+#ifndef _WIN32
+	/* Anonymous shared memory comes zeroed, and stays shared with a forked child */
+	void *p = mmap(NULL, sizeof(JobProgress), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	return (p != MAP_FAILED) ? p : NULL;
+#else
+	return calloc(1, sizeof(JobProgress));
+#endif
+}
+
+static void progress_delete(JobProgress *progress)
+{
+#ifndef _WIN32
+	munmap(progress, sizeof(JobProgress));
+#else
+	free(progress);
+#endif
+}
+
+static bool report_progress(void *arg, uint64_t done, uint64_t total)
+{
+	JobProgress *p = arg;
+	if (total) {
+		uint64_t share = MIN(done, total) * JOB_PROGRESS_MAX / total;
+		atomic_word_store(&p->done, (p->phase*JOB_PROGRESS_MAX + share) / p->phases);
+	}
+	return !atomic_word_load(&p->cancelled);
+}
+
+static unsigned read_progress(JobProgress *progress)
+{
+	return (unsigned)atomic_word_load(&progress->done);
+}
+
+/*---------------------------------- Saving ----------------------------------*/
+
+static int write_files(const char *filename, Simulation *sim, bool text, bool bitmap, JobProgress *progress)
+{
+	char bmp_name[FILENAME_SZ + 8], tmp_name[FILENAME_SZ + 16];
+	int result = 0;
+
+	progress->phases = bitmap ? 2 : 1;
+	io_set_progress(report_progress, progress);
+	if (text) {  // Written in place, so through a temporary file
+		snprintf(tmp_name, sizeof tmp_name, "%s.tmp", filename);
+		if (save_simulation_text(tmp_name, sim) == EOF || replace_file(tmp_name, filename) == EOF) {
+			remove(tmp_name);
+			result = EOF;
+		}
+	} else if (save_simulation(filename, sim) == EOF) {  // Atomic by itself
+		result = EOF;
+	}
+	if (result != EOF && bitmap) {  // Best effort, doesn't affect the result
+		progress->phase++;
+		snprintf(bmp_name, sizeof bmp_name, "%s.bmp", filename);
+		snprintf(tmp_name, sizeof tmp_name, "%s.tmp", bmp_name);
+		if (save_grid_bitmap(tmp_name, sim->grid) == EOF || replace_file(tmp_name, bmp_name) == EOF) {
+			remove(tmp_name);
+		}
+	}
+	io_set_progress(NULL, NULL);
+	return result;
+}
+
+static void *save_thread(void *arg)
+{
+	SaveJob *job = arg;
+	int result = write_files(job->filename, job->snapshot, job->text, job->bitmap, job->progress);
+
+	mutex_lock(&job->lock);
+	job->result = result;
+	job->finished = true;
+	mutex_unlock(&job->lock);
+	return NULL;
+}
+
+static JobResult save_result(SaveJob *job, bool ok)
+{
+	JobResult result = ok ? JOB_DONE
+	                 : atomic_word_load(&job->progress->cancelled) ? JOB_CANCELLED : JOB_FAILED;
+	progress_delete(job->progress);
+	free(job);
+	return result;
+}
+
+static JobResult finish_thread(SaveJob *job)
+{
+	thread_join(job->thread);
+	mutex_destroy(&job->lock);
+	free(job->snapshot->colors);
+	simulation_delete(job->snapshot);
+	return save_result(job, job->result != EOF);
+}
+
+SaveJob *save_job_start(const char *filename, Simulation *sim, bool text, bool bitmap)
+{
+	SaveJob *job;
+
+	if (!(job = calloc(1, sizeof(SaveJob)))) {
+		return NULL;
+	}
+	if (!(job->progress = progress_new())) {
+		free(job);
+		return NULL;
+	}
+	snprintf(job->filename, sizeof job->filename, "%s", filename);
+	job->text = text, job->bitmap = bitmap;
+
+#ifndef _WIN32
+	/* The child gets a copy-on-write snapshot of the whole process for free */
+	if ((job->pid = fork()) == 0) {
+		_exit((write_files(job->filename, sim, text, bitmap, job->progress) == EOF) ? EXIT_FAILURE : EXIT_SUCCESS);
+	} else if (job->pid > 0) {
+		return job;
+	}
+	job->pid = 0;  // Fork failed, fall back to a thread
+#endif
+
+	if (!(job->snapshot = simulation_copy(sim))) {
+		goto error_end;
+	}
+	mutex_init(&job->lock);
+	if (!thread_create(&job->thread, save_thread, job)) {
+		mutex_destroy(&job->lock);
+		free(job->snapshot->colors);
+		simulation_delete(job->snapshot);
+		goto error_end;
+	}
+	return job;
+
+error_end:
+	progress_delete(job->progress);
+	free(job);
+	return NULL;
+}
+
+#ifndef _WIN32
+static JobResult finish_child(SaveJob *job, pid_t waited, int status)
+{
+	return save_result(job, waited > 0 && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+}
+#endif
+
+JobResult save_job_poll(SaveJob *job)
+{
+	bool finished;
+
+#ifndef _WIN32
+	if (job->pid) {
+		int status = 0;
+		pid_t waited = waitpid(job->pid, &status, WNOHANG);
+		return waited ? finish_child(job, waited, status) : JOB_RUNNING;
+	}
+#endif
+	mutex_lock(&job->lock);
+	finished = job->finished;
+	mutex_unlock(&job->lock);
+	return finished ? finish_thread(job) : JOB_RUNNING;
+}
+
+JobResult save_job_wait(SaveJob *job)
+{
+#ifndef _WIN32
+	if (job->pid) {
+		int status = 0;
+		pid_t waited = waitpid(job->pid, &status, 0);
+		return finish_child(job, waited, status);
+	}
+#endif
+	return finish_thread(job);  // Joins the thread
+}
+
+void save_job_cancel(SaveJob *job)
+{
+	atomic_word_store(&job->progress->cancelled, true);
+}
+
+unsigned save_job_progress(SaveJob *job)
+{
+	return read_progress(job->progress);
+}
+
+/*---------------------------------- Loading ---------------------------------*/
+
+static void *load_thread(void *arg)
+{
+	LoadJob *job = arg;
+	Simulation *sim;
+
+	job->progress->phases = 1;
+	io_set_progress(report_progress, job->progress);
+	sim = load_simulation(job->filename);
+	io_set_progress(NULL, NULL);
+
+	mutex_lock(&job->lock);
+	job->sim = sim;
+	job->finished = true;
+	mutex_unlock(&job->lock);
+	return NULL;
+}
+
+LoadJob *load_job_start(const char *filename)
+{
+	LoadJob *job;
+
+	if (!(job = calloc(1, sizeof(LoadJob)))) {
+		return NULL;
+	}
+	if (!(job->progress = progress_new())) {
+		free(job);
+		return NULL;
+	}
+	snprintf(job->filename, sizeof job->filename, "%s", filename);
+
+	mutex_init(&job->lock);
+	if (!thread_create(&job->thread, load_thread, job)) {
+		mutex_destroy(&job->lock);
+		progress_delete(job->progress);
+		free(job);
+		return NULL;
+	}
+	return job;
+}
+
+static JobResult finish_load(LoadJob *job, Simulation **sim)
+{
+	bool cancelled;
+	JobResult result;
+
+	thread_join(job->thread);
+	mutex_destroy(&job->lock);
+	cancelled = atomic_word_load(&job->progress->cancelled);
+	result = cancelled ? JOB_CANCELLED : job->sim ? JOB_DONE : JOB_FAILED;
+	if (cancelled && job->sim) {  // Finished before it saw the request
+		Colors *colors = job->sim->colors;
+		simulation_delete(job->sim);
+		colors_delete(colors);
+		job->sim = NULL;
+	}
+	*sim = job->sim;
+	progress_delete(job->progress);
+	free(job);
+	return result;
+}
+
+JobResult load_job_poll(LoadJob *job, Simulation **sim)
+{
+	bool finished;
+
+	mutex_lock(&job->lock);
+	finished = job->finished;
+	mutex_unlock(&job->lock);
+	return finished ? finish_load(job, sim) : JOB_RUNNING;
+}
+
+JobResult load_job_wait(LoadJob *job, Simulation **sim)
+{
+	return finish_load(job, sim);  // Joins the thread
+}
+
+void load_job_cancel(LoadJob *job)
+{
+	atomic_word_store(&job->progress->cancelled, true);
+}
+
+unsigned load_job_progress(LoadJob *job)
+{
+	return read_progress(job->progress);
+}
@@ -5,16 +5,24 @@ shift
 FEATURES="${@-SAVE_ENABLE=1 GALLERY_MODE=0 SERIAL_COLORS=0}"
 
 C_FLAGS="-std=gnu18 -Wpedantic -Wall -Wextra -O3"
-L_FLAGS="-lm -lncursesw -flto"
+L_FLAGS="-lm -lncursesw -pthread -flto"
 for f in $FEATURES; do
     C_FLAGS+=" -D$f"
 done
 
+if [ "$(uname)" = Linux ]; then
+    L_FLAGS+=" -lrt"  # shm_open, glibc before 2.34
+fi
+
 OPT_CURSES=/usr/local/opt/ncurses
 if [ -d $OPT_CURSES ]; then
     C_FLAGS+=" -I$OPT_CURSES/include"
     L_FLAGS+=" -L$OPT_CURSES/lib"
 fi
 
+if command -v python3 &>/dev/null; then
+    python3 "$SRC_DIR/scripts/embed_examples.py" || exit 1  # Refresh example_data.c
+fi
+
 echo "Building '$APP' ($FEATURES)..."
 gcc "$SRC_DIR"/*.c $C_FLAGS $L_FLAGS -o "$APP"
@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+"""Test client for the control socket served with -C
+
+    control_client.py SOCKET                  prints telemetry as it comes in
+    control_client.py SOCKET pause|run        sends a command and prints the reply
+    control_client.py SOCKET speed N
+    control_client.py SOCKET load|save FILE   add --wait to wait until it's done
+
+The simulator sends one JSON object per line: telemetry at most
+CONTROL_TELEMETRY_HZ times a second while something changes, and a reply
+({"reply": ..., "ok": ..., "error": ...}) to each command, in between.
+"""
+import argparse
+import json
+import socket
+import sys
+import time
+
+
+def connect(path):
+    sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    sock.connect(path)
+    return sock, sock.makefile('r', encoding='ascii')
+
+
+def command(args):
+    cmd = {'cmd': args.command, 'id': 1}
+    if args.command == 'speed':
+        cmd['value'] = int(args.arg)
+    elif args.command in ('load', 'save'):
+        cmd['file'] = args.arg
+    return cmd
+
+
+def watch(lines, count, stall):
+    """Prints telemetry lines, optionally not reading for a while to act as a slow client"""
+    for n, line in enumerate(lines, 1):
+        print(line, end='', flush=True)
+        if stall and n == 1:
+            time.sleep(stall)
+        if count and n >= count:
+            break
+
+
+def send(sock, lines, cmd, wait):
+    sock.sendall((json.dumps(cmd) + '\n').encode('ascii'))
+    reply = None
+    for line in lines:
+        msg = json.loads(line)
+        if reply is None and 'reply' in msg:
+            reply = msg
+            print(line, end='', flush=True)
+            if not (reply['ok'] and wait):
+                break
+        elif reply and msg.get(cmd['cmd'], {}).get('status') != 'pending':
+            print(json.dumps(msg[cmd['cmd']]), flush=True)  # Finished, as telemetry tells
+            return msg[cmd['cmd']]['status'] == 'success'
+    return bool(reply and reply['ok'])
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('socket')
+    parser.add_argument('command', nargs='?', choices=('pause', 'run', 'speed', 'load', 'save'))
+    parser.add_argument('arg', nargs='?')
+    parser.add_argument('-n', '--count', type=int, default=0, help="telemetry lines to print, 0 for all")
+    parser.add_argument('--stall', type=float, default=0, help="seconds to stop reading after the first line")
+    parser.add_argument('--wait', action='store_true', help="wait for a load or save to finish")
+    args = parser.parse_args()
+    if args.command in ('speed', 'load', 'save') and args.arg is None:
+        parser.error("%s needs an argument" % args.command)
+
+    sock, lines = connect(args.socket)
+    try:
+        if args.command:
+            sys.exit(0 if send(sock, lines, command(args), args.wait) else 1)
+        watch(lines, args.count, args.stall)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        sock.close()
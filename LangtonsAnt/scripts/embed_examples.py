@@ -0,0 +1,171 @@
+#!/usr/bin/env python
+"""Compiles examples/*.lant into binary snapshots embedded in example_data.c
+
+Cells are stored in the packed encoding described in io.h (LANT_PACKED, or
+LANT_PACKED_DENSE for dense grids), so load_simulation_memory() builds the
+simulation straight from the array without parsing any text.
+"""
+import glob
+import os
+import re
+import struct
+import sys
+
+
+SRC_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = os.path.join(SRC_DIR, 'example_data.c')
+
+COLOR_COUNT = 16
+LANT_VERSION = 2
+LANT_BYTE_ORDER = 0x01020304
+LANT_PACKED, LANT_PACKED_DENSE = 2, 3
+LANT_RUN_MIN = 3
+
+# Same layout as LantHeader, native byte order
+HEADER = struct.Struct('=4sHHI16B16b4BIiiIIBB2xIIIiiiiIQQ')
+
+
+def zigzag(d):
+    return -2*d - 1 if d < 0 else 2*d
+
+
+def varint(value):
+    out = bytearray()
+    while value >= 0x80:
+        out.append(value & 0x7F | 0x80)
+        value >>= 7
+    out.append(value)
+    return out
+
+
+def run_length(colors, i, end):
+    j = i + 1
+    while j < end and colors[j] == colors[i]:
+        j += 1
+    return j - i
+
+
+def encode_spans(columns, colors, origin):
+    """Mirrors encode_spans() in binary_io.c, returning the span count and bytes"""
+    out, spans, prev_end, i, m = bytearray(), 0, 0, 0, len(columns)
+    while i < m:
+        seg = i + 1
+        while seg < m and columns[seg] == columns[seg-1] + 1:
+            seg += 1
+        gap = columns[i] - prev_end if i else zigzag(columns[0] - origin)
+        j = i
+        while j < seg:
+            r = run_length(colors, j, seg)
+            if r >= LANT_RUN_MIN:
+                k = j + r
+                out += varint(gap) + varint((r-1) << 5 | colors[j] << 1)
+            else:
+                k = j
+                while k < seg:
+                    r = run_length(colors, k, seg)
+                    if r >= LANT_RUN_MIN:
+                        break
+                    k += r
+                out += varint(gap) + varint((k-j-1) << 1 | 1)
+                for n in range(j, k, 2):
+                    out.append(colors[n] | (colors[n+1] << 4 if n+1 < k else 0))
+            j, gap, spans = k, 0, spans + 1
+        prev_end = columns[seg-1] + 1
+        i = seg
+    return spans, out
+
+
+def parse_lant(filename):
+    """Reads a text .lant file into its header fields and rows of (column, color)"""
+    with open(filename, 'rb') as f:
+        text = f.read().decode('ascii')
+    tokens = re.finditer(r'\S+', text)
+    last = None
+
+    def num():
+        nonlocal last
+        last = next(tokens)
+        return int(last.group())
+
+    h = {'def': num()}
+    h['next'] = [num() for _ in range(COLOR_COUNT)]
+    h['turn'] = [num() for _ in range(COLOR_COUNT)]
+    h['first'], h['last'], h['n'] = num(), num(), num()
+    h['ant_y'], h['ant_x'], h['ant_dir'] = num(), num(), num()
+    h['steps'], is_sparse = num(), num() != 0
+    h['def_color'], h['init_size'], h['size'], h['colored'] = num(), num(), num(), num()
+    h['top_left_y'], h['top_left_x'] = num(), num()
+    h['bottom_right_y'], h['bottom_right_x'] = num(), num()
+
+    # One line per row after the header, as split by parse_cells()
+    size = h['size']
+    lines = text[text.index('\n', last.end()) + 1:].split('\n')
+    if len(lines) < size:
+        raise ValueError("%s has %d rows, expected %d" % (filename, len(lines), size))
+    rows = []
+    for line in lines[:size]:
+        if is_sparse:
+            cells = [int(v, 16) for v in line.split()]
+            rows.append([(c & 0x0FFFFFFF, c >> 28) for c in cells])
+        else:
+            colors = [int(v) for v in line.split()]
+            if len(colors) != size:
+                raise ValueError("%s has a row of %d cells, expected %d" % (filename, len(colors), size))
+            rows.append([(x, c) for x, c in enumerate(colors) if c != h['def_color']])
+    if any(c >= COLOR_COUNT for row in rows for _, c in row):
+        raise ValueError("%s has cells outside the palette" % filename)
+    h['representation'] = LANT_PACKED if is_sparse else LANT_PACKED_DENSE
+    return h, rows
+
+
+def snapshot(filename):
+    h, rows = parse_lant(filename)
+    data, next_row, origin = bytearray(), 0, 0
+    for i, row in enumerate(rows):
+        if not row:
+            continue
+        columns, colors = [c for c, _ in row], [c for _, c in row]
+        spans, encoded = encode_spans(columns, colors, origin)
+        data += varint(i - next_row) + varint(spans) + encoded
+        next_row, origin = i + 1, columns[0]
+
+    header = HEADER.pack(
+        b'LANT', LANT_VERSION, HEADER.size, LANT_BYTE_ORDER,
+        *h['next'], *h['turn'],
+        h['first'], h['last'], h['def'], 1,  # Cells in text file order
+        h['n'], h['ant_y'], h['ant_x'], h['ant_dir'], h['steps'],
+        h['representation'], h['def_color'],
+        h['init_size'], h['size'], h['colored'],
+        h['top_left_y'], h['top_left_x'], h['bottom_right_y'], h['bottom_right_x'],
+        0, HEADER.size, len(data))
+    return header + data
+
+
+def c_literal(ba, name):
+    lines = ['static const byte %s[] = {' % name]
+    for i in range(0, len(ba), 24):
+        lines.append('\t' + ','.join('%d' % b for b in ba[i:i+24]) + ',')
+    return '\n'.join(lines) + '\n};'
+
+
+def generate(filenames):
+    names = [os.path.splitext(os.path.basename(f))[0] for f in filenames]
+    parts = ['/* Generated by scripts/embed_examples.py from the examples directory, do not edit */',
+             '#include "io.h"', '']
+    for f, name in zip(filenames, names):
+        parts += [c_literal(snapshot(f), name + '_lant'), '']
+    parts.append('const EmbeddedFile embedded_examples[] = {')
+    for name in names:
+        parts.append('\t{ "examples/%s.lant", %s_lant, sizeof %s_lant },' % (name, name, name))
+    parts += ['};', '', 'const size_t embedded_example_count = LEN(embedded_examples);', '']
+    return '\n'.join(parts)
+
+
+if __name__ == '__main__':
+    filenames = sorted(glob.glob(os.path.join(SRC_DIR, 'examples', '*.lant')))
+    source = generate(filenames)
+    old = open(OUTPUT).read() if os.path.isfile(OUTPUT) else None
+    if source != old:  # Keep the timestamp, and the build, when nothing changed
+        with open(OUTPUT, 'w') as f:
+            f.write(source)
+        print("Wrote %s (%d examples)" % (OUTPUT, len(filenames)), file=sys.stderr)
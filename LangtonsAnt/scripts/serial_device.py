@@ -0,0 +1,356 @@
+#!/usr/bin/env python
+"""Stand-in for the Teensy color rule displays, to test and benchmark without hardware
+
+    serial_device.py [--draw-ms N]   emulates the device on a pseudo-terminal,
+                                     run the program with -S and the printed path
+    serial_device.py bench [...]     feeds it bursts of rule edits, comparing the
+                                     text messages of old with the delta frames
+
+The device side mirrors Teensy.ino: frames as laid out in serial.h are taken in
+byte by byte, everything received so far is applied before a display is redrawn,
+and redrawing one takes --draw-ms (filling a TFT over SPI is slow). The host side
+of the benchmark mirrors encode_color_rules() and the writer thread in serial.c.
+"""
+import argparse
+import os
+import random
+import select
+import sys
+import threading
+import time
+import tty
+
+
+DISPLAY_COUNT = 14  # COLOR_RULES_COUNT
+FRAME_MAGIC, FRAME_NAK, FRAME_KEY = 0xA5, 0x15, 0x8000
+DISPLAYS_MASK = (1 << DISPLAY_COUNT) - 1
+HEAD_LEN, RULE_LEN, SUM_LEN = 4, 4, 2
+BLANK = (0, 0, 0, 0)  # (r, g, b, turn), turn 0 for a blank display
+
+
+def frame_len(n):
+    return HEAD_LEN + n*RULE_LEN + SUM_LEN
+
+
+def checksum(data):
+    sum1 = sum2 = 0
+    for b in data:
+        sum1 = (sum1 + b) % 255
+        sum2 = (sum2 + sum1) % 255
+    return sum2 << 8 | sum1
+
+
+def same_rule(a, b):
+    return a[3] == b[3] and (not a[3] or a == b)
+
+
+def encode_frame(rules, sent, seq, key):
+    """Mirrors encode_color_rules() in serial.c, returns b'' if nothing changed"""
+    mask, body = FRAME_KEY if key else 0, bytearray()
+    for i in range(DISPLAY_COUNT):
+        if key or not same_rule(rules[i], sent[i]):
+            mask |= 1 << i
+            body += bytes(rules[i])
+    if not mask & DISPLAYS_MASK:
+        return b''
+    frame = bytearray([FRAME_MAGIC, seq & 0xFF, mask & 0xFF, mask >> 8]) + body
+    return bytes(frame + checksum(frame[1:]).to_bytes(2, 'little'))
+
+
+def encode_text(rules):
+    """The old format, '{RRGGBB,T}' per rule as a C string"""
+    msg = ''.join('{%02x%02x%02x,%c}' % r for r in rules if r[3])
+    return msg.encode('ascii') + b'\0'
+
+
+class Device:
+    """Teensy.ino, with the time of each change kept to measure how long it takes to show"""
+
+    def __init__(self, draw_ms, text=False):
+        self.draw_s, self.text = draw_ms / 1e3, text
+        self.shown, self.target = [BLANK] * DISPLAY_COUNT, [BLANK] * DISPLAY_COUNT
+        self.changed = [0.0] * DISPLAY_COUNT  # When the target last changed
+        self.dirty, self.queue = set(), []    # queue: whole redraws due, text only
+        self.frame, self.need = bytearray(), 0
+        self.seq, self.synced = 0, False
+        self.replies = bytearray()
+        self.stats = dict(bytes=0, frames=0, keys=0, bad=0, rejected=0, redraws=0, lag=[])
+
+    def reject(self):
+        self.synced = False
+        self.replies.append(FRAME_NAK)
+
+    def apply(self, f, now):
+        mask, seq = f[2] | f[3] << 8, f[1]
+        key = bool(mask & FRAME_KEY)
+        self.stats['frames'] += 1
+        self.stats['keys'] += key
+        if not key and (not self.synced or seq != (self.seq + 1) & 0xFF):
+            self.stats['rejected'] += 1
+            self.reject()
+            return
+        self.seq, self.synced = seq, True
+        p = HEAD_LEN
+        for i in range(DISPLAY_COUNT):
+            if not mask & 1 << i:
+                continue
+            rule = tuple(f[p:p+RULE_LEN])
+            p += RULE_LEN
+            if rule != self.target[i]:
+                self.target[i], self.changed[i] = rule, now
+            if same_rule(rule, self.shown[i]):
+                self.dirty.discard(i)
+            else:
+                self.dirty.add(i)
+
+    def feed_frames(self, data, now):
+        for c in data:
+            if not self.frame and c != FRAME_MAGIC:
+                continue
+            self.frame.append(c)
+            if len(self.frame) == HEAD_LEN:
+                mask = self.frame[2] | self.frame[3] << 8
+                if mask & ~(DISPLAYS_MASK | FRAME_KEY):
+                    self.frame = bytearray()
+                    continue
+                self.need = frame_len(bin(mask & DISPLAYS_MASK).count('1'))
+            if len(self.frame) < HEAD_LEN or len(self.frame) < self.need:
+                continue
+            body, self.frame = self.frame, bytearray()
+            if checksum(body[1:-SUM_LEN]) != int.from_bytes(body[-SUM_LEN:], 'little'):
+                self.stats['bad'] += 1
+                self.reject()
+            else:
+                self.apply(body, now)
+
+    def feed_text(self, data, now):
+        """The old firmware: every message redraws all displays, one message after another"""
+        self.frame += data
+        while b'\0' in self.frame:
+            msg, _, self.frame = self.frame.partition(b'\0')
+            self.stats['frames'] += 1
+            rules = [BLANK] * DISPLAY_COUNT
+            text = msg.decode('ascii', 'replace')
+            for i in range(min(len(text) // 10, DISPLAY_COUNT)):
+                r = text[i*10:i*10+10]
+                rules[i] = (int(r[1:3], 16), int(r[3:5], 16), int(r[5:7], 16), ord(r[8]))
+            self.queue.append((rules, now))
+
+    def feed(self, data, now):
+        self.stats['bytes'] += len(data)
+        (self.feed_text if self.text else self.feed_frames)(data, now)
+
+    def busy(self):
+        return bool(self.dirty or self.queue)
+
+    def draw_one(self):
+        """Redraws one display, returns (index, rule, lag) or None if all are up to date"""
+        if self.text:
+            if not self.queue:
+                return None
+            rules, since = self.queue[0]
+            i = next(i for i in range(DISPLAY_COUNT) if i not in self.dirty)
+            self.dirty.add(i)  # Used as the displays done of this message
+            if len(self.dirty) == DISPLAY_COUNT:
+                self.queue.pop(0)
+                self.dirty.clear()
+            rule = rules[i]
+        elif self.dirty:
+            i = min(self.dirty)
+            self.dirty.discard(i)
+            rule, since = self.target[i], self.changed[i]
+        else:
+            return None
+        time.sleep(self.draw_s)
+        self.shown[i] = rule
+        lag = time.monotonic() - since
+        self.stats['redraws'] += 1
+        self.stats['lag'].append(lag)
+        return i, rule, lag
+
+
+def percentile(values, p):
+    values = sorted(values)
+    return values[min(int(len(values) * p), len(values) - 1)] if values else 0.0
+
+
+def summary(stats):
+    lag = stats['lag']
+    return ("%d bytes, %d frames (%d key, %d bad, %d rejected), %d redraws, "
+            "lag p50 %.0f ms, p99 %.0f ms, max %.0f ms" % (
+                stats['bytes'], stats['frames'], stats['keys'], stats['bad'], stats['rejected'],
+                stats['redraws'], percentile(lag, .5) * 1e3, percentile(lag, .99) * 1e3,
+                max(lag, default=0) * 1e3))
+
+
+def run_device(master, device, stop=None, on_draw=None):
+    """Reads from the pty master and redraws until stopped, like loop() on the board"""
+    while not (stop and stop.is_set() and not device.busy()):
+        ready, _, _ = select.select([master], [], [], 0 if device.busy() else 0.1)
+        if ready:
+            try:
+                data = os.read(master, 4096)
+            except OSError:  # Nobody on the other end
+                data = b''
+            if data:
+                device.feed(data, time.monotonic())
+            else:
+                time.sleep(0.1)
+            continue
+        if device.replies:
+            os.write(master, device.replies)
+            device.replies.clear()
+        drawn = device.draw_one()
+        if drawn and on_draw:
+            on_draw(*drawn)
+
+
+def open_pty():
+    master, slave = os.openpty()
+    tty.setraw(slave)
+    return master, slave
+
+
+def serve(args):
+    master, slave = open_pty()
+    device = Device(args.draw_ms, args.text)
+    print("Stand-in device on %s, run the program with -S %s" % (os.ttyname(slave), os.ttyname(slave)),
+          file=sys.stderr)
+    last = dict(device.stats, lag=[])
+
+    def report(i, rule, lag):
+        print("display %2d  #%02x%02x%02x %s  after %.0f ms" % (i, *rule[:3], chr(rule[3]) if rule[3] else ' ', lag * 1e3))
+
+    def ticker():
+        while True:
+            time.sleep(args.report_s)
+            if device.stats['bytes'] != last['bytes']:
+                print(summary(device.stats), file=sys.stderr)
+                last.update(device.stats)
+
+    threading.Thread(target=ticker, daemon=True).start()
+    try:
+        run_device(master, device, on_draw=report if args.verbose else None)
+    except KeyboardInterrupt:
+        print(summary(device.stats), file=sys.stderr)
+
+
+def bench(args, text):
+    """Drives a device with bursts of edits, returns its stats and the edit-to-display lags"""
+    master, slave = open_pty()
+    device = Device(args.draw_ms, text)
+    rules = [BLANK] * DISPLAY_COUNT
+    edits = [[] for _ in range(DISPLAY_COUNT)]  # (time, rule) not shown yet, per display
+    lags, collapsed = [], [0]
+    lock, wake, stop = threading.Lock(), threading.Condition(), threading.Event()
+    pending, rng = [], random.Random(args.seed)
+
+    def on_draw(i, rule, _):
+        with lock:
+            n = next((k for k in range(len(edits[i]) - 1, -1, -1) if edits[i][k][1] == rule), None)
+            if n is not None:
+                lags.append(time.monotonic() - edits[i][n][0])
+                collapsed[0] += n
+                del edits[i][:n+1]
+
+    def send(data):
+        if args.corrupt and rng.random() < args.corrupt:
+            data = bytearray(data)
+            data[rng.randrange(len(data))] ^= 0xFF
+        os.write(slave, data)
+        time.sleep(len(data) * 10 / args.baud)  # 8N1 on the wire
+
+    def writer():
+        """serial.c: the latest rules go out as one frame, deltas against what was sent"""
+        sent, seq, synced = [BLANK] * DISPLAY_COUNT, 0, False
+        while True:
+            with wake:
+                while not pending and not stop.is_set():
+                    wake.wait()
+                if not pending:
+                    break
+                queued = pending[:]
+                pending.clear()
+            if text:  # Each edit used to run the script once, with no way to skip any
+                for rules_then in queued:
+                    send(encode_text(rules_then))
+                continue
+            latest = queued[-1]
+            readable, _, _ = select.select([slave], [], [], 0)
+            if readable and FRAME_NAK in os.read(slave, 256):
+                synced = False
+            frame = encode_frame(latest, sent, seq, not synced)
+            if frame:
+                send(frame)
+                sent, seq, synced = latest, seq + 1, True
+        if not text:  # Stands in for the periodic key frame, covering any corrupted frame at the end
+            time.sleep(0.05)
+            send(encode_frame(sent, sent, seq, True))
+
+    device_thread = threading.Thread(target=run_device, args=(master, device, stop, on_draw))
+    writer_thread = threading.Thread(target=writer)
+    device_thread.start()
+    writer_thread.start()
+    start, counter = time.monotonic(), 0
+    for _ in range(args.bursts):
+        for _ in range(args.burst):
+            counter += 1
+            i = rng.randrange(args.rules)
+            with lock:
+                rules[i] = (counter >> 16 & 0xFF, counter >> 8 & 0xFF, counter & 0xFF, ord(rng.choice('<>')))
+                edits[i].append((time.monotonic(), rules[i]))
+            with wake:
+                pending.append(list(rules))  # Old: one message per edit, new: only the latest is kept
+                if not text:
+                    del pending[:-1]
+                wake.notify()
+            time.sleep(args.edit_gap_ms / 1e3)
+        time.sleep(args.interval_ms / 1e3)
+    with wake:
+        stop.set()
+        wake.notify()
+    writer_thread.join()
+    time.sleep(0.1)  # Let the last bytes arrive before the device may stop
+    device_thread.join()
+    elapsed = time.monotonic() - start
+    os.close(master)
+    os.close(slave)
+    in_sync = all(same_rule(a, b) for a, b in zip(device.shown, rules))
+    return device.stats, lags, collapsed[0], counter, elapsed, in_sync
+
+
+def run_bench(args):
+    for name, text in (('text', True), ('delta', False)):
+        if args.only and args.only != name:
+            continue
+        stats, lags, collapsed, count, elapsed, in_sync = bench(args, text)
+        print("%-5s  %d edits in %.2f s: %.0f B/edit, %.2f redraws/edit, %d edits collapsed, %s" % (
+            name, count, elapsed, stats['bytes'] / count, stats['redraws'] / count, collapsed,
+            "in sync" if in_sync else "OUT OF SYNC"))
+        print("       edit to display p50 %.0f ms, p99 %.0f ms, max %.0f ms; device: %s" % (
+            percentile(lags, .5) * 1e3, percentile(lags, .99) * 1e3, max(lags, default=0) * 1e3,
+            summary(stats)))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--draw-ms', type=float, default=40, help="time to redraw one display")
+    parser.add_argument('--text', action='store_true', help="take the old text messages instead")
+    parser.add_argument('--report-s', type=float, default=1, help="seconds between summaries")
+    parser.add_argument('-v', '--verbose', action='store_true', help="print every redraw")
+    sub = parser.add_subparsers(dest='command')
+    bench_parser = sub.add_parser('bench', help="compare the protocols on bursts of edits")
+    bench_parser.add_argument('--rules', type=int, default=DISPLAY_COUNT, help="displays being edited")
+    bench_parser.add_argument('--bursts', type=int, default=10)
+    bench_parser.add_argument('--burst', type=int, default=20, help="edits per burst")
+    bench_parser.add_argument('--edit-gap-ms', type=float, default=5, help="time between edits in a burst")
+    bench_parser.add_argument('--interval-ms', type=float, default=300, help="time between bursts")
+    bench_parser.add_argument('--baud', type=int, default=115200)
+    bench_parser.add_argument('--corrupt', type=float, default=0, help="chance of a corrupted write")
+    bench_parser.add_argument('--only', choices=('text', 'delta'))
+    bench_parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+    if args.command == 'bench':
+        run_bench(args)
+    else:
+        serve(args)
@@ -0,0 +1,134 @@
+#!/usr/bin/env python
+"""Reference reader of the shared memory segment exported with -M, renders it to PPM
+
+    shm_reader.py NAME                    writes the current frame to NAME.ppm
+    shm_reader.py NAME -o out.ppm -n 0    keeps overwriting out.ppm as the grid changes
+    shm_reader.py NAME -o frame%04d.ppm   one file per frame, numbered
+    shm_reader.py NAME -o - -n 0 | ffmpeg -f image2pipe -c:v ppm -i - out.mp4
+
+The segment is a ShmHeader (see io.h) followed by the cells of a square window
+in the middle of the grid, one palette index per byte. Frames are read under
+its seqlock: wait while seq is odd, read, and start over if seq changed. Plain
+loads are ordered well enough for that on x86; a C reader should load seq with
+acquire semantics and put an acquire fence before loading it again.
+"""
+import argparse
+import collections
+import mmap
+import os
+import struct
+import sys
+import time
+
+
+SHM_DIR = '/dev/shm'  # Where Linux keeps POSIX shared memory objects
+SHM_MAGIC = b'LSHM'
+SHM_VERSION = 1
+SHM_BYTE_ORDER = 0x01020304
+
+# Same layout as ShmHeader, native byte order
+HEADER = struct.Struct('=4sIIIQQIIIIiiIIIIIiiiiiiII48s20x')
+FIELDS = ('magic version header_size byte_order seq generation layout live capacity steps'
+          ' ant_y ant_x ant_dir running grid_size sparse colored top left bottom right'
+          ' window_y window_x window_side def_color palette')
+Header = collections.namedtuple('Header', FIELDS)
+SEQ = struct.Struct('=Q')
+SEQ_OFFSET = 16
+
+
+def open_segment(name, wait):
+    path = os.path.join(SHM_DIR, name.lstrip('/'))
+    while True:
+        try:
+            with open(path, 'rb') as f:
+                return mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        except FileNotFoundError:
+            if not wait:
+                sys.exit("no segment named '%s'" % name)
+            time.sleep(0.1)
+
+
+def read_frame(mm):
+    """Reads a consistent header and window of cells, retrying while the simulator writes"""
+    while True:
+        seq, = SEQ.unpack_from(mm, SEQ_OFFSET)
+        if seq & 1:
+            time.sleep(0)  # Writes take a frame's worth of changes at most, usually far less
+            continue
+        header = Header(*HEADER.unpack_from(mm, 0))
+        begin = header.header_size
+        cells = mm[begin:begin + header.window_side**2]
+        if SEQ.unpack_from(mm, SEQ_OFFSET)[0] == seq:
+            return header, cells
+
+
+def check_header(header):
+    if header.magic != SHM_MAGIC or header.byte_order != SHM_BYTE_ORDER:
+        sys.exit("not a segment exported by this machine's simulator")
+    if header.version != SHM_VERSION:
+        sys.exit("unsupported segment version %d" % header.version)
+
+
+def render_ppm(header, cells):
+    """Binary PPM (P6) of the window, one pixel per cell"""
+    side = header.window_side
+    pixels = bytearray(3 * len(cells))
+    for i in range(3):  # One channel at a time, through a palette lookup table
+        table = bytes(header.palette[3*c + i] for c in range(16)) * 16
+        pixels[i::3] = cells.translate(table)
+    return b'P6\n%d %d\n255\n' % (side, side) + pixels
+
+
+def write_ppm(output, n, data):
+    if output == '-':
+        sys.stdout.buffer.write(data)
+        sys.stdout.buffer.flush()
+        return
+    filename = output % n if '%' in output else output
+    with open(filename + '.tmp', 'wb') as f:
+        f.write(data)
+    os.replace(filename + '.tmp', filename)  # Viewers never see a half-written file
+
+
+def describe(header):
+    return ("generation %d  layout %d  steps %d  grid %d%s  window %d at (%d, %d)  ant (%d, %d)"
+            % (header.generation, header.layout, header.steps, header.grid_size,
+               ' sparse' if header.sparse else '', header.window_side,
+               header.window_y, header.window_x, header.ant_y, header.ant_x))
+
+
+def run(args):
+    mm = open_segment(args.name, args.wait)
+    last, n = 0, 0
+    while not args.count or n < args.count:
+        header, cells = read_frame(mm)
+        check_header(header)
+        if header.generation == last:  # Nothing new, or nothing exported yet
+            if not header.live:
+                break
+            time.sleep(args.interval)
+            continue
+        last = header.generation
+        write_ppm(args.output, n, render_ppm(header, cells))
+        if args.verbose:
+            print(describe(header), file=sys.stderr)
+        n += 1
+        time.sleep(args.interval)
+    mm.close()
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('name', help="segment name given to -M")
+    parser.add_argument('-o', '--output', help="PPM file, %%d pattern or - for stdout (default: NAME.ppm)")
+    parser.add_argument('-n', '--count', type=int, default=1, help="frames to write, 0 until the simulator exits")
+    parser.add_argument('-i', '--interval', type=float, default=1/30, help="seconds between frames")
+    parser.add_argument('-w', '--wait', action='store_true', help="wait for the segment to be created")
+    parser.add_argument('-v', '--verbose', action='store_true', help="print the state of each frame")
+    args = parser.parse_args()
+    args.output = args.output or args.name.lstrip('/') + '.ppm'
+
+    try:
+        run(args)
+    except KeyboardInterrupt:
+        pass
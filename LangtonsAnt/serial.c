@@ -2,9 +2,46 @@
 
 #if SERIAL_COLORS
 
+#include "thread.h"
+
 #include <stdio.h>
 #include <string.h>
 
+#ifdef _WIN32
+#	include <Windows.h>
+#else
+#	include <errno.h>
+#	include <fcntl.h>
+#	include <poll.h>
+#	include <termios.h>
+#	include <unistd.h>
+#endif
+
+#ifdef _WIN32
+typedef HANDLE  port_t;
+#	define NO_PORT  INVALID_HANDLE_VALUE
+#else
+typedef int     port_t;
+#	define NO_PORT  (-1)
+#endif
+
+static struct serial_writer {
+	thread_t       thread;
+	bool           started;
+	mutex_t        lock;
+	cond_t         wake;                 /**< A new message, or stopping */
+	bool           stopping;
+	bool           pending;              /**< Does the device lack the latest rules? */
+	ColorRules     rules;                /**< Latest rules, older ones are dropped unsent */
+	char           device[FILENAME_SZ];  /**< Port to use, empty to look for one */
+
+	/* Only used by the writer thread */
+	port_t         port;
+	ColorRules     sent;                 /**< Rules the device was last sent */
+	byte           seq;                  /**< Number of the next frame */
+	bool           synced;               /**< Can the device take deltas on top of sent? */
+} writer;
+
 bool colors_to_color_rules(Colors *colors, ColorRules rules)
 {
 	color_t c;
@@ -34,61 +71,314 @@ bool colors_to_color_rules(Colors *colors, ColorRules rules)
 
 bool is_color_rule_valid(ColorRule rule)
 {
-	return rule.color != COLOR_NONE && rule.color != TURN_NONE;
+	return rule.color != COLOR_NONE && rule.turn != TURN_NONE;
 }
 
-void serialize_color_rules(ColorRules rules, ColorRulesMsg msg)
+static bool is_same_rule(ColorRule a, ColorRule b)
 {
-	size_t i;
-	msg[0] = '\0';
-	for (i = 0; i < COLOR_RULES_COUNT && is_color_rule_valid(rules[i]); i++) {
-		color_t c = rules[i].color;
-		turn_t  t = rules[i].turn;
-		const pixel_t *prgb = &color_map[RGB(c)];
+	bool valid = is_color_rule_valid(a);
+	return valid == is_color_rule_valid(b) && (!valid || (a.color == b.color && a.turn == b.turn));
+}
 
-		char tmp[COLOR_RULE_LEN+1];
-		snprintf(tmp, COLOR_RULE_LEN+1, COLOR_RULE_FMT,
-		         (*prgb)[0], (*prgb)[1], (*prgb)[2], TURN_CHAR(t));
-		strcat(msg, tmp);
+uint16_t frame_checksum(const byte *data, size_t len)
+{
+	unsigned sum1 = 0, sum2 = 0;
+	while (len--) {
+		sum1 = (sum1 + *data++) % 255;
+		sum2 = (sum2 + sum1) % 255;
 	}
+	return (uint16_t)(sum2 << 8 | sum1);
 }
 
-// TODO
-//bool deserialize_color_rules(ColorRules rules, ColorRulesMsg str)
-//{
-//	size_t i = 0;
-//	pixel_t prgb;
-//	turn_t turn;
-//	while (sscanf(str, COLOR_RULE_FMT, &prgb[0], &prgb[1], &prgb[2], &turn) == 4) {
-//	}
-//}
-
-bool serial_send_colors(Colors *colors)
+/** Encodes the rules that differ from the sent ones (all of them for a key frame), returns 0 if none do */
+size_t encode_color_rules(ColorRules rules, ColorRules sent, byte seq, bool key, ColorRulesFrame frame)
 {
-	FILE *pipe;
-	ColorRules rules;
-	ColorRulesMsg msg;
+	byte *p = frame + SERIAL_FRAME_HEAD_LEN;
+	unsigned mask = key ? SERIAL_FRAME_KEY : 0, i;
+	uint16_t sum;
 
-	if (!colors_to_color_rules(colors, rules)) {
-		return false;
+	for (i = 0; i < COLOR_RULES_COUNT; i++) {
+		if (!key && is_same_rule(rules[i], sent[i])) {
+			continue;
+		}
+		mask |= 1U << i;
+		if (is_color_rule_valid(rules[i])) {
+			memcpy(p, color_map[RGB(rules[i].color)], BYTES_PER_PIXEL);
+			p[3] = (byte)TURN_CHAR(rules[i].turn);
+		} else {
+			memset(p, 0, SERIAL_FRAME_RULE_LEN);  // Blank display
+		}
+		p += SERIAL_FRAME_RULE_LEN;
 	}
-	serialize_color_rules(rules, msg);
+	if (!(mask & SERIAL_DISPLAYS_MASK)) {
+		return 0;
+	}
+
+	frame[0] = SERIAL_FRAME_MAGIC;
+	frame[1] = seq;
+	frame[2] = (byte)(mask & 0xFF);
+	frame[3] = (byte)(mask >> 8);
+	sum = frame_checksum(frame + 1, (size_t)(p - frame - 1));
+	*p++ = (byte)(sum & 0xFF);
+	*p++ = (byte)(sum >> 8);
+	return (size_t)(p - frame);
+}
+
+/*----------------------------- Serial transport -----------------------------*/
 
 #ifdef _WIN32
-	pipe = _popen(SERIAL_SCRIPT, "w");
+
+static port_t open_port(const char *path)
+{
+	HANDLE h = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
+	COMMTIMEOUTS timeouts = { 0 };
+	DCB dcb = { 0 };
+
+	if (h == INVALID_HANDLE_VALUE) {
+		return NO_PORT;
+	}
+	dcb.DCBlength = sizeof dcb;
+	timeouts.ReadIntervalTimeout = MAXDWORD;  // Reads return at once with what's there
+	timeouts.WriteTotalTimeoutConstant = SERIAL_WRITE_TIMEOUT_MS;
+	if (!GetCommState(h, &dcb)) {
+		CloseHandle(h);
+		return NO_PORT;
+	}
+	dcb.BaudRate = SERIAL_BAUD_RATE;
+	dcb.ByteSize = 8;
+	dcb.Parity = NOPARITY;
+	dcb.StopBits = ONESTOPBIT;
+	if (!SetCommState(h, &dcb) || !SetCommTimeouts(h, &timeouts)) {
+		CloseHandle(h);
+		return NO_PORT;
+	}
+	return h;
+}
+
+static void close_port(port_t port)
+{
+	CloseHandle(port);
+}
+
+static bool write_port(port_t port, const byte *data, size_t len)
+{
+	DWORD written;
+	return WriteFile(port, data, (DWORD)len, &written, NULL) && written == len;  // Times out as set up
+}
+
+static size_t read_port(port_t port, byte *data, size_t len)
+{
+	DWORD n;
+	return ReadFile(port, data, (DWORD)len, &n, NULL) ? n : 0;
+}
+
 #else
-	pipe = popen(SERIAL_SCRIPT, "w");
+
+static port_t open_port(const char *path)
+{
+	struct termios tio;
+	int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+
+	if (fd < 0) {
+		return NO_PORT;
+	}
+	if (tcgetattr(fd, &tio) == 0) {  // Raw 8N1, anything else (e.g. a pipe) is written as is
+		cfmakeraw(&tio);
+		cfsetispeed(&tio, B115200);  // SERIAL_BAUD_RATE
+		cfsetospeed(&tio, B115200);
+		tio.c_cflag |= CLOCAL | CREAD;
+		if (tcsetattr(fd, TCSANOW, &tio) < 0) {
+			close(fd);
+			return NO_PORT;
+		}
+	}
+	return fd;
+}
+
+static void close_port(port_t port)
+{
+	close(port);
+}
+
+static bool write_port(port_t port, const byte *data, size_t len)
+{
+	while (len > 0) {
+		struct pollfd pfd = { .fd = port, .events = POLLOUT };
+		ssize_t n;
+
+		if (poll(&pfd, 1, SERIAL_WRITE_TIMEOUT_MS) <= 0 || (pfd.revents & (POLLERR | POLLHUP | POLLNVAL))) {
+			return false;  // Gone, or stuck
+		}
+		if ((n = write(port, data, len)) < 0) {
+			if (errno == EAGAIN || errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		data += n, len -= (size_t)n;
+	}
+	return true;
+}
+
+static size_t read_port(port_t port, byte *data, size_t len)
+{
+	ssize_t n;
+	if (!isatty(port)) {
+		return 0;  // Only a terminal device talks back, a pipe would hand over what was written
+	}
+	n = read(port, data, len);
+	return (n > 0) ? (size_t)n : 0;
+}
+
 #endif
-	if (!pipe) {
+
+static bool connect_port(void)
+{
+	char path[FILENAME_SZ];
+	unsigned i;
+
+	if (*writer.device) {
+		writer.port = open_port(writer.device);
+	}
+	for (i = 0; !*writer.device && i < SERIAL_PORT_COUNT && writer.port == NO_PORT; i++) {
+		snprintf(path, sizeof path, SERIAL_PORT_FMT, SERIAL_PORT_FIRST + i);
+		writer.port = open_port(path);
+	}
+	return writer.port != NO_PORT;
+}
+
+/* Did the device turn down a frame since the last check? */
+static bool was_nak_received(void)
+{
+	byte buf[64];
+	size_t i, n;
+	bool nak = false;
+
+	while ((n = read_port(writer.port, buf, sizeof buf)) > 0) {
+		for (i = 0; i < n; i++) {
+			nak |= (buf[i] == SERIAL_FRAME_NAK);
+		}
+	}
+	return nak;
+}
+
+static bool send_rules(ColorRules rules, bool refresh)
+{
+	ColorRulesFrame frame;
+	size_t len;
+
+	if (writer.port == NO_PORT) {
+		if (!connect_port()) {
+			return false;
+		}
+		writer.synced = false;  // Whatever it shows didn't come from this connection
+	}
+	if (was_nak_received()) {
+		writer.synced = false;
+	}
+
+	len = encode_color_rules(rules, writer.sent, writer.seq, refresh || !writer.synced, frame);
+	if (len && !write_port(writer.port, frame, len)) {
 		return false;
 	}
-	bool success = (fputs(msg, pipe) != EOF);
-#ifdef _WIN32
-	_pclose(pipe);
-#else
-	pclose(pipe);
-#endif
-	return success;
+	if (len) {
+		memcpy(writer.sent, rules, sizeof writer.sent);
+		writer.seq++;
+		writer.synced = true;
+	}
+	return true;
+}
+
+static void *writer_thread(void *arg)
+{
+	ColorRules rules;
+	bool ok, refresh;
+
+	(void)arg;
+	mutex_lock(&writer.lock);
+	while (!writer.stopping) {
+		refresh = false;
+		if (!writer.pending && writer.port == NO_PORT) {
+			cond_wait(&writer.wake, &writer.lock);
+			continue;
+		} else if (!writer.pending) {
+			/* Nothing new for a while, resend everything in case the device missed something */
+			if (!(refresh = !cond_timedwait(&writer.wake, &writer.lock, SERIAL_REFRESH_MS))) {
+				continue;
+			}
+		}
+		memcpy(rules, writer.rules, sizeof rules);
+		writer.pending = false;
+		mutex_unlock(&writer.lock);
+
+		if (!(ok = send_rules(rules, refresh)) && writer.port != NO_PORT) {
+			close_port(writer.port);  // Unplugged or reset, reopened on the next try
+			writer.port = NO_PORT;
+		}
+
+		mutex_lock(&writer.lock);
+		if (!ok) {
+			writer.pending = true;  // Whatever is latest by then goes out on the next try
+			if (!writer.stopping) {
+				cond_timedwait(&writer.wake, &writer.lock, SERIAL_RETRY_MS);
+			}
+		}
+	}
+	mutex_unlock(&writer.lock);
+
+	if (writer.port != NO_PORT) {
+		close_port(writer.port);
+		writer.port = NO_PORT;
+	}
+	return NULL;
+}
+
+bool serial_start(const char *device)
+{
+	snprintf(writer.device, sizeof writer.device, "%s", device ? device : "");
+	writer.port = NO_PORT;
+	writer.stopping = false;
+	writer.pending = false;
+	writer.seq = 0;
+	writer.synced = false;
+	mutex_init(&writer.lock);
+	cond_init(&writer.wake);
+	if (!(writer.started = thread_create(&writer.thread, writer_thread, NULL))) {
+		mutex_destroy(&writer.lock);
+		cond_destroy(&writer.wake);
+	}
+	return writer.started;
+}
+
+void serial_stop(void)
+{
+	if (!writer.started) {
+		return;
+	}
+	mutex_lock(&writer.lock);
+	writer.stopping = true;
+	cond_signal(&writer.wake);
+	mutex_unlock(&writer.lock);
+	thread_join(writer.thread);
+	mutex_destroy(&writer.lock);
+	cond_destroy(&writer.wake);
+	writer.started = false;
+}
+
+bool serial_send_colors(Colors *colors)
+{
+	ColorRules rules;
+
+	if (!writer.started || !colors_to_color_rules(colors, rules)) {
+		return false;
+	}
+
+	mutex_lock(&writer.lock);
+	memcpy(writer.rules, rules, sizeof rules);  // Replaces ones not sent yet
+	writer.pending = true;
+	cond_signal(&writer.wake);
+	mutex_unlock(&writer.lock);
+	return true;
 }
 
 #endif  // SERIAL_COLORS
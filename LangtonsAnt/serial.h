@@ -1,7 +1,7 @@
 /**
  * @file serial.h
  * Extension for data input/output via serial
- * Requires external script [-DSERIAL_SCRIPT] and -DSERIAL_COLORS/-D...
+ * Requires -DSERIAL_COLORS/-D... and a device on a serial port [-DSERIAL_DEVICE]
  * @author vomindoraan
  */
 #ifndef __SERIAL_H__
@@ -15,8 +15,8 @@
 #	define SERIAL_COLORS  0
 #endif
 
-#ifndef SERIAL_SCRIPT
-#	define SERIAL_SCRIPT  "scripts/write_serial.py"
+#ifndef SERIAL_DEVICE
+#	define SERIAL_DEVICE  NULL  // Look for one
 #endif
 ///@}
 
@@ -27,15 +27,47 @@
 
 /*---------------------- Serialization macros and types ----------------------*/
 
-/** Serialized color rules, format: {RRGGBB,T} */
+#define COLOR_RULES_COUNT  (COLOR_COUNT - 2)  // def_color, COLOR_NONE
+
+/**
+ * @name Color rules frame
+ * Format: MAGIC SEQ MASK_LO MASK_HI {R G B T}... SUM_LO SUM_HI
+ *
+ * Bit i of the mask is set for each display whose rule is in the frame, in
+ * display order. T is the turn character, or '\0' for a blank display.
+ * A delta frame only applies on top of the one numbered SEQ-1; a key frame
+ * (SERIAL_FRAME_KEY) carries every display and applies regardless. SUM is the
+ * Fletcher-16 checksum of everything between MAGIC and itself. The device
+ * answers a frame it can't apply with SERIAL_FRAME_NAK and ignores deltas
+ * until the next key frame.
+ */
 ///@{
-#define COLOR_RULE_FMT       "{%02hhx%02hhx%02hhx,%c}"
-#define COLOR_RULE_LEN       (BYTES_PER_PIXEL*2 + 1 + 3)
-#define COLOR_RULE_SZ        (COLOR_RULE_LEN + 1)
+#define SERIAL_FRAME_MAGIC     0xA5U
+#define SERIAL_FRAME_NAK       0x15U
+#define SERIAL_FRAME_KEY       0x8000U
+#define SERIAL_DISPLAYS_MASK   ((1U << COLOR_RULES_COUNT) - 1)
 
-#define COLOR_RULES_COUNT    (COLOR_COUNT - 2)  // def_color, COLOR_NONE
-#define COLOR_RULES_MSG_LEN  (COLOR_RULES_COUNT * COLOR_RULE_LEN)
-#define COLOR_RULES_MSG_SZ   (COLOR_RULES_MSG_LEN + 1)
+#define SERIAL_FRAME_HEAD_LEN  4
+#define SERIAL_FRAME_RULE_LEN  4
+#define SERIAL_FRAME_SUM_LEN   2
+#define SERIAL_FRAME_LEN(n)    (SERIAL_FRAME_HEAD_LEN + (n)*SERIAL_FRAME_RULE_LEN + SERIAL_FRAME_SUM_LEN)
+#define SERIAL_FRAME_MAX_LEN   SERIAL_FRAME_LEN(COLOR_RULES_COUNT)
+///@}
+
+/** @name Serial transport attributes */
+///@{
+#define SERIAL_BAUD_RATE         115200U
+#define SERIAL_RETRY_MS          1000U  /**< Wait between attempts to (re)connect */
+#define SERIAL_WRITE_TIMEOUT_MS  500U   /**< A device taking no data for this long is reconnected */
+#define SERIAL_REFRESH_MS        2000U  /**< Idle time after which a key frame is resent */
+#ifdef _WIN32
+#	define SERIAL_PORT_FMT      "\\\\.\\COM%u"
+#	define SERIAL_PORT_FIRST    1U
+#else
+#	define SERIAL_PORT_FMT      "/dev/ttyACM%u"
+#	define SERIAL_PORT_FIRST    0U
+#endif
+#define SERIAL_PORT_COUNT        16U    /**< Ports tried when looking for a device */
 ///@}
 
 /** Single (color, turn) pair */
@@ -47,7 +79,7 @@ typedef struct color_rule {
 /** Serialization types */
 ///@{
 typedef ColorRule  ColorRules[COLOR_RULES_COUNT];
-typedef char       ColorRulesMsg[COLOR_RULES_MSG_SZ];
+typedef byte       ColorRulesFrame[SERIAL_FRAME_MAX_LEN];
 ///@}
 
 
@@ -57,8 +89,10 @@ typedef char       ColorRulesMsg[COLOR_RULES_MSG_SZ];
 
 bool colors_to_color_rules(Colors *colors, ColorRules rules);
 bool is_color_rule_valid(ColorRule rule);
-void serialize_color_rules(ColorRules rules, ColorRulesMsg msg);
-//bool deserialize_color_rules(ColorRules rules, ColorRulesMsg msg);  // TODO
+uint16_t frame_checksum(const byte *data, size_t len);
+size_t encode_color_rules(ColorRules rules, ColorRules sent, byte seq, bool key, ColorRulesFrame frame);
+bool serial_start(const char *device);
+void serial_stop(void);
 bool serial_send_colors(Colors *colors);
 
 #endif  // SERIAL_COLORS
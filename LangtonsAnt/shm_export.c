@@ -0,0 +1,204 @@
+#include "io.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+ShmExport *active_shm_export;
+
+#ifndef _WIN32
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+
+#define SEGMENT_SZ  (sizeof(ShmHeader) + (size_t)SHM_CAPACITY)
+
+_Static_assert(sizeof(ShmHeader) == 176 && offsetof(ShmHeader, seq) == 16,
+               "ShmHeader is read by other programs, see scripts/shm_reader.py");
+
+struct shm_export {
+	char         name[FILENAME_SZ];
+	ShmHeader   *header;
+	byte        *cells;    /**< Right after the header */
+	CellFeed    *feed;
+	Simulation  *sim;      /**< Simulation exported by the last update */
+	unsigned     epoch;
+	bool         written;  /**< Has the window been written in full yet? */
+};
+
+/*--------------------------------- Seqlock ----------------------------------*/
+
+/* Only the main loop writes, so seq needs no read-modify-write */
+static void begin_write(ShmHeader *h)
+{
+	__atomic_store_n(&h->seq, h->seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);  // Odd seq is visible before any of the writes
+}
+
+static void end_write(ShmHeader *h)
+{
+	__atomic_store_n(&h->seq, h->seq + 1, __ATOMIC_RELEASE);
+}
+
+/*---------------------------------- Cells -----------------------------------*/
+
+static bool is_layout_changed(ShmExport *exp, Simulation *sim, unsigned epoch)
+{
+	ShmHeader *h = exp->header;
+	return !exp->written || sim != exp->sim || epoch != exp->epoch
+	    || sim->grid->size != h->grid_size || is_grid_sparse(sim->grid) != (bool)h->sparse;
+}
+
+/* Rewrites the whole window, placing it in the middle of the grid */
+static void write_window(ShmHeader *h, byte *cells, Grid *grid)
+{
+	unsigned side = MIN(grid->size, SHM_MAX_SIDE), y;
+	int first = (int)((grid->size - side) / 2);
+
+	h->window_y = h->window_x = first - (int)(grid->size / 2);
+	h->window_side = side;
+	for (y = 0; y < side; y++) {
+		grid_read_row(grid, first + (int)y, first, side, cells + (size_t)y*side);
+	}
+}
+
+static void write_change(ShmHeader *h, byte *cells, const CellChange *change)
+{
+	unsigned y = (unsigned)(change->y - h->window_y), x = (unsigned)(change->x - h->window_x);
+	if (y < h->window_side && x < h->window_side) {
+		cells[(size_t)y*h->window_side + x] = change->new_color;
+	}
+}
+
+static void write_state(ShmHeader *h, Simulation *sim)
+{
+	Grid *grid = sim->grid;
+	int center = (int)(grid->size / 2);
+
+	h->steps = sim->steps;
+	h->ant_y = sim->ant->pos.y - center;
+	h->ant_x = sim->ant->pos.x - center;
+	h->ant_dir = sim->ant->dir;
+	h->running = is_simulation_running(sim);
+	h->grid_size = grid->size;
+	h->sparse = is_grid_sparse(grid);
+	h->colored = grid->colored;
+	h->top = grid->top_left.y - center;
+	h->left = grid->top_left.x - center;
+	h->bottom = grid->bottom_right.y - center;
+	h->right = grid->bottom_right.x - center;
+	h->def_color = grid->def_color;
+}
+
+/*---------------------------------- Export ----------------------------------*/
+
+ShmExport *shm_export_start(const char *name, Simulation *sim)
+{
+	ShmExport *exp;
+	ShmHeader *h;
+	void *p;
+	int fd, c;
+
+	if (!(exp = calloc(1, sizeof(ShmExport)))) {
+		return NULL;
+	}
+	snprintf(exp->name, sizeof exp->name, "%s%s", (*name == '/') ? "" : "/", name);
+	shm_unlink(exp->name);  // Readers of a stale segment keep it until they unmap it
+	if ((fd = shm_open(exp->name, O_RDWR | O_CREAT | O_EXCL, 0644)) < 0) {
+		goto error_end;
+	}
+	if (ftruncate(fd, (off_t)SEGMENT_SZ) < 0
+	 || (p = mmap(NULL, SEGMENT_SZ, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+		close(fd);
+		goto unlink_end;
+	}
+	close(fd);  // The mapping keeps the segment open
+	if (!(exp->feed = feed_new(SHM_FEED_CAPACITY, FEED_DROP))) {
+		munmap(p, SEGMENT_SZ);
+		goto unlink_end;
+	}
+
+	h = exp->header = p;  // Comes zeroed, so seq is even and generation 0 until the first update
+	exp->cells = (byte*)p + sizeof(ShmHeader);
+	memcpy(h->magic, SHM_MAGIC, SHM_MAGIC_SZ);
+	h->version = SHM_VERSION;
+	h->header_size = sizeof(ShmHeader);
+	h->byte_order = SHM_BYTE_ORDER;
+	h->capacity = SHM_CAPACITY;
+	h->live = true;
+	for (c = 0; c < COLOR_COUNT; c++) {
+		h->palette[c][0] = color_map[c][2];
+		h->palette[c][1] = color_map[c][1];
+		h->palette[c][2] = color_map[c][0];
+	}
+	feed_subscribe(sim, exp->feed);  // Marked for resync, so the first update writes everything
+	return exp;
+
+unlink_end:
+	shm_unlink(exp->name);
+error_end:
+	free(exp);
+	return NULL;
+}
+
+void shm_export_update(ShmExport *exp, Simulation *sim, unsigned epoch)
+{
+	ShmHeader *h = exp->header;
+	CellChange changes[256];
+	bool full = feed_take_resync(exp->feed), relayout = is_layout_changed(exp, sim, epoch);
+	size_t n, i;
+
+	begin_write(h);
+	full |= relayout;
+	while ((n = feed_read(exp->feed, changes, LEN(changes)))) {
+		for (i = 0; i < n && !full; i++) {
+			write_change(h, exp->cells, &changes[i]);
+		}
+	}
+	if (full) {  // Also covers whatever was drained unseen, nothing steps while the engine is locked
+		write_window(h, exp->cells, sim->grid);
+		h->layout += relayout;
+	}
+	write_state(h, sim);
+	h->generation++;
+	end_write(h);
+
+	exp->sim = sim;
+	exp->epoch = epoch;
+	exp->written = true;
+}
+
+void shm_export_stop(ShmExport *exp, Simulation *sim)
+{
+	begin_write(exp->header);
+	exp->header->live = false;
+	end_write(exp->header);
+
+	feed_unsubscribe(sim, exp->feed);
+	feed_delete(exp->feed);
+	munmap(exp->header, SEGMENT_SZ);
+	shm_unlink(exp->name);
+	free(exp);
+}
+
+#else
+
+ShmExport *shm_export_start(const char *name, Simulation *sim)
+{
+	(void)name, (void)sim;
+	return NULL;  // No POSIX shared memory, the option fails
+}
+
+void shm_export_update(ShmExport *exp, Simulation *sim, unsigned epoch)
+{
+	(void)exp, (void)sim, (void)epoch;
+}
+
+void shm_export_stop(ShmExport *exp, Simulation *sim)
+{
+	(void)exp, (void)sim;
+}
+
+#endif  // _WIN32
@@ -12,17 +12,50 @@ Simulation *simulation_new(Colors *colors, unsigned init_size)
 	sim->ant = ant_new(sim->grid, DIR_UP);
 	sim->steps = 0;
 	sim->is_running = false;
+	sim->trajectory = NULL;
+	sim->checkpoint = NULL;
+	sim->feeds = NULL;
 	return sim;
 }
 
 void simulation_delete(Simulation *sim)
 {
 	assert(sim);
+	if (sim->trajectory) {
+		trajectory_stop(sim);
+	}
 	grid_delete(sim->grid);
 	ant_delete(sim->ant);
 	free(sim);
 }
 
+Simulation *simulation_copy(Simulation *sim)
+{
+	assert(sim);
+	Simulation *copy = malloc(sizeof(Simulation));
+	if (!copy) {
+		return NULL;
+	}
+	*copy = *sim;
+	copy->colors = malloc(sizeof(Colors));
+	copy->grid = grid_copy(sim->grid);
+	copy->ant = malloc(sizeof(Ant));
+	if (!copy->colors || !copy->grid || !copy->ant) {
+		free(copy->colors);
+		if (copy->grid) {
+			grid_delete(copy->grid);
+		}
+		free(copy->ant), free(copy);
+		return NULL;
+	}
+	*copy->colors = *sim->colors;  // Owned by the copy, delete separately
+	*copy->ant = *sim->ant;
+	copy->trajectory = NULL;  // Only the original is logged
+	copy->checkpoint = NULL;
+	copy->feeds = NULL;
+	return copy;
+}
+
 void simulation_run(Simulation *sim)
 {
 	assert(sim);
@@ -35,16 +68,47 @@ void simulation_halt(Simulation *sim)
 	sim->is_running = false;
 }
 
+/* Color ant_move leaves in a cell of the given color */
+static byte next_color(Colors *colors, byte c)
+{
+	if (is_color_special(colors, c)) {
+		c = (byte)colors->next[c];  // In-place color changing
+	}
+	return (byte)colors->next[c];
+}
+
 bool simulation_step(Simulation *sim)
 {
 	assert(sim);
-	bool was_sparse = is_grid_sparse(sim->grid);
-	bool in_bounds = ant_move(sim->ant, sim->grid, sim->colors);
+	bool was_sparse = is_grid_sparse(sim->grid), in_bounds;
+	bool publish = sim->feeds && feed_is_wanted(sim);
+	Direction dir = sim->ant->dir;
+	CellChange change;
+	int center;
+
+	if (publish) {
+		center = (int)(sim->grid->size / 2);  // Invariant under grid expansion
+		change.y = sim->ant->pos.y - center;
+		change.x = sim->ant->pos.x - center;
+		change.old_color = GRID_ANT_COLOR(sim->grid, sim->ant);
+	}
+	if (sim->checkpoint) {
+		checkpoint_mark(sim->checkpoint, sim);  // Cell under the ant is about to change
+	}
+	in_bounds = ant_move(sim->ant, sim->grid, sim->colors);
 	grid_silent_expand(sim->grid);
 	if (!in_bounds) {
 		grid_expand(sim->grid, sim->ant);
 	}
 	sim->steps++;
+	if (sim->trajectory) {
+		trajectory_record(sim->trajectory, sim, dir);
+	}
+	if (publish) {
+		change.new_color = next_color(sim->colors, change.old_color);  // Saves looking the cell up again
+		change.step = sim->steps;
+		feed_publish(sim, &change);
+	}
 	return in_bounds && was_sparse == is_grid_sparse(sim->grid);
 }
 
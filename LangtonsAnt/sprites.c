@@ -1,6 +1,8 @@
 #include "sprites.h"
 
 #include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
 
 #define ANT_S_SZ       SPRITE_SZ_(SPRITE_ANT_SIZE_SMALL)
 #define ANT_M_SZ       SPRITE_SZ_(SPRITE_ANT_SIZE_MEDIUM)
@@ -172,3 +174,110 @@ SpriteInfo ui_sprite(UISpriteType type, int arg)
 		return assert(0), SI_NONE;
 	}
 }
+
+#define SPAN_CACHE_SZ  128  // Power of 2, well above the number of sprites
+
+typedef struct span_cache_entry {
+	const byte  *data;
+	unsigned     width;
+	SpriteSpans  ss;
+} SpanCacheEntry;
+
+static SpanCacheEntry span_cache[SPAN_CACHE_SZ];
+
+static SpriteSpans compile_spans(SpriteInfo sprite)
+{
+	SpriteSpan *spans, *s;
+	unsigned y, x, count = 0;
+	bool prev;
+
+#define PIXEL_AT(y, x)  ((sprite.data[((y)*sprite.width + (x)) / 8] \
+                          >> (7 - ((y)*sprite.width + (x)) % 8)) & 1)
+
+	for (y = 0; y < sprite.height; y++) {
+		for (x = 0, prev = false; x < sprite.width; x++) {
+			bool pixel = PIXEL_AT(y, x);
+			count += pixel && !prev;
+			prev = pixel;
+		}
+	}
+	if (!count || !(spans = malloc(count * sizeof(SpriteSpan)))) {
+		return (SpriteSpans) { NULL, 0 };
+	}
+
+	for (y = 0, s = spans - 1; y < sprite.height; y++) {
+		for (x = 0, prev = false; x < sprite.width; x++) {
+			bool pixel = PIXEL_AT(y, x);
+			if (pixel && !prev) {
+				*++s = (SpriteSpan) { (byte)y, (byte)x, 0 };
+			}
+			if (pixel) {
+				s->len++;  // s is only valid once the first span has started
+			}
+			prev = pixel;
+		}
+	}
+
+#undef PIXEL_AT
+	return (SpriteSpans) { spans, count };
+}
+
+static SpanCacheEntry *span_cache_slot(SpriteInfo sprite)
+{
+	uintptr_t h = ((uintptr_t)sprite.data >> 1) * 2654435761U + sprite.width;
+	unsigned i = (unsigned)h & (SPAN_CACHE_SZ-1), n;
+
+	for (n = 0; n < SPAN_CACHE_SZ; n++, i = (i+1) & (SPAN_CACHE_SZ-1)) {
+		SpanCacheEntry *e = &span_cache[i];
+		if (!e->data || (e->data == sprite.data && e->width == sprite.width)) {
+			return e;
+		}
+	}
+	return NULL;  // Full, should never happen
+}
+
+SpriteSpans sprite_spans(SpriteInfo sprite)
+{
+	SpanCacheEntry *e;
+
+	if (!sprite.data) {
+		return (SpriteSpans) { NULL, 0 };
+	}
+	if (!(e = span_cache_slot(sprite))) {
+		return compile_spans(sprite);  // Leaks, but unreachable in practice
+	}
+	if (!e->data) {
+		e->data = sprite.data;
+		e->width = sprite.width;
+		e->ss = compile_spans(sprite);
+	}
+	return e->ss;
+}
+
+void init_sprites(void)
+{
+	unsigned sizes[] = { SPRITE_ANT_SIZE_SMALL, SPRITE_ANT_SIZE_MEDIUM, SPRITE_ANT_SIZE_LARGE };
+	unsigned i;
+	int arg;
+
+	for (i = 0; i < LEN(sizes); i++) {
+		for (arg = DIR_UP; arg <= DIR_LEFT; arg++) {
+			sprite_spans(ant_sprite(sizes[i], arg));
+		}
+	}
+	for (i = 0; i < LEN(logo_sprites); i++) {
+		sprite_spans(logo_sprite(i, false));
+		sprite_spans(logo_sprite(i, true));
+	}
+	for (arg = DIR_UP; arg <= DIR_LEFT; arg++) {
+		sprite_spans(ui_sprite(UI_ARROW, arg));
+	}
+	sprite_spans(ui_sprite(UI_STEPUP, 0));
+	for (arg = 0; arg < _UIB_COUNT; arg++) {
+		sprite_spans(ui_sprite(UI_BUTTON, arg));
+	}
+	for (arg = 0; arg < 10; arg++) {
+		sprite_spans(ui_sprite(UI_DIGIT, arg));
+	}
+	sprite_spans(ui_sprite(UI_INFINITY, 0));
+}
@@ -52,6 +52,17 @@ typedef struct sprite_info {
 	const unsigned  width, height;  /**< Sprite size */  /**@}*/
 } SpriteInfo;
 
+/** Horizontal run of set pixels within a sprite row */
+typedef struct sprite_span {
+	byte  y, x, len;
+} SpriteSpan;
+
+/** Sprite precompiled into a list of runs, for drawing one line per run */
+typedef struct sprite_spans {
+	const SpriteSpan  *spans;  /**< Runs in row-major order */
+	unsigned           count;  /**< Number of runs */
+} SpriteSpans;
+
 typedef struct logo_sprite {
 	sprite_t  base[SPRITE_LOGO_SZ];
 	sprite_t  hl[SPRITE_LOGO_SZ];
@@ -97,4 +108,18 @@ SpriteInfo ant_sprite(unsigned size, Direction dir);
 SpriteInfo logo_sprite(unsigned index, bool highlight);
 SpriteInfo ui_sprite(UISpriteType type, int arg);
 
+/**
+ * Precompiles all ant, logo and UI sprites into horizontal runs
+ * @see sprite_spans(SpriteInfo)
+ */
+void init_sprites(void);
+
+/**
+ * Finds the precompiled runs of a sprite, compiling them first if needed
+ * @param sprite Sprite data and size
+ * @return Runs of set pixels (empty for SI_NONE)
+ * @see init_sprites(void)
+ */
+SpriteSpans sprite_spans(SpriteInfo sprite);
+
 #endif  // __SPRITES_H__
@@ -0,0 +1,179 @@
+#include "thread.h"
+
+#include <stdlib.h>
+
+#ifdef _WIN32
+
+typedef struct thread_start {
+	thread_func_t  func;
+	void          *arg;
+} ThreadStart;
+
+static DWORD WINAPI thread_trampoline(LPVOID param)
+{
+	ThreadStart start = *(ThreadStart *)param;
+	free(param);
+	(*start.func)(start.arg);
+	return 0;
+}
+
+bool thread_create(thread_t *thread, thread_func_t func, void *arg)
+{
+	ThreadStart *start = malloc(sizeof(ThreadStart));
+	if (!start) {
+		return false;
+	}
+	start->func = func;
+	start->arg = arg;
+	if (!(*thread = CreateThread(NULL, 0, thread_trampoline, start, 0, NULL))) {
+		free(start);
+		return false;
+	}
+	return true;
+}
+
+void thread_join(thread_t thread)
+{
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+}
+
+unsigned thread_count_hint(void)
+{
+	SYSTEM_INFO si;
+	GetSystemInfo(&si);
+	return (si.dwNumberOfProcessors < 1) ? 1
+	     : (si.dwNumberOfProcessors > THREAD_MAX_WORKERS) ? THREAD_MAX_WORKERS
+	     : (unsigned)si.dwNumberOfProcessors;
+}
+
+void mutex_init(mutex_t *mutex)
+{
+	InitializeSRWLock(mutex);
+}
+
+void mutex_destroy(mutex_t *mutex)
+{
+	(void)mutex;  // SRW locks need no cleanup
+}
+
+void mutex_lock(mutex_t *mutex)
+{
+	AcquireSRWLockExclusive(mutex);
+}
+
+void mutex_unlock(mutex_t *mutex)
+{
+	ReleaseSRWLockExclusive(mutex);
+}
+
+void cond_init(cond_t *cond)
+{
+	InitializeConditionVariable(cond);
+}
+
+void cond_destroy(cond_t *cond)
+{
+	(void)cond;
+}
+
+void cond_wait(cond_t *cond, mutex_t *mutex)
+{
+	SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+}
+
+bool cond_timedwait(cond_t *cond, mutex_t *mutex, unsigned timeout_ms)
+{
+	return SleepConditionVariableSRW(cond, mutex, timeout_ms, 0);
+}
+
+void cond_signal(cond_t *cond)
+{
+	WakeConditionVariable(cond);
+}
+
+void cond_broadcast(cond_t *cond)
+{
+	WakeAllConditionVariable(cond);
+}
+
+#else
+#	include <errno.h>
+#	include <time.h>
+#	include <unistd.h>
+
+bool thread_create(thread_t *thread, thread_func_t func, void *arg)
+{
+	return pthread_create(thread, NULL, func, arg) == 0;
+}
+
+void thread_join(thread_t thread)
+{
+	pthread_join(thread, NULL);
+}
+
+unsigned thread_count_hint(void)
+{
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return (n < 1) ? 1 : (n > THREAD_MAX_WORKERS) ? THREAD_MAX_WORKERS : (unsigned)n;
+}
+
+void mutex_init(mutex_t *mutex)
+{
+	pthread_mutex_init(mutex, NULL);
+}
+
+void mutex_destroy(mutex_t *mutex)
+{
+	pthread_mutex_destroy(mutex);
+}
+
+void mutex_lock(mutex_t *mutex)
+{
+	pthread_mutex_lock(mutex);
+}
+
+void mutex_unlock(mutex_t *mutex)
+{
+	pthread_mutex_unlock(mutex);
+}
+
+void cond_init(cond_t *cond)
+{
+	pthread_cond_init(cond, NULL);
+}
+
+void cond_destroy(cond_t *cond)
+{
+	pthread_cond_destroy(cond);
+}
+
+void cond_wait(cond_t *cond, mutex_t *mutex)
+{
+	pthread_cond_wait(cond, mutex);
+}
+
+bool cond_timedwait(cond_t *cond, mutex_t *mutex, unsigned timeout_ms)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec  += timeout_ms / 1000;
+	ts.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+	return pthread_cond_timedwait(cond, mutex, &ts) != ETIMEDOUT;
+}
+
+void cond_signal(cond_t *cond)
+{
+	pthread_cond_signal(cond);
+}
+
+void cond_broadcast(cond_t *cond)
+{
+	pthread_cond_broadcast(cond);
+}
+
+#endif  // _WIN32
@@ -0,0 +1,101 @@
+/**
+ * @file thread.h
+ * Minimal portable threading primitives (Win32 threads or pthreads)
+ * @author vomindoraan
+ */
+#ifndef __THREAD_H__
+#define __THREAD_H__
+
+#include <stdbool.h>
+
+#ifdef _WIN32
+#	include <Windows.h>
+#else
+#	include <pthread.h>
+#endif
+
+
+/*------------------------- Threading macros and types -----------------------*/
+
+/** Upper bound for worker pools, regardless of the number of CPUs */
+#define THREAD_MAX_WORKERS  16
+
+/** Thread entry point */
+typedef void  *(*thread_func_t)(void *);
+
+/** @name Platform-specific primitives */
+///@{
+#ifdef _WIN32
+typedef HANDLE              thread_t;
+typedef SRWLOCK             mutex_t;
+typedef CONDITION_VARIABLE  cond_t;
+#else
+typedef pthread_t           thread_t;
+typedef pthread_mutex_t     mutex_t;
+typedef pthread_cond_t      cond_t;
+#endif
+///@}
+
+/** Storage class of variables with a copy per thread */
+#ifdef _WIN32
+#	define THREAD_LOCAL  __declspec(thread)
+#else
+#	define THREAD_LOCAL  __thread
+#endif
+
+/** @name Atomic machine words, sequentially consistent */
+///@{
+#ifdef _WIN32
+typedef volatile LONG       atomic_word_t;
+#	define atomic_word_load(p)      InterlockedCompareExchange((p), 0, 0)
+#	define atomic_word_store(p, v)  (void)InterlockedExchange((p), (LONG)(v))
+#	define atomic_word_add(p, v)    InterlockedExchangeAdd((p), (LONG)(v))
+#else
+typedef volatile long       atomic_word_t;
+#	define atomic_word_load(p)      __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#	define atomic_word_store(p, v)  __atomic_store_n((p), (long)(v), __ATOMIC_SEQ_CST)
+#	define atomic_word_add(p, v)    __atomic_fetch_add((p), (long)(v), __ATOMIC_SEQ_CST)
+#endif
+///@}
+
+
+/*----------------------------------------------------------------------------*
+ *                                  thread.c                                  *
+ *----------------------------------------------------------------------------*/
+
+/**
+ * Starts a new thread
+ * @param thread Filled in with the new thread's handle
+ * @param func Thread entry point
+ * @param arg Argument passed to func
+ * @return Was the thread started?
+ * @see thread_join(thread_t)
+ */
+bool thread_create(thread_t *thread, thread_func_t func, void *arg);
+
+/**
+ * Waits for a thread to finish and releases its handle
+ * @param thread Thread to wait for
+ * @see thread_create(thread_t *, thread_func_t, void *)
+ */
+void thread_join(thread_t thread);
+
+/**
+ * Finds a suitable number of worker threads for the machine
+ * @return Number of online CPUs, clamped to [1, THREAD_MAX_WORKERS]
+ */
+unsigned thread_count_hint(void);
+
+// Thin wrappers around the platform primitives
+void mutex_init(mutex_t *mutex);
+void mutex_destroy(mutex_t *mutex);
+void mutex_lock(mutex_t *mutex);
+void mutex_unlock(mutex_t *mutex);
+void cond_init(cond_t *cond);
+void cond_destroy(cond_t *cond);
+void cond_wait(cond_t *cond, mutex_t *mutex);
+bool cond_timedwait(cond_t *cond, mutex_t *mutex, unsigned timeout_ms);
+void cond_signal(cond_t *cond);
+void cond_broadcast(cond_t *cond);
+
+#endif  // __THREAD_H__
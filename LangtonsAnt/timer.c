@@ -32,13 +32,13 @@ ttime_t timer_micros(void)
 }
 
 #else
-#	include <sys/time.h>
+#	include <time.h>
 
-struct timeval start;
+static struct timespec start;
 
 void init_timer(void)
 {
-	gettimeofday(&start, 0);
+	clock_gettime(CLOCK_MONOTONIC, &start);  // Unaffected by changes to the wall clock
 }
 
 ttime_t timer_millis(void)
@@ -48,13 +48,10 @@ ttime_t timer_millis(void)
 
 ttime_t timer_micros(void)
 {
-	ttime_t ds, dus;
-	struct timeval now;
+	struct timespec now;
 
-	gettimeofday(&now, 0);
-	ds  = now.tv_sec  - start.tv_sec;
-	dus = now.tv_usec - start.tv_usec;
-	return (ttime_t)(ds*1e6 + dus);
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (ttime_t)(now.tv_sec - start.tv_sec) * 1000000 + (now.tv_nsec - start.tv_nsec) / 1000;
 }
 
 #endif  // _WIN32
@@ -0,0 +1,348 @@
+#include "logic.h"
+#include "thread.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Bytes of turn bits in a block */
+#define BITS_SZ   (TRAJ_BLOCK_STEPS / 8)
+
+/** Keyframe and turn bits, as laid out in the file */
+typedef struct traj_block {
+	TrajKeyframe  key;
+	uint64_t      bits[BITS_SZ / sizeof(uint64_t)];
+} TrajBlock;
+
+struct trajectory {
+	FILE       *output;
+	TrajBlock   blocks[TRAJ_BUFFERS];  /**< Ring: written from head, filled after the queued ones */
+	TrajBlock  *fill;                  /**< Block the simulation thread is filling */
+	unsigned    head, queued;
+	bool        closing, failed;
+	mutex_t     lock;
+	cond_t      cond;
+	thread_t    thread;
+};
+
+struct trajectory_reader {
+	FILE           *input;
+	uint64_t        block_count;
+	TrajBlock       block;
+	uint64_t        loaded;   /**< Index of the block read in, block_count if none */
+	uint64_t        origin;   /**< Index of the block the state was replayed in */
+	TrajectoryState state;
+};
+
+/* File offsets past 2 GiB, logs of billions of steps get there */
+static int seek_to(FILE *file, uint64_t offset)
+{
+#ifdef _WIN32
+	return _fseeki64(file, (__int64)offset, SEEK_SET);
+#else
+	return fseeko(file, (off_t)offset, SEEK_SET);
+#endif
+}
+
+/* Seeks to the end, returns the file size or -1 */
+static long long seek_to_end(FILE *file)
+{
+#ifdef _WIN32
+	return _fseeki64(file, 0, SEEK_END) ? -1 : (long long)_ftelli64(file);
+#else
+	return fseeko(file, 0, SEEK_END) ? -1 : (long long)ftello(file);
+#endif
+}
+
+/* Can the log be appended to? Only if it's empty or its last block ends at the given step */
+static bool is_log_continued(FILE *input, const TrajFileHeader *h, uint64_t steps)
+{
+	TrajFileHeader existing;
+	TrajKeyframe last;
+	long long size = seek_to_end(input);
+	uint64_t blocks;
+
+	if (size == 0) {
+		return true;
+	}
+	if (size < (long long)sizeof *h || seek_to(input, 0) || fread(&existing, sizeof existing, 1, input) < 1
+	 || memcmp(&existing, h, sizeof *h) || ((uint64_t)size - sizeof *h) % sizeof(TrajBlock)) {
+		return false;  // Not a compatible log, or a torn block that would misalign the rest
+	}
+	if (!(blocks = ((uint64_t)size - sizeof *h) / sizeof(TrajBlock))) {
+		return true;
+	}
+	return !seek_to(input, sizeof *h + (blocks-1)*sizeof(TrajBlock))
+	    && fread(&last, sizeof last, 1, input) == 1 && last.step + last.count == steps;
+}
+
+static void set_keyframe(TrajBlock *block, Simulation *sim, uint64_t step)
+{
+	int center = (int)(sim->grid->size / 2);  // Invariant under grid expansion
+	memset(block, 0, sizeof *block);
+	block->key.step = step;
+	block->key.y = sim->ant->pos.y - center;
+	block->key.x = sim->ant->pos.x - center;
+	block->key.dir = sim->ant->dir;
+}
+
+/*---------------------------------- Writer ----------------------------------*/
+
+static void *traj_writer(void *arg)
+{
+	Trajectory *traj = arg;
+	bool ok;
+
+	mutex_lock(&traj->lock);
+	while (true) {
+		while (!traj->queued && !traj->closing) {
+			cond_wait(&traj->cond, &traj->lock);
+		}
+		if (!traj->queued) {
+			break;  // Closing and drained
+		}
+		mutex_unlock(&traj->lock);
+
+		ok = fwrite(&traj->blocks[traj->head], sizeof(TrajBlock), 1, traj->output) == 1;
+
+		mutex_lock(&traj->lock);
+		traj->failed |= !ok;
+		traj->head = (traj->head+1) % TRAJ_BUFFERS;
+		traj->queued--;
+		cond_broadcast(&traj->cond);
+	}
+	mutex_unlock(&traj->lock);
+	return NULL;
+}
+
+/* Hands the filled block over to the writer and returns the next one to fill */
+static TrajBlock *submit_block(Trajectory *traj)
+{
+	TrajBlock *next;
+	mutex_lock(&traj->lock);
+	traj->queued++;
+	cond_broadcast(&traj->cond);
+	while (traj->queued == TRAJ_BUFFERS) {
+		cond_wait(&traj->cond, &traj->lock);  // Writer fell behind, wait for a free block
+	}
+	next = &traj->blocks[(traj->head + traj->queued) % TRAJ_BUFFERS];
+	mutex_unlock(&traj->lock);
+	return next;
+}
+
+Trajectory *trajectory_start(const char *filename, Simulation *sim)
+{
+	TrajFileHeader h;
+	Trajectory *traj;
+	FILE *input;
+	long long size;
+
+	assert(sim), assert(!sim->trajectory);
+	memset(&h, 0, sizeof h);
+	memcpy(h.magic, TRAJ_MAGIC, TRAJ_MAGIC_SZ);
+	h.version = TRAJ_VERSION;
+	h.header_size = sizeof h;
+	h.byte_order = TRAJ_BYTE_ORDER;
+	h.block_steps = TRAJ_BLOCK_STEPS;
+
+	if ((input = fopen(filename, "rb"))) {  // Keyframes must stay in step order for trajectory_seek
+		bool continued = is_log_continued(input, &h, sim->steps);
+		fclose(input);
+		if (!continued) {
+			return NULL;
+		}
+	}
+	if (!(traj = calloc(1, sizeof(Trajectory)))) {
+		return NULL;
+	}
+	if (!(traj->output = fopen(filename, "ab"))) {
+		free(traj);
+		return NULL;
+	}
+	if ((size = seek_to_end(traj->output)) < 0 || (size == 0 && fwrite(&h, sizeof h, 1, traj->output) < 1)) {
+		fclose(traj->output);
+		free(traj);
+		return NULL;
+	}
+
+	mutex_init(&traj->lock);
+	cond_init(&traj->cond);
+	if (!thread_create(&traj->thread, traj_writer, traj)) {
+		mutex_destroy(&traj->lock);
+		cond_destroy(&traj->cond);
+		fclose(traj->output);
+		free(traj);
+		return NULL;
+	}
+	traj->fill = &traj->blocks[0];
+	set_keyframe(traj->fill, sim, sim->steps);
+	return sim->trajectory = traj;
+}
+
+int trajectory_stop(Simulation *sim)
+{
+	Trajectory *traj = sim->trajectory;
+	bool ok;
+
+	assert(traj);
+	if (traj->fill->key.count) {
+		submit_block(traj);  // Partial last block
+	}
+	mutex_lock(&traj->lock);
+	traj->closing = true;
+	cond_broadcast(&traj->cond);
+	mutex_unlock(&traj->lock);
+	thread_join(traj->thread);
+
+	ok = !traj->failed;
+	ok &= fclose(traj->output) != EOF;
+	mutex_destroy(&traj->lock);
+	cond_destroy(&traj->cond);
+	free(traj);
+	sim->trajectory = NULL;
+	return ok ? 0 : EOF;
+}
+
+void trajectory_record(Trajectory *traj, Simulation *sim, Direction before)
+{
+	TrajBlock *b = traj->fill;
+	uint32_t n = b->key.count++;
+
+	b->bits[n / 64] |= (uint64_t)(sim->ant->dir == (before+1) % 4) << (n % 64);
+	if (n+1 == TRAJ_BLOCK_STEPS) {
+		uint64_t step = b->key.step + TRAJ_BLOCK_STEPS;
+		traj->fill = submit_block(traj);
+		set_keyframe(traj->fill, sim, step);
+	}
+}
+
+/*---------------------------------- Reader ----------------------------------*/
+
+TrajectoryReader *trajectory_open(const char *filename)
+{
+	TrajectoryReader *reader;
+	TrajFileHeader h;
+	FILE *input;
+	long long size;
+
+	if (!(input = fopen(filename, "rb"))) {
+		return NULL;
+	}
+	if (fread(&h, sizeof h, 1, input) < 1 || memcmp(h.magic, TRAJ_MAGIC, TRAJ_MAGIC_SZ)
+	 || h.version != TRAJ_VERSION || h.header_size != sizeof h || h.byte_order != TRAJ_BYTE_ORDER
+	 || h.block_steps != TRAJ_BLOCK_STEPS) {
+		fclose(input);
+		return NULL;
+	}
+	size = seek_to_end(input);
+	if (size < (long long)sizeof h || !(reader = calloc(1, sizeof(TrajectoryReader)))) {
+		fclose(input);
+		return NULL;
+	}
+	reader->input = input;
+	reader->block_count = ((uint64_t)size - sizeof h) / sizeof(TrajBlock);
+	reader->loaded = reader->origin = reader->block_count;
+	return reader;
+}
+
+void trajectory_close(TrajectoryReader *reader)
+{
+	assert(reader);
+	fclose(reader->input);
+	free(reader);
+}
+
+static bool load_block(TrajectoryReader *reader, uint64_t index)
+{
+	if (index == reader->loaded) {
+		return true;
+	}
+	reader->loaded = reader->block_count;
+	if (seek_to(reader->input, sizeof(TrajFileHeader) + index*sizeof(TrajBlock))
+	 || fread(&reader->block, sizeof(TrajBlock), 1, reader->input) < 1
+	 || reader->block.key.count > TRAJ_BLOCK_STEPS) {
+		return false;
+	}
+	reader->loaded = index;
+	return true;
+}
+
+static uint64_t block_step(TrajectoryReader *reader, uint64_t index)
+{
+	return load_block(reader, index) ? reader->block.key.step : UINT64_MAX;
+}
+
+bool trajectory_range(TrajectoryReader *reader, uint64_t *first, uint64_t *end)
+{
+	assert(reader);
+	if (!reader->block_count || !load_block(reader, 0)) {
+		return false;
+	}
+	*first = reader->block.key.step;
+	if (!load_block(reader, reader->block_count-1)) {
+		return false;
+	}
+	*end = reader->block.key.step + reader->block.key.count;
+	return true;
+}
+
+/* Replays one logged turn */
+static void replay_step(TrajectoryReader *reader)
+{
+	static const Vector2i moves[] = { { -1, 0 }, { 0, 1 }, { 1, 0 }, { 0, -1 } };
+	TrajectoryState *s = &reader->state;
+	uint64_t i = s->step - reader->block.key.step;
+	bool right = reader->block.bits[i / 64] >> (i % 64) & 1;
+
+	s->dir = (s->dir + (right ? 1 : 3)) % 4;
+	s->pos.y += moves[s->dir].y;
+	s->pos.x += moves[s->dir].x;
+	s->step++;
+}
+
+bool trajectory_seek(TrajectoryReader *reader, uint64_t step, TrajectoryState *state)
+{
+	TrajKeyframe *key = &reader->block.key;
+	uint64_t lo = 0, hi, mid;
+
+	assert(reader), assert(state);
+	if (!reader->block_count) {
+		return false;
+	}
+	if (reader->loaded == reader->block_count || step < key->step || step >= key->step + key->count) {
+		/* Last block starting at or before the step, keyframes being in step order */
+		for (hi = reader->block_count; hi - lo > 1; ) {
+			mid = lo + (hi-lo) / 2;
+			if (block_step(reader, mid) <= step) {
+				lo = mid;
+			} else {
+				hi = mid;
+			}
+		}
+		if (!load_block(reader, lo) || step < key->step || step > key->step + key->count) {
+			return false;
+		}
+	}
+
+	if (reader->origin != reader->loaded || reader->state.step > step) {  // Start over from the keyframe
+		reader->origin = reader->loaded;
+		reader->state.step = key->step;
+		reader->state.pos.y = key->y, reader->state.pos.x = key->x;
+		reader->state.dir = (Direction)(key->dir % 4);
+	}
+	while (reader->state.step < step) {
+		replay_step(reader);
+	}
+	*state = reader->state;
+	return true;
+}
+
+bool trajectory_next(TrajectoryReader *reader, TrajectoryState *state)
+{
+	assert(reader), assert(state);
+	if (reader->origin == reader->block_count) {
+		return false;  // Not positioned by trajectory_seek yet
+	}
+	return trajectory_seek(reader, reader->state.step + 1, state);
+}
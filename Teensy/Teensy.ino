@@ -46,6 +46,108 @@ TFT displays[] = {
     TFT(_CS13, _DC, _RST),
 };
 
+struct Rule {
+    byte r, g, b;
+    char turn;  // '\0' for a blank display
+};
+
+Rule shown[DISPLAY_COUNT];   // What each display has on it
+Rule target[DISPLAY_COUNT];  // What it should have, as of the last frame
+unsigned dirty;              // Displays where the two differ
+
+byte frame[SERIAL_FRAME_MAX_LEN];
+size_t frameLen, frameNeed;
+byte lastSeq;
+bool synced;  // Can deltas be applied? Only after a key frame
+
+uint16_t checksum(const byte *data, size_t len) {
+    unsigned sum1 = 0, sum2 = 0;
+    while (len--) {
+        sum1 = (sum1 + *data++) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return sum2 << 8 | sum1;
+}
+
+bool sameRule(const Rule& a, const Rule& b) {
+    return a.turn == b.turn && (!a.turn || (a.r == b.r && a.g == b.g && a.b == b.b));
+}
+
+void reject() {
+    synced = false;  // Deltas make no sense until the next key frame
+    Serial.write(SERIAL_FRAME_NAK);
+}
+
+void applyFrame() {
+    unsigned mask = frame[2] | (unsigned)frame[3] << 8;
+    bool key = mask & SERIAL_FRAME_KEY;
+    byte seq = frame[1];
+    const byte *p = frame + SERIAL_FRAME_HEAD_LEN;
+
+    if (!key && (!synced || seq != (byte)(lastSeq + 1))) {
+        reject();  // A frame went missing in between
+        return;
+    }
+    lastSeq = seq;
+    synced = true;
+
+    for (int i = 0; i < DISPLAY_COUNT; i++) {
+        if (!(mask & 1U << i)) {
+            continue;
+        }
+        target[i] = { p[0], p[1], p[2], (char)p[3] };
+        p += SERIAL_FRAME_RULE_LEN;
+        if (sameRule(target[i], shown[i])) {
+            dirty &= ~(1U << i);  // Changed back before it was drawn
+        } else {
+            dirty |= 1U << i;
+        }
+    }
+}
+
+// Takes in one byte, returns true once a whole valid frame is in
+bool readFrameByte(byte c) {
+    if (frameLen == 0 && c != SERIAL_FRAME_MAGIC) {
+        return false;  // Look for the start of a frame
+    }
+    frame[frameLen++] = c;
+    if (frameLen == SERIAL_FRAME_HEAD_LEN) {
+        unsigned mask = frame[2] | (unsigned)frame[3] << 8;
+        if (mask & ~(SERIAL_DISPLAYS_MASK | SERIAL_FRAME_KEY)) {
+            frameLen = 0;  // Not a frame after all
+            return false;
+        }
+        frameNeed = SERIAL_FRAME_LEN(__builtin_popcount(mask & SERIAL_DISPLAYS_MASK));
+    }
+    if (frameLen < SERIAL_FRAME_HEAD_LEN || frameLen < frameNeed) {
+        return false;
+    }
+
+    frameLen = 0;
+    const byte *sum = frame + frameNeed - SERIAL_FRAME_SUM_LEN;
+    if (checksum(frame + 1, frameNeed - SERIAL_FRAME_SUM_LEN - 1) != (sum[0] | (unsigned)sum[1] << 8)) {
+        reject();
+        return false;
+    }
+    return true;
+}
+
+void draw(int index) {
+    const Rule& rule = target[index];
+    auto& tft = displays[index];
+
+    if (!rule.turn) {
+        tft.background(0, 0, 0);
+    } else {
+        tft.background(rule.r, rule.g, rule.b);
+        tft.setRotation((index >= DISPLAY_COUNT/2) ? 1 : 3);
+        unsigned turnColor = IS_WHITE(rule.r, rule.g, rule.b) ? GRAY : WHITE;
+        tft.drawChar(52, 30, rule.turn, turnColor, turnColor, 10);
+    }
+    shown[index] = rule;
+    dirty &= ~(1U << index);
+}
+
 void setup() {
     Serial.begin(115200);
     for (int i = 0; i < DISPLAY_COUNT; i++) {
@@ -56,29 +158,18 @@ void setup() {
 }
 
 void loop() {
-    while (!Serial.available());
-
-    String msg = Serial.readString(COLOR_RULES_MSG_LEN);
-    const char *begin = msg.c_str();
-    int index = 0;
-
-    for (const char *p = begin; p < begin + msg.length(); p += COLOR_RULE_LEN) {
-        byte r, g, b;
-        char turn;
-        if (sscanf(p, COLOR_RULE_FMT, &r, &g, &b, &turn) != 4) {
-            break;
+    // Take in everything that's arrived first, so a burst of edits ends up as one update
+    while (Serial.available()) {
+        if (readFrameByte(Serial.read())) {
+            applyFrame();
         }
-
-        auto& tft = displays[index];
-        tft.background(r, g, b);
-        tft.setRotation((index >= DISPLAY_COUNT/2) ? 1 : 3);
-        unsigned turnColor = IS_WHITE(r, g, b) ? GRAY : WHITE;
-        tft.drawChar(52, 30, turn, turnColor, turnColor, 10);
-        index++;
     }
 
-    for (; index < DISPLAY_COUNT; index++) {
-        auto& tft = displays[index];
-        tft.background(0, 0, 0);
+    // Redraw one changed display at a time, newer frames may supersede the rest
+    for (int i = 0; i < DISPLAY_COUNT; i++) {
+        if (dirty & 1U << i) {
+            draw(i);
+            break;
+        }
     }
 }